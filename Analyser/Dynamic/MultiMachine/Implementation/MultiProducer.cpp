@@ -8,39 +8,74 @@
 
 #include "MultiProducer.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
+#include <thread>
 
 using namespace Analyser::Dynamic;
 
 // MARK: - MultiInterface
 
 template <typename MachineType>
-void MultiInterface<MachineType>::perform_parallel(const std::function<void(MachineType *)> &function) {
-	// Apply a blunt force parallelisation of the machines; each run_for is dispatched
-	// to a separate queue and this queue will block until all are done.
-	volatile std::size_t outstanding_machines;
-	std::condition_variable condition;
-	std::mutex mutex;
+void MultiInterface<MachineType>::perform_parallel(
+	const std::function<void(MachineType *)> &function,
+	const std::function<bool(MachineType *)> &filter
+) {
+	// Collect the machines that are to be worked upon.
+	std::vector<MachineType *> targets;
 	{
 		std::lock_guard machines_lock(machines_mutex_);
-		std::lock_guard lock(mutex);
-		outstanding_machines = machines_.size();
-
-		for(std::size_t index = 0; index < machines_.size(); ++index) {
-			const auto machine = ::Machine::get<MachineType>(*machines_[index].get());
-			queues_[index].enqueue([&mutex, &condition, machine, function, &outstanding_machines]() {
-				if(machine) function(machine);
-
-				std::lock_guard lock(mutex);
-				outstanding_machines--;
-				condition.notify_all();
-			});
+		targets.reserve(machines_.size());
+		for(const auto &machine: machines_) {
+			const auto typed_machine = ::Machine::get<MachineType>(*machine.get());
+			if(typed_machine && (!filter || filter(typed_machine))) {
+				targets.push_back(typed_machine);
+			}
+		}
+	}
+	if(targets.empty()) return;
+
+	if(!has_created_workers_) {
+		has_created_workers_ = true;
+		const auto cores = std::max(std::thread::hardware_concurrency(), 1u);
+		const auto helpers = std::min(size_t(cores - 1), machines_.size() - 1);
+		for(size_t c = 0; c < helpers; c++) {
+			workers_.push_back(std::make_unique<Concurrency::AsyncTaskQueue<true>>());
+		}
+	}
+
+	// Each participating thread repeatedly claims the next unclaimed machine until there are none left.
+	std::atomic<size_t> next_target = 0;
+	const auto work = [&next_target, &targets, &function] {
+		while(true) {
+			const size_t index = next_target++;
+			if(index >= targets.size()) break;
+			function(targets[index]);
 		}
+	};
+
+	// Enlist as many helpers as could usefully contribute, then join in on this thread
+	// and wait for all helpers to finish.
+	const size_t helpers = std::min(workers_.size(), targets.size() - 1);
+	size_t outstanding_helpers = helpers;
+	std::condition_variable condition;
+	std::mutex mutex;
+	for(size_t index = 0; index < helpers; ++index) {
+		workers_[index]->enqueue([&mutex, &condition, &work, &outstanding_helpers] {
+			work();
+
+			std::lock_guard lock(mutex);
+			--outstanding_helpers;
+			condition.notify_all();
+		});
 	}
 
+	work();
+
 	std::unique_lock lock(mutex);
-	condition.wait(lock, [&outstanding_machines] { return !outstanding_machines; });
+	condition.wait(lock, [&outstanding_helpers] { return !outstanding_helpers; });
 }
 
 template <typename MachineType>
@@ -97,9 +132,26 @@ void MultiAudioProducer::did_change_machine_order() {
 // MARK: - MultiTimedMachine
 
 void MultiTimedMachine::run_for(Time::Seconds duration) {
-	perform_parallel([duration](::MachineTypes::TimedMachine *machine) {
-		if(machine->get_confidence() >= 0.01f) machine->run_for(duration);
+	// Stop running any machine whose confidence has collapsed, either absolutely or relative to the
+	// current leader. A stopped machine is never resumed, even if the leader's confidence later falls.
+	float leading_confidence = 0.0f;
+	perform_serial([&leading_confidence](::MachineTypes::TimedMachine *machine) {
+		leading_confidence = std::max(leading_confidence, machine->get_confidence());
 	});
+	const float minimum_confidence = std::max(0.01f, leading_confidence * 0.125f);
+
+	perform_parallel(
+		[duration](::MachineTypes::TimedMachine *machine) {
+			machine->run_for(duration);
+		},
+		[minimum_confidence, this](::MachineTypes::TimedMachine *machine) {
+			if(stopped_machines_.find(machine) != stopped_machines_.end()) return false;
+			if(machine->get_confidence() >= minimum_confidence) return true;
+
+			stopped_machines_.insert(machine);
+			return false;
+		}
+	);
 
 	if(delegate_) delegate_->did_run_machines(this);
 }
@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <mutex>
+#include <unordered_set>
 #include <vector>
 
 namespace Analyser::Dynamic {
@@ -23,16 +24,17 @@ namespace Analyser::Dynamic {
 template <typename MachineType> class MultiInterface {
 	public:
 		MultiInterface(const std::vector<std::unique_ptr<::Machine::DynamicMachine>> &machines, std::recursive_mutex &machines_mutex) :
-			machines_(machines), machines_mutex_(machines_mutex), queues_(machines.size()) {}
+			machines_(machines), machines_mutex_(machines_mutex) {}
 
 	protected:
 		/*!
-			Performs a parallel for operation across all machines, performing the supplied
-			function on each and returning only once all applications have completed.
+			Performs a parallel for operation across all machines for which @c filter returns @c true,
+			performing the supplied function on each and returning only once all applications have completed.
 
+			Machines are shared out amongst a pool of at most one thread per core, including the calling thread.
 			No guarantees are extended as to which thread operations will occur on.
 		*/
-		void perform_parallel(const std::function<void(MachineType *)> &);
+		void perform_parallel(const std::function<void(MachineType *)> &, const std::function<bool(MachineType *)> &filter = nullptr);
 
 		/*!
 			Performs a serial for operation across all machines, performing the supplied
@@ -45,7 +47,9 @@ template <typename MachineType> class MultiInterface {
 		std::recursive_mutex &machines_mutex_;
 
 	private:
-		std::vector<Concurrency::AsyncTaskQueue<true>> queues_;
+		// Helper threads, in addition to the caller's, for perform_parallel; created upon first use.
+		std::vector<std::unique_ptr<Concurrency::AsyncTaskQueue<true>>> workers_;
+		bool has_created_workers_ = false;
 };
 
 class MultiTimedMachine: public MultiInterface<MachineTypes::TimedMachine>, public MachineTypes::TimedMachine {
@@ -69,6 +73,9 @@ class MultiTimedMachine: public MultiInterface<MachineTypes::TimedMachine>, publ
 	private:
 		void run_for(const Cycles) final {}
 		Delegate *delegate_ = nullptr;
+
+		// Machines that have been stopped for lack of confidence.
+		std::unordered_set<MachineTypes::TimedMachine *> stopped_machines_;
 };
 
 class MultiScanProducer: public MultiInterface<MachineTypes::ScanProducer>, public MachineTypes::ScanProducer {
@@ -31,8 +31,8 @@ namespace Analyser::Dynamic {
 	anything installed as the speaker's delegate will similarly receive
 	feedback only from that machine.
 
-	Following each crt_machine->run_for, reorders the supplied machines by
-	confidence.
+	Calls to run_for are shared across a pool of at most one thread per core.
+	Following each, reorders the supplied machines by confidence.
 
 	If confidence for any machine becomes disproportionately low compared to
 	the others in the set, that machine stops running.
@@ -58,6 +58,7 @@ class MultiMachine: public ::Machine::DynamicMachine, public MultiTimedMachine::
 		MachineTypes::KeyboardMachine *keyboard_machine() final;
 		MachineTypes::MouseMachine *mouse_machine() final;
 		MachineTypes::MediaTarget *media_target() final;
+		MachineTypes::StateProducer *state_producer() final;
 		void *raw_pointer() final;
 
 	private:
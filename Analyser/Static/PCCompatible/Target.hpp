@@ -21,7 +21,8 @@ struct Target: public Analyser::Static::Target, public Reflection::StructImpl<Ta
 
 	ReflectableEnum(Speed,
 		ApproximatelyOriginal,
-		Fast);
+		Fast,
+		Unlimited);
 	Speed speed = Speed::Fast;
 
 	Target() : Analyser::Static::Target(Machine::PCCompatible) {
@@ -8,7 +8,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <type_traits>
 #include <vector>
 
 /*!
@@ -89,14 +94,116 @@ template <typename TimeUnit> class DeferredQueue {
 		std::vector<DeferredAction> pending_actions_;
 };
 
+/*!
+	Provides the same interface as DeferredQueue but holds actions inline, in a binary heap, so that scheduling
+	is O(log n). Space for @c Capacity actions is reserved at construction, so that neither scheduling nor
+	performing an action involves the heap allocator unless more than that many are pending at once.
+
+	Actions must be trivially copyable and no larger than @c ActionSize bytes — in practice that means lambdas
+	that capture only pointers and plain values. Actions scheduled for the same time are performed in the same
+	order as DeferredQueue would, i.e. most recently-deferred first.
+*/
+template <typename TimeUnit, size_t Capacity = 32> class FixedDeferredQueue {
+	public:
+		static constexpr size_t ActionSize = 24;
+
+		FixedDeferredQueue() {
+			heap_.reserve(Capacity);
+		}
+
+		/*!
+			Schedules @c action to occur in @c delay units of time.
+		*/
+		template <typename FuncT> void defer(TimeUnit delay, const FuncT &action) {
+			static_assert(std::is_trivially_copyable_v<FuncT>, "Deferred actions must be trivially copyable");
+			static_assert(sizeof(FuncT) <= ActionSize, "Deferred action captures too much state");
+			static_assert(alignof(FuncT) <= alignof(void *), "Deferred action is over-aligned");
+
+			// Apply immediately if there's no delay (or a negative delay).
+			if(delay <= TimeUnit(0)) {
+				action();
+				return;
+			}
+
+			Entry &entry = heap_.emplace_back();
+			entry.time = now_ + delay;
+			entry.sequence = ++sequence_;
+			std::memcpy(entry.storage, &action, sizeof(FuncT));
+			entry.perform = [](const std::byte *storage) {
+				alignas(FuncT) std::byte copy[sizeof(FuncT)];
+				std::memcpy(copy, storage, sizeof(FuncT));
+				(*reinterpret_cast<const FuncT *>(copy))();
+			};
+
+			std::push_heap(heap_.begin(), heap_.end(), fires_after);
+		}
+
+		/*!
+			@returns The amount of time until the next enqueued action will occur,
+				or TimeUnit(-1) if the queue is empty.
+		*/
+		TimeUnit time_until_next_action() const {
+			if(heap_.empty()) return TimeUnit(-1);
+			return heap_[0].time - now_;
+		}
+
+		/*!
+			Advances the queue the specified amount of time, performing any actions it reaches.
+		*/
+		void advance(TimeUnit time) {
+			now_ += time;
+			while(!heap_.empty() && heap_[0].time <= now_) {
+				pop()();
+			}
+
+			// Keep absolute times small while there's nothing to preserve.
+			if(heap_.empty()) {
+				now_ = TimeUnit(0);
+			}
+		}
+
+		/// @returns @c true if no actions are enqueued; @c false otherwise.
+		bool empty() const {
+			return heap_.empty();
+		}
+
+	private:
+		struct Entry {
+			TimeUnit time;
+			uint64_t sequence;
+			alignas(void *) std::byte storage[ActionSize];
+			void (*perform)(const std::byte *);
+
+			void operator()() const {
+				perform(storage);
+			}
+		};
+		static bool fires_after(const Entry &lhs, const Entry &rhs) {
+			if(lhs.time != rhs.time) return lhs.time > rhs.time;
+			return lhs.sequence < rhs.sequence;
+		}
+
+		/// Removes and returns the next entry.
+		Entry pop() {
+			std::pop_heap(heap_.begin(), heap_.end(), fires_after);
+			const Entry next = heap_.back();
+			heap_.pop_back();
+			return next;
+		}
+
+		std::vector<Entry> heap_;
+		TimeUnit now_ = TimeUnit(0);
+		uint64_t sequence_ = 0;
+};
+
 /*!
 	A DeferredQueue maintains a list of ordered actions and the times at which
 	they should happen, and divides a total execution period up into the portions
 	that occur between those actions, triggering each action when it is reached.
 
-	This list is efficient only for short queues.
+	This list is efficient only for short queues, unless a FixedDeferredQueue is supplied as @c QueueT.
 */
-template <typename TimeUnit> class DeferredQueuePerformer: public DeferredQueue<TimeUnit> {
+template <typename TimeUnit, typename QueueT = DeferredQueue<TimeUnit>> class DeferredQueuePerformer: public QueueT {
 	public:
 		/// Constructs a DeferredQueue that will call target(period) in between deferred actions.
 		constexpr DeferredQueuePerformer(std::function<void(TimeUnit)> &&target) : target_(std::move(target)) {}
@@ -108,17 +215,16 @@ template <typename TimeUnit> class DeferredQueuePerformer: public DeferredQueue<
 			any scheduled actions will be called between periods.
 		*/
 		void run_for(TimeUnit length) {
-			auto time_to_next = DeferredQueue<TimeUnit>::time_until_next_action();
+			auto time_to_next = QueueT::time_until_next_action();
 			while(time_to_next != TimeUnit(-1) && time_to_next <= length) {
 				target_(time_to_next);
 				length -= time_to_next;
-				DeferredQueue<TimeUnit>::advance(time_to_next);
+				QueueT::advance(time_to_next);
+				time_to_next = QueueT::time_until_next_action();
 			}
 
-			DeferredQueue<TimeUnit>::advance(length);
+			QueueT::advance(length);
 			target_(length);
-
-			// TODO: optimise this to avoid the multiple std::vector deletes. Find a neat way to expose that solution, maybe?
 		}
 
 	private:
@@ -13,6 +13,7 @@
 #include "Implementation/6522Storage.hpp"
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
+#include "../../Reflection/Struct.hpp"
 
 namespace MOS::MOS6522 {
 
@@ -136,6 +137,128 @@ template <class BusHandlerT> class MOS6522: public MOS6522Storage {
 		void evaluate_port_b_output();
 };
 
+/*!
+	Captures the complete register and line state of a 6522.
+
+	The owner should @c flush the 6522 before capturing state. Applying state does not
+	communicate with the port handler; the owner is responsible for reestablishing the
+	effects of whatever the 6522 is currently outputting.
+*/
+struct State: public Reflection::StructImpl<State> {
+	uint8_t output[2]{};
+	uint8_t input[2]{};
+	uint8_t data_direction[2]{};
+	uint16_t timer[2]{};
+	uint16_t timer_latch[2]{};
+	uint16_t last_timer[2]{};
+	int next_timer[2]{};
+	uint8_t shift = 0;
+	uint8_t auxiliary_control = 0;
+	uint8_t peripheral_control = 0;
+	uint8_t interrupt_flags = 0;
+	uint8_t interrupt_enable = 0;
+	bool timer_needs_reload = false;
+	uint8_t timer_port_b_output = 0xff;
+
+	// Indexed as [port * 2 + line].
+	bool control_inputs[4]{};
+	uint8_t control_outputs[4]{};
+
+	uint8_t handshake_modes[2]{};
+	bool timer_is_running[2]{};
+	bool last_posted_interrupt_status = false;
+	int shift_bits_remaining = 8;
+	bool is_phase2 = false;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(output);
+			DeclareField(input);
+			DeclareField(data_direction);
+			DeclareField(timer);
+			DeclareField(timer_latch);
+			DeclareField(last_timer);
+			DeclareField(next_timer);
+			DeclareField(shift);
+			DeclareField(auxiliary_control);
+			DeclareField(peripheral_control);
+			DeclareField(interrupt_flags);
+			DeclareField(interrupt_enable);
+			DeclareField(timer_needs_reload);
+			DeclareField(timer_port_b_output);
+			DeclareField(control_inputs);
+			DeclareField(control_outputs);
+			DeclareField(handshake_modes);
+			DeclareField(timer_is_running);
+			DeclareField(last_posted_interrupt_status);
+			DeclareField(shift_bits_remaining);
+			DeclareField(is_phase2);
+		}
+	}
+
+	State(const MOS6522Storage &source) : State() {
+		const auto &registers = source.registers_;
+		for(int c = 0; c < 2; c++) {
+			output[c] = registers.output[c];
+			input[c] = registers.input[c];
+			data_direction[c] = registers.data_direction[c];
+			timer[c] = registers.timer[c];
+			timer_latch[c] = registers.timer_latch[c];
+			last_timer[c] = registers.last_timer[c];
+			next_timer[c] = registers.next_timer[c];
+
+			for(int line = 0; line < 2; line++) {
+				control_inputs[c*2 + line] = source.control_inputs_[c].lines[line];
+				control_outputs[c*2 + line] = uint8_t(source.control_outputs_[c].lines[line]);
+			}
+			handshake_modes[c] = uint8_t(source.handshake_modes_[c]);
+			timer_is_running[c] = source.timer_is_running_[c];
+		}
+		shift = registers.shift;
+		auxiliary_control = registers.auxiliary_control;
+		peripheral_control = registers.peripheral_control;
+		interrupt_flags = registers.interrupt_flags;
+		interrupt_enable = registers.interrupt_enable;
+		timer_needs_reload = registers.timer_needs_reload;
+		timer_port_b_output = registers.timer_port_b_output;
+
+		last_posted_interrupt_status = source.last_posted_interrupt_status_;
+		shift_bits_remaining = source.shift_bits_remaining_;
+		is_phase2 = source.is_phase2_;
+	}
+
+	void apply(MOS6522Storage &target) const {
+		auto &registers = target.registers_;
+		for(int c = 0; c < 2; c++) {
+			registers.output[c] = output[c];
+			registers.input[c] = input[c];
+			registers.data_direction[c] = data_direction[c];
+			registers.timer[c] = timer[c];
+			registers.timer_latch[c] = timer_latch[c];
+			registers.last_timer[c] = last_timer[c];
+			registers.next_timer[c] = next_timer[c];
+
+			for(int line = 0; line < 2; line++) {
+				target.control_inputs_[c].lines[line] = control_inputs[c*2 + line];
+				target.control_outputs_[c].lines[line] = MOS6522Storage::LineState(control_outputs[c*2 + line]);
+			}
+			target.handshake_modes_[c] = MOS6522Storage::HandshakeMode(handshake_modes[c]);
+			target.timer_is_running_[c] = timer_is_running[c];
+		}
+		registers.shift = shift;
+		registers.auxiliary_control = auxiliary_control;
+		registers.peripheral_control = peripheral_control;
+		registers.interrupt_flags = interrupt_flags;
+		registers.interrupt_enable = interrupt_enable;
+		registers.timer_needs_reload = timer_needs_reload;
+		registers.timer_port_b_output = timer_port_b_output;
+
+		target.last_posted_interrupt_status_ = last_posted_interrupt_status;
+		target.shift_bits_remaining_ = shift_bits_remaining;
+		target.is_phase2_ = is_phase2;
+	}
+};
+
 }
 
 #include "Implementation/6522Implementation.hpp"
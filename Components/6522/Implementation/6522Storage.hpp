@@ -103,6 +103,8 @@ class MOS6522Storage {
 		bool port1_is_latched() const {
 			return registers_.auxiliary_control & 0x01;
 		}
+
+		friend struct State;
 };
 
 }
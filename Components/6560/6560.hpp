@@ -19,7 +19,7 @@ namespace MOS::MOS6560 {
 // audio state
 class AudioGenerator: public Outputs::Speaker::BufferSource<AudioGenerator, false> {
 	public:
-		AudioGenerator(Concurrency::AsyncTaskQueue<false> &audio_queue);
+		AudioGenerator(Concurrency::SingleProducerTaskQueue &audio_queue);
 
 		void set_volume(uint8_t volume);
 		void set_control(int channel, uint8_t value);
@@ -30,7 +30,7 @@ class AudioGenerator: public Outputs::Speaker::BufferSource<AudioGenerator, fals
 		void set_sample_volume_range(std::int16_t range);
 
 	private:
-		Concurrency::AsyncTaskQueue<false> &audio_queue_;
+		Concurrency::SingleProducerTaskQueue &audio_queue_;
 
 		unsigned int counters_[4] = {2, 1, 0, 0};	// create a slight phase offset for the three channels
 		unsigned int shift_registers_[4] = {0, 0, 0, 0};
@@ -434,7 +434,8 @@ template <class BusHandler> class MOS6560 {
 		BusHandler &bus_handler_;
 		Outputs::CRT::CRT crt_;
 
-		Concurrency::AsyncTaskQueue<false> audio_queue_;
+		// Single producer: only register writes, made as the owning machine runs, enqueue to this.
+		Concurrency::SingleProducerTaskQueue audio_queue_;
 		AudioGenerator audio_generator_;
 		Outputs::Speaker::PullLowpass<AudioGenerator> speaker_;
 
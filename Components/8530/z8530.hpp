@@ -10,6 +10,8 @@
 
 #include <cstdint>
 
+#include "../../Reflection/Struct.hpp"
+
 namespace Zilog::SCC {
 
 /*!
@@ -94,6 +96,8 @@ class z8530 {
 				uint8_t external_interrupt_status_ = 0;
 
 				bool dcd_ = false;
+
+				friend struct State;
 		} channels_[2];
 
 		uint8_t pointer_ = 0;
@@ -105,6 +109,93 @@ class z8530 {
 		bool previous_interrupt_line_ = false;
 		void update_delegate();
 		Delegate *delegate_ = nullptr;
+
+		friend struct State;
+};
+
+/*!
+	Captures the register state of both channels of a z8530.
+
+	Applying state does not notify the delegate; the owner should re-read the interrupt line.
+*/
+struct State: public Reflection::StructImpl<State> {
+	// Per-channel state, indexed by channel.
+	uint8_t data[2]{};
+	uint8_t parity[2]{};
+	uint8_t stop_bits[2]{};
+	uint8_t sync_mode[2]{};
+	int clock_rate_multiplier[2]{};
+	uint8_t interrupt_mask[2]{};
+	uint8_t external_interrupt_mask[2]{};
+	bool external_status_interrupt[2]{};
+	uint8_t external_interrupt_status[2]{};
+	bool dcd[2]{};
+
+	// Shared state.
+	uint8_t pointer = 0;
+	uint8_t interrupt_vector = 0;
+	uint8_t master_interrupt_control = 0;
+	bool previous_interrupt_line = false;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(data);
+			DeclareField(parity);
+			DeclareField(stop_bits);
+			DeclareField(sync_mode);
+			DeclareField(clock_rate_multiplier);
+			DeclareField(interrupt_mask);
+			DeclareField(external_interrupt_mask);
+			DeclareField(external_status_interrupt);
+			DeclareField(external_interrupt_status);
+			DeclareField(dcd);
+			DeclareField(pointer);
+			DeclareField(interrupt_vector);
+			DeclareField(master_interrupt_control);
+			DeclareField(previous_interrupt_line);
+		}
+	}
+
+	State(const z8530 &source) : State() {
+		for(int c = 0; c < 2; c++) {
+			const auto &channel = source.channels_[c];
+			data[c] = channel.data_;
+			parity[c] = uint8_t(channel.parity_);
+			stop_bits[c] = uint8_t(channel.stop_bits_);
+			sync_mode[c] = uint8_t(channel.sync_mode_);
+			clock_rate_multiplier[c] = channel.clock_rate_multiplier_;
+			interrupt_mask[c] = channel.interrupt_mask_;
+			external_interrupt_mask[c] = channel.external_interrupt_mask_;
+			external_status_interrupt[c] = channel.external_status_interrupt_;
+			external_interrupt_status[c] = channel.external_interrupt_status_;
+			dcd[c] = channel.dcd_;
+		}
+		pointer = source.pointer_;
+		interrupt_vector = source.interrupt_vector_;
+		master_interrupt_control = source.master_interrupt_control_;
+		previous_interrupt_line = source.previous_interrupt_line_;
+	}
+
+	void apply(z8530 &target) const {
+		using Channel = z8530::Channel;
+		for(int c = 0; c < 2; c++) {
+			auto &channel = target.channels_[c];
+			channel.data_ = data[c];
+			channel.parity_ = Channel::Parity(parity[c]);
+			channel.stop_bits_ = Channel::StopBits(stop_bits[c]);
+			channel.sync_mode_ = Channel::Sync(sync_mode[c]);
+			channel.clock_rate_multiplier_ = clock_rate_multiplier[c];
+			channel.interrupt_mask_ = interrupt_mask[c];
+			channel.external_interrupt_mask_ = external_interrupt_mask[c];
+			channel.external_status_interrupt_ = external_status_interrupt[c];
+			channel.external_interrupt_status_ = external_interrupt_status[c];
+			channel.dcd_ = dcd[c];
+		}
+		target.pointer_ = pointer;
+		target.interrupt_vector_ = interrupt_vector;
+		target.master_interrupt_control_ = master_interrupt_control;
+		target.previous_interrupt_line_ = previous_interrupt_line;
+	}
 };
 
 }
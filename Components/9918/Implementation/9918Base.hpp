@@ -12,11 +12,13 @@
 
 #include "../../../ClockReceiver/ClockReceiver.hpp"
 #include "../../../Numeric/BitReverse.hpp"
+#include "../../../Numeric/BitSpread.hpp"
 #include "../../../Outputs/CRT/CRT.hpp"
 
 #include "AccessEnums.hpp"
 #include "LineBuffer.hpp"
 #include "PersonalityTraits.hpp"
+#include "Spans.hpp"
 #include "Storage.hpp"
 #include "YamahaCommands.hpp"
 
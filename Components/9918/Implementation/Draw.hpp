@@ -36,7 +36,9 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 
 	int sprite_buffer[256];
 	int sprite_collision = 0;
-	memset(&sprite_buffer[start], 0, size_t(end - start)*sizeof(sprite_buffer[0]));
+	if constexpr (mode != SpriteMode::Mode1) {
+		memset(&sprite_buffer[start], 0, size_t(end - start)*sizeof(sprite_buffer[0]));
+	}
 
 	if constexpr (mode == SpriteMode::MasterSystem) {
 		// Draw all sprites into the sprite buffer.
@@ -90,7 +92,6 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 	constexpr uint32_t sprite_colour_selection_masks[2] = {0x00000000, 0xffffffff};
 	constexpr int colour_masks[16] = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
 	const int sprite_width = sprites_16x16_ ? 16 : 8;
-	const int shifter_target = sprite_width << 1;
 	const int pixel_width = sprites_magnified_ ? sprite_width << 1 : sprite_width;
 	int min_sprite = 0;
 
@@ -207,33 +208,73 @@ void Base<personality>::draw_sprites([[maybe_unused]] uint8_t y, int start, int
 	}
 
 	if constexpr (mode == SpriteMode::Mode1) {
-		for(int index = buffer.active_sprite_slot - 1; index >= min_sprite; --index) {
-			auto &sprite = buffer.active_sprites[index];
-			if(sprite.shift_position >= shifter_target) {
-				continue;
+		// Each sprite is reduced to a mask of up to 32 pixels, least-significant bit leftmost, clipped to
+		// [start, end). Collisions are then any overlap with pixels already claimed by another sprite in a
+		// mask of the whole line, and sprites are blended onto the background eight pixels at a time,
+		// in reverse order of priority.
+		const auto sprite_mask = [&](const SpriteBuffer::ActiveSprite &sprite) {
+			const uint8_t left = Numeric::bit_reverse(sprite.image[0]);
+			const uint8_t right = sprites_16x16_ ? Numeric::bit_reverse(sprite.image[1]) : 0;
+			if(sprites_magnified_) {
+				return uint32_t(Numeric::spread_bits(left) * 3) | (uint32_t(Numeric::spread_bits(right) * 3) << 16);
 			}
+			return uint32_t(left) | (uint32_t(right) << 8);
+		};
 
-			const int pixel_start = std::max(start, sprite.x);
-			for(int c = pixel_start; c < end && sprite.shift_position < shifter_target; ++c) {
-				const int shift = (sprite.shift_position >> 1) ^ 7;
-				int sprite_colour = (sprite.image[shift >> 3] >> (shift & 7)) & 1;
+		std::array<uint64_t, 6> occupancy{};
+		uint64_t collisions = 0;
 
-				// A colision is detected regardless of sprite colour ...
-				sprite_collision |= sprite_buffer[c] & sprite_colour;
-				sprite_buffer[c] |= sprite_colour;
+		for(int index = buffer.active_sprite_slot - 1; index >= 0; --index) {
+			const auto &sprite = buffer.active_sprites[index];
+			const int first = start - sprite.x;
+			const int last = end - sprite.x;
+			if(first >= pixel_width || last <= 0) {
+				continue;
+			}
 
-				// ... but a sprite with the transparent colour won't actually be visible.
-				sprite_colour &= colour_masks[sprite.image[2] & 0xf];
+			uint32_t mask = sprite_mask(sprite);
+			if(first > 0) mask &= ~((1u << first) - 1);
+			if(last < 32) mask &= (1u << last) - 1;
+			if(!mask) {
+				continue;
+			}
 
-				pixel_origin_[c] =
-					(pixel_origin_[c] & sprite_colour_selection_masks[sprite_colour^1]) |
-					(palette[sprite.image[2] & 0xf] & sprite_colour_selection_masks[sprite_colour]);
+			// Align the mask to the first on-screen pixel; anything to the left of that has already been clipped.
+			int position = sprite.x;
+			if(position < 0) {
+				mask >>= -position;
+				position = 0;
+			}
 
-				sprite.shift_position += shift_advance;
+			// A colision is detected regardless of sprite colour ...
+			const size_t word = size_t(position >> 6);
+			const int offset = position & 63;
+			const uint64_t low = uint64_t(mask) << offset;
+			const uint64_t high = offset ? uint64_t(mask) >> (64 - offset) : 0;
+			collisions |= (occupancy[word] & low) | (occupancy[word + 1] & high);
+			occupancy[word] |= low;
+			occupancy[word + 1] |= high;
+
+			// ... but a sprite with the transparent colour won't actually be visible.
+			const uint32_t colour = palette[sprite.image[2] & 0xf];
+			if(!colour_masks[sprite.image[2] & 0xf]) {
+				continue;
+			}
+			for(int c = 0; c < 32 && mask; c += 8, mask >>= 8) {
+				const auto bits = uint8_t(mask);
+				if(position + c + 8 <= 256) {
+					Spans::blend8(&pixel_origin_[position + c], bits, colour);
+				} else {
+					for(int bit = 0; bit < 8; bit++) {
+						if((bits >> bit) & 1) pixel_origin_[position + c + bit] = colour;
+					}
+				}
 			}
 		}
 
-		status_ |= sprite_collision << StatusSpriteCollisionShift;
+		if(collisions) {
+			status_ |= StatusSpriteCollision;
+		}
 		return;
 	}
 }
@@ -259,7 +300,6 @@ void Base<personality>::draw_tms_character(int start, int end) {
 	auto &line_buffer = *draw_line_buffer_;
 
 	// Paint the background tiles.
-	const int pixels_left = end - start;
 	if(this->screen_mode_ == ScreenMode::MultiColour) {
 		for(int c = start; c < end; ++c) {
 			pixel_target_[c] = palette()[
@@ -267,35 +307,27 @@ void Base<personality>::draw_tms_character(int start, int end) {
 			];
 		}
 	} else {
-		const int shift = start & 7;
-		int byte_column = start >> 3;
-
-		int length = std::min(pixels_left, 8 - shift);
-
-		int pattern = Numeric::bit_reverse(line_buffer.tiles.patterns[byte_column][0]) >> shift;
-		uint8_t colour = line_buffer.tiles.patterns[byte_column][1];
-		uint32_t colours[2] = {
-			palette()[(colour & 15) ? (colour & 15) : background_colour_],
-			palette()[(colour >> 4) ? (colour >> 4) : background_colour_]
-		};
-
-		int background_pixels_left = pixels_left;
-		while(true) {
-			background_pixels_left -= length;
-			for(int c = 0; c < length; ++c) {
-				pixel_target_[c] = colours[pattern&0x01];
-				pattern >>= 1;
+		// Output whole pattern bytes as eight-pixel spans, and any partial bytes at either end pixel-by-pixel.
+		int c = start;
+		while(c < end) {
+			const int byte_column = c >> 3;
+			const uint8_t pattern = Numeric::bit_reverse(line_buffer.tiles.patterns[byte_column][0]);
+			const uint8_t colour = line_buffer.tiles.patterns[byte_column][1];
+			const uint32_t background = palette()[(colour & 15) ? (colour & 15) : background_colour_];
+			const uint32_t foreground = palette()[(colour >> 4) ? (colour >> 4) : background_colour_];
+
+			const int column_end = std::min(end, (byte_column + 1) << 3);
+			if(!(c & 7) && column_end - c == 8) {
+				Spans::select8(pixel_target_, pattern, background, foreground);
+				pixel_target_ += 8;
+				c += 8;
+				continue;
 			}
-			pixel_target_ += length;
-
-			if(!background_pixels_left) break;
-			length = std::min(8, background_pixels_left);
-			byte_column++;
 
-			pattern = Numeric::bit_reverse(line_buffer.tiles.patterns[byte_column][0]);
-			colour = line_buffer.tiles.patterns[byte_column][1];
-			colours[0] = palette()[(colour & 15) ? (colour & 15) : background_colour_];
-			colours[1] = palette()[(colour >> 4) ? (colour >> 4) : background_colour_];
+			for(; c < column_end; ++c) {
+				*pixel_target_ = (pattern >> (c & 7)) & 1 ? foreground : background;
+				++pixel_target_;
+			}
 		}
 	}
 
@@ -0,0 +1,98 @@
+//
+//  Spans.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace TI::TMS::Spans {
+
+// Eight-pixel spans are described by a byte in which the least-significant bit
+// corresponds to the leftmost pixel.
+
+/*!
+	Writes eight pixels to @c target: @c foreground wherever the corresponding bit of @c bits
+	is set, @c background elsewhere.
+*/
+inline void select8(uint32_t *target, uint8_t bits, uint32_t background, uint32_t foreground) {
+#if defined(__SSE2__) || defined(_M_X64)
+	const __m128i pattern = _mm_set1_epi32(bits);
+	const __m128i low_bits = _mm_setr_epi32(0x01, 0x02, 0x04, 0x08);
+	const __m128i high_bits = _mm_setr_epi32(0x10, 0x20, 0x40, 0x80);
+	const __m128i low_mask = _mm_cmpeq_epi32(_mm_and_si128(pattern, low_bits), low_bits);
+	const __m128i high_mask = _mm_cmpeq_epi32(_mm_and_si128(pattern, high_bits), high_bits);
+
+	const __m128i backgrounds = _mm_set1_epi32(int(background));
+	const __m128i foregrounds = _mm_set1_epi32(int(foreground));
+	_mm_storeu_si128(
+		reinterpret_cast<__m128i *>(target),
+		_mm_or_si128(_mm_and_si128(low_mask, foregrounds), _mm_andnot_si128(low_mask, backgrounds)));
+	_mm_storeu_si128(
+		reinterpret_cast<__m128i *>(target + 4),
+		_mm_or_si128(_mm_and_si128(high_mask, foregrounds), _mm_andnot_si128(high_mask, backgrounds)));
+#elif defined(__ARM_NEON)
+	const uint32x4_t pattern = vdupq_n_u32(bits);
+	static constexpr uint32_t low_bits[] = {0x01, 0x02, 0x04, 0x08};
+	static constexpr uint32_t high_bits[] = {0x10, 0x20, 0x40, 0x80};
+	const uint32x4_t backgrounds = vdupq_n_u32(background);
+	const uint32x4_t foregrounds = vdupq_n_u32(foreground);
+	vst1q_u32(target, vbslq_u32(vtstq_u32(pattern, vld1q_u32(low_bits)), foregrounds, backgrounds));
+	vst1q_u32(target + 4, vbslq_u32(vtstq_u32(pattern, vld1q_u32(high_bits)), foregrounds, backgrounds));
+#else
+	for(int c = 0; c < 8; c++) {
+		target[c] = (bits >> c) & 1 ? foreground : background;
+	}
+#endif
+}
+
+/*!
+	Replaces with @c colour each of the eight pixels at @c target for which the corresponding bit
+	of @c bits is set, leaving the others as they were.
+*/
+inline void blend8(uint32_t *target, uint8_t bits, uint32_t colour) {
+	if(!bits) return;
+
+#if defined(__SSE2__) || defined(_M_X64)
+	const __m128i pattern = _mm_set1_epi32(bits);
+	const __m128i low_bits = _mm_setr_epi32(0x01, 0x02, 0x04, 0x08);
+	const __m128i high_bits = _mm_setr_epi32(0x10, 0x20, 0x40, 0x80);
+	const __m128i low_mask = _mm_cmpeq_epi32(_mm_and_si128(pattern, low_bits), low_bits);
+	const __m128i high_mask = _mm_cmpeq_epi32(_mm_and_si128(pattern, high_bits), high_bits);
+
+	const __m128i colours = _mm_set1_epi32(int(colour));
+	__m128i *const low_target = reinterpret_cast<__m128i *>(target);
+	__m128i *const high_target = reinterpret_cast<__m128i *>(target + 4);
+	_mm_storeu_si128(
+		low_target,
+		_mm_or_si128(_mm_and_si128(low_mask, colours), _mm_andnot_si128(low_mask, _mm_loadu_si128(low_target))));
+	_mm_storeu_si128(
+		high_target,
+		_mm_or_si128(_mm_and_si128(high_mask, colours), _mm_andnot_si128(high_mask, _mm_loadu_si128(high_target))));
+#elif defined(__ARM_NEON)
+	const uint32x4_t pattern = vdupq_n_u32(bits);
+	static constexpr uint32_t low_bits[] = {0x01, 0x02, 0x04, 0x08};
+	static constexpr uint32_t high_bits[] = {0x10, 0x20, 0x40, 0x80};
+	const uint32x4_t colours = vdupq_n_u32(colour);
+	vst1q_u32(target, vbslq_u32(vtstq_u32(pattern, vld1q_u32(low_bits)), colours, vld1q_u32(target)));
+	vst1q_u32(target + 4, vbslq_u32(vtstq_u32(pattern, vld1q_u32(high_bits)), colours, vld1q_u32(target + 4)));
+#else
+	for(int c = 0; c < 8; c++) {
+		if((bits >> c) & 1) target[c] = colour;
+	}
+#endif
+}
+
+}
@@ -6,7 +6,9 @@
 //  Copyright 2016 Thomas Harte. All rights reserved.
 //
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "AY38910.hpp"
 
@@ -147,6 +149,61 @@ void AY38910SampleSource<is_stereo>::advance() {
 	evaluate_output_volume();
 }
 
+template <bool is_stereo>
+int AY38910SampleSource<is_stereo>::advances_until_transition() const {
+	// Output can change only when a counter that is audible in some channel expires; a channel
+	// is silent if its fixed volume is zero, and its tone and noise are audible only if enabled.
+	int advances = std::numeric_limits<int>::max();
+	bool noise_is_audible = false, envelope_is_audible = false;
+	for(int c = 0; c < 3; c++) {
+		const int volume = output_registers_[8 + c] & 0x1f;
+		if(!volume) continue;
+
+		if(!(output_registers_[7] & (1 << c))) advances = std::min(advances, tone_counters_[c]);
+		noise_is_audible |= !(output_registers_[7] & (8 << c));
+		envelope_is_audible |= volume & 0x10;
+	}
+
+	if(noise_is_audible) advances = std::min(advances, noise_counter_);
+	if(envelope_is_audible) advances = std::min(advances, envelope_divider_);
+	return advances;
+}
+
+template <bool is_stereo>
+void AY38910SampleSource<is_stereo>::skip_advances(int count) {
+	// Runs a counter that reloads with @c reload forward by @c count advances, returning the number of times it expired.
+	const auto step = [count](int &counter, int reload) {
+		if(count <= counter) {
+			counter -= count;
+			return 0;
+		}
+
+		const int remainder = count - counter - 1;
+		counter = reload - remainder % (reload + 1);
+		return 1 + remainder / (reload + 1);
+	};
+
+	for(int c = 0; c < 3; c++) {
+		tone_outputs_[c] ^= step(tone_counters_[c], tone_periods_[c] << 1) & 1;
+	}
+
+	for(int expiries = step(noise_counter_, noise_period_ << 1); expiries; --expiries) {
+		noise_output_ ^= noise_shift_register_&1;
+		noise_shift_register_ |= ((noise_shift_register_ ^ (noise_shift_register_ >> 3))&1) << 17;
+		noise_shift_register_ >>= 1;
+	}
+
+	// Envelopes either repeat every 64 steps or else hold at position 63.
+	if(const int expiries = step(envelope_divider_, envelope_period_ << 1)) {
+		envelope_position_ =
+			envelope_overflow_masks_[output_registers_[13]] ?
+				std::min(envelope_position_ + expiries, 63) :
+				(envelope_position_ + expiries) & 63;
+	}
+
+	evaluate_output_volume();
+}
+
 template <bool is_stereo>
 typename Outputs::Speaker::SampleT<is_stereo>::type AY38910SampleSource<is_stereo>::level() const {
 	return output_volume_;
@@ -115,6 +115,8 @@ template <bool stereo> class AY38910SampleSource {
 		// Sample generation.
 		typename Outputs::Speaker::SampleT<stereo>::type level() const;
 		void advance();
+		int advances_until_transition() const;
+		void skip_advances(int count);
 		bool is_zero_level() const;
 		void set_sample_volume_range(std::int16_t range);
 
@@ -185,6 +187,11 @@ template <bool stereo> struct AY38910:
 	// Use the same constructor as `AY38910SampleSource` (along with inheriting
 	// the rest of its interface).
 	using AY38910SampleSource<stereo>::AY38910SampleSource;
+
+	// Output is a function of level() alone, so SampleSource::apply_steps suffices; it
+	// can also skip periods in which no audible counter expires.
+	static constexpr bool has_band_limited_steps = true;
+	static constexpr bool can_skip_advances = true;
 };
 
 /*!
@@ -228,7 +235,14 @@ struct State: public Reflection::StructImpl<State> {
 		}
 	}
 
-	template <typename AY> void apply(AY &target) {
+	template <typename AY> State(const AY &source) : State() {
+		for(size_t c = 0; c < 16; c++) {
+			registers[c] = source.registers_[c];
+		}
+		selected_register = uint8_t(source.selected_register_);
+	}
+
+	template <typename AY> void apply(AY &target) const {
 		// Establish emulator-thread state
 		for(uint8_t c = 0; c < 16; c++) {
 			target.select_register(c);
@@ -8,7 +8,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+
+#include "../../Reflection/Struct.hpp"
 
 namespace Apple::Clock {
 
@@ -181,6 +185,7 @@ class ClockStorage {
 		};
 		Phase phase_ = Phase::Command;
 
+		friend struct State;
 };
 
 /*!
@@ -244,6 +249,66 @@ class SerialClock: public ClockStorage {
 		uint8_t result_ = 0;
 
 		bool previous_clock_ = false;
+
+		friend struct State;
+};
+
+/*!
+	Captures the complete state of a @c SerialClock: [P/B]RAM, time and any partially-completed command.
+*/
+struct State: public Reflection::StructImpl<State> {
+	uint8_t data[256]{};
+	uint8_t seconds[4]{};
+	uint8_t write_protect = 0;
+	unsigned int address = 0;
+	int command_phase = 0;
+
+	int serial_phase = 0;
+	uint16_t command = 0;
+	uint8_t result = 0;
+	bool previous_clock = false;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(data);
+			DeclareField(seconds);
+			DeclareField(write_protect);
+			DeclareField(address);
+			DeclareField(command_phase);
+			DeclareField(serial_phase);
+			DeclareField(command);
+			DeclareField(result);
+			DeclareField(previous_clock);
+		}
+	}
+
+	State(const SerialClock &source) : State() {
+		const ClockStorage &storage = source;
+		std::copy(storage.data_.begin(), storage.data_.end(), data);
+		std::copy(storage.seconds_.begin(), storage.seconds_.end(), seconds);
+		write_protect = storage.write_protect_;
+		address = storage.address_;
+		command_phase = int(storage.phase_);
+
+		serial_phase = source.phase_;
+		command = source.command_;
+		result = source.result_;
+		previous_clock = source.previous_clock_;
+	}
+
+	void apply(SerialClock &target) const {
+		ClockStorage &storage = target;
+		std::copy(std::begin(data), std::end(data), storage.data_.begin());
+		std::copy(std::begin(seconds), std::end(seconds), storage.seconds_.begin());
+		storage.write_protect_ = write_protect;
+		storage.address_ = address;
+		storage.phase_ = ClockStorage::Phase(command_phase);
+
+		target.phase_ = serial_phase;
+		target.command_ = command;
+		target.result_ = result;
+		target.previous_clock_ = previous_clock;
+	}
 };
 
 /*!
@@ -24,6 +24,13 @@ class Toggle: public Outputs::Speaker::BufferSource<Toggle, false> {
 		void apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
 			Outputs::Speaker::fill<action>(target, target + number_of_samples, level_);
 		}
+		static constexpr bool has_band_limited_steps = true;
+		template <typename TargetT>
+		void apply_steps(std::size_t, TargetT &target) {
+			target.add_transition(0, last_level_, level_);
+			last_level_ = level_;
+		}
+
 		void set_sample_volume_range(std::int16_t range);
 		bool is_zero_level() const {
 			return !level_;
@@ -39,6 +46,7 @@ class Toggle: public Outputs::Speaker::BufferSource<Toggle, false> {
 
 		// Accessed on the audio thread.
 		int16_t level_ = 0, volume_ = 0;
+		int16_t last_level_ = 0;
 		bool level_active_ = false;
 };
 
@@ -8,6 +8,8 @@
 
 #include "KonamiSCC.hpp"
 
+#include "../../Outputs/Speaker/Implementation/BandLimitedStepBuffer.hpp"
+
 #include <cstring>
 
 using namespace Konami;
@@ -55,6 +57,46 @@ template void SCC::apply_samples<Outputs::Speaker::Action::Mix>(std::size_t, Out
 template void SCC::apply_samples<Outputs::Speaker::Action::Store>(std::size_t, Outputs::Speaker::MonoSample *);
 template void SCC::apply_samples<Outputs::Speaker::Action::Ignore>(std::size_t, Outputs::Speaker::MonoSample *);
 
+template <typename TargetT>
+void SCC::apply_steps(std::size_t number_of_samples, TargetT &target) {
+	const auto post = [&](std::size_t offset, Outputs::Speaker::MonoSample level) {
+		target.add_transition(offset, last_level_, level);
+		last_level_ = level;
+	};
+
+	// Time advances exactly as per apply_samples, with output able to change only every eighth sample.
+	if(is_zero_level()) {
+		post(0, 0);
+		return;
+	}
+
+	post(0, transient_output_level_);
+	std::size_t c = 0;
+	while((master_divider_&7) && c < number_of_samples) {
+		master_divider_++;
+		c++;
+	}
+
+	while(c < number_of_samples) {
+		for(int channel = 0; channel < 5; ++channel) {
+			if(channels_[channel].tone_counter) channels_[channel].tone_counter--;
+			else {
+				channels_[channel].offset = (channels_[channel].offset + 1) & 0x1f;
+				channels_[channel].tone_counter = channels_[channel].period;
+			}
+		}
+
+		evaluate_output_volume();
+		post(c, transient_output_level_);
+
+		const auto length = std::min(number_of_samples - c, std::size_t(8));
+		c += length;
+		master_divider_ += int(length);
+	}
+}
+template void SCC::apply_steps(std::size_t, Outputs::Speaker::BandLimitedStepBuffer<false> &);
+template void SCC::apply_steps(std::size_t, Outputs::Speaker::BandLimitedStepBuffer<true> &);
+
 void SCC::write(uint16_t address, uint8_t value) {
 	address &= 0xff;
 	if(address < 0x80) ram_[address] = value;
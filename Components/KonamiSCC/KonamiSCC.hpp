@@ -33,6 +33,10 @@ class SCC: public ::Outputs::Speaker::BufferSource<SCC, false> {
 		void apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target);
 		void set_sample_volume_range(std::int16_t range);
 
+		static constexpr bool has_band_limited_steps = true;
+		template <typename TargetT>
+		void apply_steps(std::size_t number_of_samples, TargetT &target);
+
 		/// Writes to the SCC.
 		void write(uint16_t address, uint8_t value);
 
@@ -46,6 +50,7 @@ class SCC: public ::Outputs::Speaker::BufferSource<SCC, false> {
 		int master_divider_ = 0;
 		std::int16_t master_volume_ = 0;
 		Outputs::Speaker::MonoSample transient_output_level_ = 0;
+		Outputs::Speaker::MonoSample last_level_ = 0;
 
 		struct Channel {
 			int period = 0;
@@ -117,4 +117,99 @@ template <int precision> class PhaseGenerator {
 		int enable_vibrato_ = 0;
 };
 
+
+/*!
+	Models @c count OPL-style phase generators of templated precision as a structure of arrays, so that all can be
+	advanced together as vector lanes. Each generator behaves exactly as a @c PhaseGenerator<precision>.
+*/
+template <int precision, int count> class PhaseGeneratorBank {
+	public:
+		/*!
+			Advances all phase generators a single step, given the current state of the low-frequency oscillator, @c oscillator.
+		*/
+		void update(const LowFrequencyOscillator &oscillator) {
+			constexpr int vibrato_shifts[4] = {3, 1, 0, 1};
+			constexpr int vibrato_signs[2] = {1, -1};
+
+			// The oscillator's contribution is common to all lanes.
+			const int vibrato_shift = vibrato_shifts[oscillator.vibrato & 3];
+			const int vibrato_sign = vibrato_signs[oscillator.vibrato >> 2];
+
+			for(int c = 0; c < count; c++) {
+				const int vibrato = ((period_[c] >> (precision - 3)) >> vibrato_shift) * vibrato_sign * enable_vibrato_[c];
+				phase_[c] += (multiple_[c] * ((period_[c] << 1) + vibrato) << octave_[c]) >> 1;
+			}
+		}
+
+		/*!
+			@returns Current phase of generator @c index; real hardware provides only the low ten bits of this result.
+		*/
+		int phase(int index) const {
+			return phase_[index] >> precision_shift;
+		}
+
+		/*!
+			@returns Current phase of generator @c index, scaled up by (1 << precision).
+		*/
+		int scaled_phase(int index) const {
+			return phase_[index] >> 1;
+		}
+
+		/*!
+			Applies feedback to generator @c index based on two historic samples of a total output level,
+			plus the degree of feedback to apply
+		*/
+		void apply_feedback(int index, LogSign first, LogSign second, int level) {
+			constexpr int masks[] = {0, ~0, ~0, ~0, ~0, ~0, ~0, ~0};
+			phase_[index] += ((second.level(precision) + first.level(precision)) >> (8 - level)) & masks[level];
+		}
+
+		/*!
+			Sets the multiple for generator @c index, in the same terms as an OPL programmer.
+		*/
+		void set_multiple(int index, int multiple) {
+			// As per PhaseGenerator::set_multiple.
+			constexpr int multipliers[] = {
+				1, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 20, 24, 24, 30, 30
+			};
+			assert(multiple < 16);
+			multiple_[index] = multipliers[multiple];
+		}
+
+		/*!
+			Sets the period and octave of generator @c index.
+		*/
+		void set_period(int index, int period, int octave) {
+			period_[index] = period;
+			octave_[index] = octave;
+
+			assert(octave < 8);
+			assert(period < (1 << precision));
+		}
+
+		/*!
+			Enables or disables vibrato for generator @c index.
+		*/
+		void set_vibrato_enabled(int index, bool enabled) {
+			enable_vibrato_[index] = int(enabled);
+		}
+
+		/*!
+			Resets the current phase of generator @c index.
+		*/
+		void reset(int index) {
+			phase_[index] = 0;
+		}
+
+	private:
+		static constexpr int precision_shift = 1 + precision;
+
+		int phase_[count]{};
+
+		int multiple_[count]{};
+		int period_[count]{};
+		int octave_[count]{};
+		int enable_vibrato_[count]{};
+};
+
 }
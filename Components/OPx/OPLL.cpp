@@ -8,6 +8,7 @@
 
 #include "OPLL.hpp"
 
+#include <algorithm>
 #include <cassert>
 
 using namespace Yamaha::OPL;
@@ -24,13 +25,13 @@ OPLL::OPLL(Concurrency::AsyncTaskQueue<false> &task_queue, int audio_divider, bo
 	rhythm_envelope_generators_[BassCarrier].set_should_damp([this] {
 		// Propagate attack mode to the modulator, and reset both phases.
 		rhythm_envelope_generators_[BassModulator].set_key_on(true);
-		phase_generators_[6 + 0].reset();
-		phase_generators_[6 + 9].reset();
+		phase_generators_.reset(6 + 0);
+		phase_generators_.reset(6 + 9);
 	});
 
 	// Set the other drums to damp, but only the TomTom to affect phase.
 	rhythm_envelope_generators_[TomTom].set_should_damp([this] {
-		phase_generators_[8 + 9].reset();
+		phase_generators_.reset(8 + 9);
 	});
 	rhythm_envelope_generators_[Snare].set_should_damp({});
 	rhythm_envelope_generators_[Cymbal].set_should_damp({});
@@ -58,8 +59,8 @@ OPLL::OPLL(Concurrency::AsyncTaskQueue<false> &task_queue, int audio_divider, bo
 		envelope_generators_[c].set_should_damp([this, c] {
 			// Propagate attack mode to the modulator, and reset both phases.
 			envelope_generators_[c + 9].set_key_on(true);
-			phase_generators_[c + 0].reset();
-			phase_generators_[c + 9].reset();
+			phase_generators_.reset(c + 0);
+			phase_generators_.reset(c + 9);
 		});
 	}
 
@@ -173,8 +174,8 @@ void OPLL::write_register(uint8_t address, uint8_t value) {
 }
 
 void OPLL::set_channel_period(int channel) {
-	phase_generators_[channel + 0].set_period(channels_[channel].period, channels_[channel].octave);
-	phase_generators_[channel + 9].set_period(channels_[channel].period, channels_[channel].octave);
+	phase_generators_.set_period(channel + 0, channels_[channel].period, channels_[channel].octave);
+	phase_generators_.set_period(channel + 9, channels_[channel].period, channels_[channel].octave);
 
 	envelope_generators_[channel + 0].set_period(channels_[channel].period, channels_[channel].octave);
 	envelope_generators_[channel + 9].set_period(channels_[channel].period, channels_[channel].octave);
@@ -199,11 +200,9 @@ const uint8_t *OPLL::instrument_definition(int instrument, int channel) {
 
 void OPLL::install_instrument(int channel) {
 	auto &carrier_envelope = envelope_generators_[channel + 0];
-	auto &carrier_phase = phase_generators_[channel + 0];
 	auto &carrier_scaler = key_level_scalers_[channel + 0];
 
 	auto &modulator_envelope = envelope_generators_[channel + 9];
-	auto &modulator_phase = phase_generators_[channel + 9];
 	auto &modulator_scaler = key_level_scalers_[channel + 9];
 
 	const uint8_t *const instrument = instrument_definition(channels_[channel].instrument, channel);
@@ -215,14 +214,14 @@ void OPLL::install_instrument(int channel) {
 	//	b5:		sustain-level enable;
 	//	b6:		vibrato enable;
 	//	b7:		tremolo enable.
-	modulator_phase.set_multiple(instrument[0] & 0xf);
+	phase_generators_.set_multiple(channel + 9, instrument[0] & 0xf);
 	channels_[channel].modulator_key_rate_scale_multiplier = (instrument[0] >> 4) & 1;
-	modulator_phase.set_vibrato_enabled(instrument[0] & 0x40);
+	phase_generators_.set_vibrato_enabled(channel + 9, instrument[0] & 0x40);
 	modulator_envelope.set_tremolo_enabled(instrument[0] & 0x80);
 
-	carrier_phase.set_multiple(instrument[1] & 0xf);
+	phase_generators_.set_multiple(channel + 0, instrument[1] & 0xf);
 	channels_[channel].carrier_key_rate_scale_multiplier = (instrument[1] >> 4) & 1;
-	carrier_phase.set_vibrato_enabled(instrument[1] & 0x40);
+	phase_generators_.set_vibrato_enabled(channel + 0, instrument[1] & 0x40);
 	carrier_envelope.set_tremolo_enabled(instrument[1] & 0x80);
 
 	// Pass off bit 5.
@@ -242,9 +241,9 @@ void OPLL::install_instrument(int channel) {
 	//	b4:		carrier waveform selection;
 	//	b5:		[unused]
 	//	b6–b7:	carrier key-scale level.
-	channels_[channel].modulator_feedback = instrument[3] & 7;
-	channels_[channel].modulator_waveform = Waveform((instrument[3] >> 3) & 1);
-	channels_[channel].carrier_waveform = Waveform((instrument[3] >> 4) & 1);
+	melodic_.modulator_feedback[channel] = instrument[3] & 7;
+	melodic_.modulator_waveform[channel] = Waveform((instrument[3] >> 3) & 1);
+	melodic_.carrier_waveform[channel] = Waveform((instrument[3] >> 4) & 1);
 	carrier_scaler.set_key_scaling_level(instrument[3] >> 6);
 
 	// Bytes 4 (modulator) and 5 (carrier):
@@ -286,13 +285,18 @@ void OPLL::apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSa
 	const int update_period = 72 / audio_divider_;
 	const int channel_output_period = 4 / audio_divider_;
 
-	// TODO: the conditional below is terrible. Fix.
-	while(number_of_samples--) {
+	// Output each channel's level for the whole of its time slot, updating all channels
+	// whenever a new set of slots begins.
+	while(number_of_samples) {
 		if(!audio_offset_) update_all_channels();
 
-		Outputs::Speaker::apply<action>(*target, output_levels_[audio_offset_ / channel_output_period]);
-		++target;
-		audio_offset_ = (audio_offset_ + 1) % update_period;
+		const int slot = audio_offset_ / channel_output_period;
+		const auto length = std::min(std::size_t((slot + 1) * channel_output_period - audio_offset_), number_of_samples);
+		Outputs::Speaker::fill<action>(target, target + length, output_levels_[slot]);
+
+		target += length;
+		number_of_samples -= length;
+		audio_offset_ = (audio_offset_ + int(length)) % update_period;
 	}
 }
 
@@ -304,9 +308,7 @@ void OPLL::update_all_channels() {
 	oscillator_.update();
 
 	// Update all phase generators. That's guaranteed.
-	for(int c = 0; c < 18; ++c) {
-		phase_generators_[c].update(oscillator_);
-	}
+	phase_generators_.update(oscillator_);
 
 	// Update the ADSR envelopes that are guaranteed to be melodic.
 	for(int c = 0; c < 6; ++c) {
@@ -323,13 +325,7 @@ void OPLL::update_all_channels() {
 		}
 
 		// Fill in the melodic channels.
-		output_levels_[3] = VOLUME(melodic_output(0));
-		output_levels_[4] = VOLUME(melodic_output(1));
-		output_levels_[5] = VOLUME(melodic_output(2));
-
-		output_levels_[9] = VOLUME(melodic_output(3));
-		output_levels_[10] = VOLUME(melodic_output(4));
-		output_levels_[11] = VOLUME(melodic_output(5));
+		update_melodic_channels<6>();
 
 		// Bass drum, which is a regular FM effect.
 		output_levels_[2] = output_levels_[15] = VOLUME(bass_drum());
@@ -365,17 +361,7 @@ void OPLL::update_all_channels() {
 		output_levels_[6] = output_levels_[7] = output_levels_[8] =
 		output_levels_[12] = output_levels_[13] = output_levels_[14] = 0;
 
-		output_levels_[3] = VOLUME(melodic_output(0));
-		output_levels_[4] = VOLUME(melodic_output(1));
-		output_levels_[5] = VOLUME(melodic_output(2));
-
-		output_levels_[9] = VOLUME(melodic_output(3));
-		output_levels_[10] = VOLUME(melodic_output(4));
-		output_levels_[11] = VOLUME(melodic_output(5));
-
-		output_levels_[15] = VOLUME(melodic_output(6));
-		output_levels_[16] = VOLUME(melodic_output(7));
-		output_levels_[17] = VOLUME(melodic_output(8));
+		update_melodic_channels<9>();
 	}
 
 #undef VOLUME
@@ -387,35 +373,55 @@ void OPLL::update_all_channels() {
 
 #define ATTENUATION(x)	((x) << 7)
 
-int OPLL::melodic_output(int channel) {
+template <int count> void OPLL::update_melodic_channels() {
+	// Collect attenuations from the envelope generators and key-level scalers, so that
+	// everything below is a straight run over arrays with one lane per channel.
+	int carrier_attenuation[count], modulator_attenuation[count];
+	for(int c = 0; c < count; ++c) {
+		carrier_attenuation[c] = envelope_generators_[c].attenuation() + ATTENUATION(channels_[c].attenuation) + key_level_scalers_[c].attenuation();
+		modulator_attenuation[c] = envelope_generators_[c + 9].attenuation() + (channels_[c].modulator_attenuation << 5) + key_level_scalers_[c + 9].attenuation();
+	}
+
 	// The modulator always updates after the carrier, oddly enough. So calculate actual output first, based on the modulator's last value.
-	auto carrier = WaveformGenerator<period_precision>::wave(channels_[channel].carrier_waveform, phase_generators_[channel].scaled_phase(), channels_[channel].modulator_output);
-	carrier += envelope_generators_[channel].attenuation() + ATTENUATION(channels_[channel].attenuation) + key_level_scalers_[channel].attenuation();
+	int levels[count];
+	for(int c = 0; c < count; ++c) {
+		const LogSign modulation{melodic_.modulator_log[c], melodic_.modulator_sign[c]};
+		auto carrier = WaveformGenerator<period_precision>::wave(melodic_.carrier_waveform[c], phase_generators_.scaled_phase(c), modulation);
+		carrier += carrier_attenuation[c];
+		levels[c] = carrier.level();
+	}
 
-	// Get the modulator's new value.
-	auto modulation = WaveformGenerator<period_precision>::wave(channels_[channel].modulator_waveform, phase_generators_[channel + 9].phase());
-	modulation += envelope_generators_[channel + 9].attenuation() + (channels_[channel].modulator_attenuation << 5) + key_level_scalers_[channel + 9].attenuation();
+	// Get the modulators' new values and apply feedback, if any.
+	for(int c = 0; c < count; ++c) {
+		auto modulation = WaveformGenerator<period_precision>::wave(melodic_.modulator_waveform[c], phase_generators_.phase(c + 9));
+		modulation += modulator_attenuation[c];
 
-	// Apply feedback, if any.
-	phase_generators_[channel + 9].apply_feedback(channels_[channel].modulator_output, modulation, channels_[channel].modulator_feedback);
-	channels_[channel].modulator_output = modulation;
+		const LogSign previous{melodic_.modulator_log[c], melodic_.modulator_sign[c]};
+		phase_generators_.apply_feedback(c + 9, previous, modulation, melodic_.modulator_feedback[c]);
+		melodic_.modulator_log[c] = modulation.log;
+		melodic_.modulator_sign[c] = modulation.sign;
+	}
 
-	return carrier.level();
+	// Channels are output in groups of three, interleaved with the rhythm slots.
+	const int volume = total_volume_;
+	for(int c = 0; c < count; ++c) {
+		output_levels_[3 + (c / 3) * 6 + (c % 3)] = int16_t((levels[c] * volume) >> 12);
+	}
 }
 
 int OPLL::bass_drum() {
 	// Use modulator 6 and carrier 6, attenuated as per the bass-specific envelope generators and the attenuation level for channel 6.
-	auto modulation = WaveformGenerator<period_precision>::wave(Waveform::Sine, phase_generators_[6 + 9].phase());
+	auto modulation = WaveformGenerator<period_precision>::wave(Waveform::Sine, phase_generators_.phase(6 + 9));
 	modulation += rhythm_envelope_generators_[RhythmIndices::BassModulator].attenuation();
 
-	auto carrier = WaveformGenerator<period_precision>::wave(Waveform::Sine, phase_generators_[6].scaled_phase(), modulation);
+	auto carrier = WaveformGenerator<period_precision>::wave(Waveform::Sine, phase_generators_.scaled_phase(6), modulation);
 	carrier += rhythm_envelope_generators_[RhythmIndices::BassCarrier].attenuation() + ATTENUATION(channels_[6].attenuation);
 	return carrier.level();
 }
 
 int OPLL::tom_tom() {
 	// Use modulator 8 and the 'instrument' selection for channel 8 as an attenuation.
-	auto tom_tom = WaveformGenerator<period_precision>::wave(Waveform::Sine, phase_generators_[8 + 9].phase());
+	auto tom_tom = WaveformGenerator<period_precision>::wave(Waveform::Sine, phase_generators_.phase(8 + 9));
 	tom_tom += rhythm_envelope_generators_[RhythmIndices::TomTom].attenuation();
 	tom_tom += ATTENUATION(channels_[8].instrument);
 	return tom_tom.level();
@@ -423,7 +429,7 @@ int OPLL::tom_tom() {
 
 int OPLL::snare_drum() {
 	// Use modulator 7 and the carrier attenuation level for channel 7.
-	LogSign snare = WaveformGenerator<period_precision>::snare(oscillator_, phase_generators_[7 + 9].phase());
+	LogSign snare = WaveformGenerator<period_precision>::snare(oscillator_, phase_generators_.phase(7 + 9));
 	snare += rhythm_envelope_generators_[RhythmIndices::Snare].attenuation();
 	snare += ATTENUATION(channels_[7].attenuation);
 	return snare.level();
@@ -431,7 +437,7 @@ int OPLL::snare_drum() {
 
 int OPLL::cymbal() {
 	// Use modulator 7, carrier 8 and the attenuation level for channel 8.
-	LogSign cymbal = WaveformGenerator<period_precision>::cymbal(phase_generators_[8].phase(), phase_generators_[7 + 9].phase());
+	LogSign cymbal = WaveformGenerator<period_precision>::cymbal(phase_generators_.phase(8), phase_generators_.phase(7 + 9));
 	cymbal += rhythm_envelope_generators_[RhythmIndices::Cymbal].attenuation();
 	cymbal += ATTENUATION(channels_[8].attenuation);
 	return cymbal.level();
@@ -439,7 +445,7 @@ int OPLL::cymbal() {
 
 int OPLL::high_hat() {
 	// Use modulator 7, carrier 8 a and the 'instrument' selection for channel 7 as an attenuation.
-	LogSign high_hat = WaveformGenerator<period_precision>::high_hat(oscillator_, phase_generators_[8].phase(), phase_generators_[7 + 9].phase());
+	LogSign high_hat = WaveformGenerator<period_precision>::high_hat(oscillator_, phase_generators_.phase(8), phase_generators_.phase(7 + 9));
 	high_hat += rhythm_envelope_generators_[RhythmIndices::HighHat].attenuation();
 	high_hat += ATTENUATION(channels_[7].instrument);
 	return high_hat.level();
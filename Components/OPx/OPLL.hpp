@@ -45,10 +45,10 @@ class OPLL: public OPLBase<OPLL, false> {
 		int audio_offset_ = 0;
 		std::atomic<int> total_volume_;
 
-		int16_t output_levels_[18];
+		int16_t output_levels_[18]{};
 		void update_all_channels();
 
-		int melodic_output(int channel);
+		template <int count> void update_melodic_channels();
 		int bass_drum();
 		int tom_tom();
 		int snare_drum();
@@ -65,7 +65,7 @@ class OPLL: public OPLBase<OPLL, false> {
 		//		[x], 0 <= x < 9		= carrier for channel x;
 		//		[x+9]				= modulator for channel x.
 		//
-		PhaseGenerator<period_precision> phase_generators_[18];
+		PhaseGeneratorBank<period_precision, 18> phase_generators_;
 		EnvelopeGenerator<envelope_precision, period_precision> envelope_generators_[18];
 		KeyLevelScaler<period_precision> key_level_scalers_[18];
 
@@ -89,18 +89,23 @@ class OPLL: public OPLBase<OPLL, false> {
 			int attenuation = 0;
 			int modulator_attenuation = 0;
 
-			Waveform carrier_waveform = Waveform::Sine;
-			Waveform modulator_waveform = Waveform::Sine;
-
 			int carrier_key_rate_scale_multiplier = 0;
 			int modulator_key_rate_scale_multiplier = 0;
 
-			LogSign modulator_output;
-			int modulator_feedback = 0;
-
 			bool use_sustain = false;
 		} channels_[9];
 
+		// Channel state that is used only by the melodic output lanes, held as
+		// a structure of arrays so that all channels can be computed together.
+		struct {
+			Waveform carrier_waveform[9]{};
+			Waveform modulator_waveform[9]{};
+
+			int modulator_log[9]{};
+			int modulator_sign[9]{};
+			int modulator_feedback[9]{};
+		} melodic_;
+
 		// The low-frequency oscillator.
 		LowFrequencyOscillator oscillator_;
 		bool rhythm_mode_enabled_ = false;
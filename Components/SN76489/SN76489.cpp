@@ -99,57 +99,61 @@ void SN76489::evaluate_output_volume() {
 	);
 }
 
-template <Outputs::Speaker::Action action>
-void SN76489::apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
-	std::size_t c = 0;
-	while((master_divider_& (master_divider_period_ - 1)) && c < number_of_samples) {
-		Outputs::Speaker::apply<action>(target[c], output_volume_);
-		master_divider_++;
-		c++;
-	}
-
-	while(c < number_of_samples) {
-		bool did_flip = false;
+void SN76489::advance_period() {
+	bool did_flip = false;
 
 #define step_channel(x, s) \
-		if(channels_[x].counter) channels_[x].counter--;\
-		else {\
-			channels_[x].level ^= 1;\
-			channels_[x].counter = channels_[x].divider;\
-			s;\
-		}
+	if(channels_[x].counter) channels_[x].counter--;\
+	else {\
+		channels_[x].level ^= 1;\
+		channels_[x].counter = channels_[x].divider;\
+		s;\
+	}
 
-		step_channel(0, /**/);
-		step_channel(1, /**/);
-		step_channel(2, did_flip = true);
+	step_channel(0, /**/);
+	step_channel(1, /**/);
+	step_channel(2, did_flip = true);
 
 #undef step_channel
 
-		if(channels_[3].divider != 0xffff) {
-			if(channels_[3].counter) channels_[3].counter--;
-			else {
-				did_flip = true;
-				channels_[3].counter = channels_[3].divider;
-			}
+	if(channels_[3].divider != 0xffff) {
+		if(channels_[3].counter) channels_[3].counter--;
+		else {
+			did_flip = true;
+			channels_[3].counter = channels_[3].divider;
 		}
+	}
 
-		if(did_flip) {
-			channels_[3].level = noise_shifter_ & 1;
-			int new_bit = channels_[3].level;
-			switch(noise_mode_) {
-				default: break;
-				case Noise15:
-					new_bit ^= (noise_shifter_ >> 1);
-				break;
-				case Noise16:
-					new_bit ^= (noise_shifter_ >> 3);
-				break;
-			}
-			noise_shifter_ >>= 1;
-			noise_shifter_ |= (new_bit & 1) << (shifter_is_16bit_ ? 15 : 14);
+	if(did_flip) {
+		channels_[3].level = noise_shifter_ & 1;
+		int new_bit = channels_[3].level;
+		switch(noise_mode_) {
+			default: break;
+			case Noise15:
+				new_bit ^= (noise_shifter_ >> 1);
+			break;
+			case Noise16:
+				new_bit ^= (noise_shifter_ >> 3);
+			break;
 		}
+		noise_shifter_ >>= 1;
+		noise_shifter_ |= (new_bit & 1) << (shifter_is_16bit_ ? 15 : 14);
+	}
+
+	evaluate_output_volume();
+}
+
+template <Outputs::Speaker::Action action>
+void SN76489::apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
+	std::size_t c = 0;
+	while((master_divider_& (master_divider_period_ - 1)) && c < number_of_samples) {
+		Outputs::Speaker::apply<action>(target[c], output_volume_);
+		master_divider_++;
+		c++;
+	}
 
-		evaluate_output_volume();
+	while(c < number_of_samples) {
+		advance_period();
 
 		for(int ic = 0; ic < master_divider_period_ && c < number_of_samples; ++ic) {
 			Outputs::Speaker::apply<action>(target[c], output_volume_);
@@ -33,11 +33,67 @@ class SN76489: public Outputs::Speaker::BufferSource<SN76489, false> {
 		bool is_zero_level() const;
 		void set_sample_volume_range(std::int16_t range);
 
+		static constexpr bool has_band_limited_steps = true;
+		template <typename TargetT>
+		void apply_steps(std::size_t number_of_samples, TargetT &target) {
+			const auto post = [&](std::size_t offset) {
+				target.add_transition(offset, last_level_, output_volume_);
+				last_level_ = output_volume_;
+			};
+
+			// Complete any partial period, then proceed a period at a time exactly as per apply_samples.
+			post(0);
+			std::size_t c = 0;
+			if(master_divider_) {
+				c = std::min(number_of_samples, std::size_t(master_divider_period_ - master_divider_));
+				master_divider_ += int(c);
+			}
+
+			while(c < number_of_samples) {
+				// Skip directly over whole periods in which no counter will expire, as output
+				// can't change during them.
+				const auto skip = std::min(
+					std::size_t(periods_until_transition()),
+					(number_of_samples - c) / std::size_t(master_divider_period_)
+				);
+				if(skip) {
+					for(int channel = 0; channel < 3; channel++) {
+						channels_[channel].counter -= uint16_t(skip);
+					}
+					if(channels_[3].divider != 0xffff) {
+						channels_[3].counter -= uint16_t(skip);
+					}
+					c += skip * std::size_t(master_divider_period_);
+					continue;
+				}
+
+				advance_period();
+				post(c);
+
+				const auto length = std::min(number_of_samples - c, std::size_t(master_divider_period_));
+				c += length;
+				master_divider_ += int(length);
+			}
+
+			master_divider_ &= (master_divider_period_ - 1);
+		}
+
 	private:
 		int master_divider_ = 0;
 		int master_divider_period_ = 16;
 		int16_t output_volume_ = 0;
+		int16_t last_level_ = 0;
 		void evaluate_output_volume();
+		void advance_period();
+
+		/// @returns The number of calls to @c advance_period that will occur before any channel changes level.
+		int periods_until_transition() const {
+			int periods = std::min({channels_[0].counter, channels_[1].counter, channels_[2].counter});
+			if(channels_[3].divider != 0xffff) {
+				periods = std::min(periods, int(channels_[3].counter));
+			}
+			return periods;
+		}
 		int volumes_[16];
 
 		Concurrency::AsyncTaskQueue<false> &task_queue_;
@@ -8,10 +8,17 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <cassert>
 #include <condition_variable>
+#include <cstddef>
 #include <functional>
+#include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "../ClockReceiver/TimeTypes.hpp"
@@ -45,6 +52,196 @@ template <> struct TaskQueueStorage<void> {
 		void update() {}
 };
 
+/// An implementation detail; a type-erased @c void(void) callable that is stored inline rather than on the heap.
+class InlineAction {
+	public:
+		static constexpr size_t Capacity = 48;
+
+		/// Stores @c action. There must be nothing currently stored.
+		template <typename FuncT> void set(FuncT &&action) {
+			using ActionT = std::decay_t<FuncT>;
+			static_assert(sizeof(ActionT) <= Capacity, "Action captures too much state to be stored inline");
+			static_assert(alignof(ActionT) <= alignof(std::max_align_t), "Action is over-aligned");
+
+			new (storage_) ActionT(std::forward<FuncT>(action));
+			dispatch_ = [](std::byte *storage, bool perform) {
+				auto &action = *std::launder(reinterpret_cast<ActionT *>(storage));
+				if(perform) action();
+				action.~ActionT();
+			};
+		}
+
+		/// Performs and then destroys the stored action.
+		void perform() {
+			dispatch_(storage_, true);
+		}
+
+		/// Destroys the stored action without performing it.
+		void discard() {
+			dispatch_(storage_, false);
+		}
+
+	private:
+		alignas(std::max_align_t) std::byte storage_[Capacity];
+		void (*dispatch_)(std::byte *, bool) = nullptr;
+};
+
+/// An implementation detail; holds actions in a vector guarded by a mutex. Any number of threads may enqueue.
+template <bool perform_automatically> class LockingActionQueue {
+	public:
+		template <typename FuncT> void enqueue(FuncT &&action) {
+			std::lock_guard guard(condition_mutex_);
+			actions_.emplace_back(std::forward<FuncT>(action));
+
+			if constexpr (perform_automatically) {
+				condition_.notify_all();
+			}
+		}
+
+		void schedule() {
+			if(actions_.empty()) {
+				return;
+			}
+			condition_.notify_all();
+		}
+
+		/// Waits for scheduled actions, calls @c update and then performs them.
+		/// @returns @c false if the queue should stop.
+		template <typename UpdateT> bool perform_batch(const std::atomic<bool> &should_quit, const UpdateT &update) {
+			// Wait for new actions to be signalled, and grab them.
+			std::unique_lock lock(condition_mutex_);
+			while(actions_.empty() && !should_quit) {
+				condition_.wait(lock);
+			}
+			std::swap(performing_, actions_);
+			lock.unlock();
+
+			update();
+
+			// Perform the actions and destroy them.
+			for(const auto &action: performing_) {
+				action();
+			}
+			performing_.clear();
+			return !should_quit;
+		}
+
+	private:
+		// The list of actions waiting be performed. These will be elided,
+		// increasing their latency, if the emulation thread falls behind.
+		using ActionVector = std::vector<std::function<void(void)>>;
+		ActionVector actions_, performing_;
+
+		std::mutex condition_mutex_;
+		std::condition_variable condition_;
+};
+
+/*!
+	An implementation detail; holds actions in a fixed-size ring, as InlineActions, for a single producer and a single consumer.
+
+	Enqueueing takes no lock and allocates nothing. The consumer is signalled only if it has gone to sleep, and otherwise
+	picks up newly-scheduled actions by polling between batches. If the ring fills, the producer schedules everything it
+	has enqueued and yields until space becomes available.
+*/
+template <bool perform_automatically> class LockFreeActionQueue {
+	public:
+		~LockFreeActionQueue() {
+			// Dispose of anything that was never performed.
+			for(size_t index = consumed_.load(std::memory_order_relaxed); index != written_; ++index) {
+				actions_[index & Mask].discard();
+			}
+		}
+
+		template <typename FuncT> void enqueue(FuncT &&action) {
+#ifndef NDEBUG
+			// Catch any attempt to enqueue from two threads at once.
+			assert(!is_enqueuing_.exchange(true));
+#endif
+
+			if(written_ - consumed_.load(std::memory_order_acquire) == actions_.size()) {
+				schedule();
+				while(written_ - consumed_.load(std::memory_order_acquire) == actions_.size()) {
+					std::this_thread::yield();
+				}
+			}
+
+			actions_[written_ & Mask].set(std::forward<FuncT>(action));
+			++written_;
+
+			if constexpr (perform_automatically) {
+				schedule();
+			}
+
+#ifndef NDEBUG
+			is_enqueuing_.store(false);
+#endif
+		}
+
+		void schedule() {
+			if(published_.load(std::memory_order_relaxed) == written_) {
+				return;
+			}
+
+			// Sequential consistency between this store and the load of is_waiting_ below,
+			// and between the consumer's store to is_waiting_ and its subsequent load of
+			// published_, guarantees that at least one party sees the other.
+			published_.store(written_);
+			if(is_waiting_.load()) {
+				std::lock_guard guard(condition_mutex_);
+				condition_.notify_one();
+			}
+		}
+
+		/// Waits for scheduled actions, calls @c update and then performs them.
+		/// @returns @c false if the queue should stop.
+		template <typename UpdateT> bool perform_batch(const std::atomic<bool> &should_quit, const UpdateT &update) {
+			size_t consumed = consumed_.load(std::memory_order_relaxed);
+			size_t published = published_.load(std::memory_order_acquire);
+
+			if(published == consumed) {
+				if(should_quit) {
+					return false;
+				}
+
+				std::unique_lock lock(condition_mutex_);
+				is_waiting_.store(true);
+				condition_.wait(lock, [&] {
+					return published_.load() != consumed;
+				});
+				is_waiting_.store(false, std::memory_order_relaxed);
+				return true;
+			}
+
+			update();
+
+			while(consumed != published) {
+				actions_[consumed & Mask].perform();
+				++consumed;
+				consumed_.store(consumed, std::memory_order_release);
+			}
+			return true;
+		}
+
+	private:
+		static constexpr size_t Size = 1024;
+		static constexpr size_t Mask = Size - 1;
+		std::array<InlineAction, Size> actions_;
+
+		// Producer state.
+		alignas(64) size_t written_ = 0;
+		std::atomic<size_t> published_ = 0;
+#ifndef NDEBUG
+		std::atomic<bool> is_enqueuing_ = false;
+#endif
+
+		// Consumer state.
+		alignas(64) std::atomic<size_t> consumed_ = 0;
+		std::atomic<bool> is_waiting_ = false;
+
+		std::mutex condition_mutex_;
+		std::condition_variable condition_;
+};
+
 /*!
 	A task queue allows a caller to enqueue @c void(void) functions. Those functions are guaranteed
 	to be performed serially and asynchronously from the caller.
@@ -60,11 +257,22 @@ template <> struct TaskQueueStorage<void> {
 	form @c .perform(nanos) before every batch of new actions, indicating how much time has
 	passed since the previous @c perform.
 
+	If @c single_producer is true then actions are held in a lock-free ring and stored without heap
+	allocation, so must capture no more than InlineAction::Capacity bytes. Calls to @c enqueue, @c perform,
+	@c flush and @c stop must then never overlap, though they need not all come from the same thread.
+	Debug builds assert if two enqueues overlap. It is opt-in; each queue that sets it should say why
+	its producers cannot overlap.
+
 	@note Even if @c perform_automatically is true, actions may be batched, when a long-running
 	action occupies the asynchronous thread for long enough. So it is not true that @c perform will be
 	called once per action.
 */
-template <bool perform_automatically, bool start_immediately = true, typename Performer = void> class AsyncTaskQueue: public TaskQueueStorage<Performer> {
+template <
+	bool perform_automatically,
+	bool start_immediately = true,
+	typename Performer = void,
+	bool single_producer = false
+> class AsyncTaskQueue: public TaskQueueStorage<Performer> {
 	public:
 		template <typename... Args> AsyncTaskQueue(Args&&... args) :
 			TaskQueueStorage<Performer>(std::forward<Args>(args)...) {
@@ -83,21 +291,13 @@ template <bool perform_automatically, bool start_immediately = true, typename Pe
 		/// If this TaskQueue has a @c Performer then the action will be performed
 		/// on the same thread as the performer, after the performer has been updated
 		/// to 'now'.
-		void enqueue(const std::function<void(void)> &post_action) {
-			std::lock_guard guard(condition_mutex_);
-			actions_.push_back(post_action);
-
-			if constexpr (perform_automatically) {
-				condition_.notify_all();
-			}
+		template <typename FuncT> void enqueue(FuncT &&post_action) {
+			actions_.enqueue(std::forward<FuncT>(post_action));
 		}
 
 		/// Causes any enqueued actions that are not yet scheduled to be scheduled.
 		void perform() {
-			if(actions_.empty()) {
-				return;
-			}
-			condition_.notify_all();
+			actions_.schedule();
 		}
 
 		/// Permanently stops this task queue, blocking until that has happened.
@@ -121,27 +321,13 @@ template <bool perform_automatically, bool start_immediately = true, typename Pe
 		void start() {
 			thread_ = std::thread{
 				[this] {
-					ActionVector actions;
-
-					// Continue until told to quit.
-					while(!should_quit_) {
-						// Wait for new actions to be signalled, and grab them.
-						std::unique_lock lock(condition_mutex_);
-						while(actions_.empty() && !should_quit_) {
-							condition_.wait(lock);
-						}
-						std::swap(actions, actions_);
-						lock.unlock();
-
-						// Update to now (which is possibly a no-op).
-						TaskQueueStorage<Performer>::update();
-
-						// Perform the actions and destroy them.
-						for(const auto &action: actions) {
-							action();
-						}
-						actions.clear();
-					}
+					// Continue until told to quit; update to now (which is possibly a no-op)
+					// before each batch of actions.
+					while(
+						actions_.perform_batch(should_quit_, [this] {
+							TaskQueueStorage<Performer>::update();
+						})
+					);
 				}
 			};
 		}
@@ -172,19 +358,19 @@ template <bool perform_automatically, bool start_immediately = true, typename Pe
 		}
 
 	private:
-		// The list of actions waiting be performed. These will be elided,
-		// increasing their latency, if the emulation thread falls behind.
-		using ActionVector = std::vector<std::function<void(void)>>;
-		ActionVector actions_;
-
-		// Necessary synchronisation parts.
+		std::conditional_t<
+			single_producer,
+			LockFreeActionQueue<perform_automatically>,
+			LockingActionQueue<perform_automatically>
+		> actions_;
 		std::atomic<bool> should_quit_ = false;
-		std::mutex condition_mutex_;
-		std::condition_variable condition_;
 
-		// Ensure the thread isn't constructed until after the mutex
-		// and condition variable.
+		// Ensure the thread isn't constructed until after the action queue.
 		std::thread thread_;
 };
 
+/// A queue that is not performed automatically and that has opted in to the lock-free single-producer storage
+/// described above; it suits audio queues that are fed only by a machine's emulation.
+using SingleProducerTaskQueue = AsyncTaskQueue<false, true, void, true>;
+
 }
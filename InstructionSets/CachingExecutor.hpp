@@ -10,13 +10,12 @@
 
 #include "../Numeric/Sizes.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <limits>
-#include <list>
-#include <map>
-#include <queue>
 #include <unordered_map>
+#include <vector>
 
 namespace InstructionSet {
 
@@ -28,6 +27,10 @@ namespace InstructionSet {
 	costs sit behind using the C ABI for calling. Since there'll always be exactly one parameter, being the specific executor,
 	hopefully the calling costs are acceptable.
 
+	Decoded performer sequences are cached per page and per entry point, so that code is decoded only upon first
+	execution from a given address. A sequence runs until a terminating instruction or until the end of its page;
+	the specific executor is responsible for calling @c invalidate upon any write that might modify code.
+
 	Intended usage is for specific executors to subclass from this and declare it a friend.
 
 	TODO: determine promises re: interruption, amongst other things.
@@ -53,13 +56,13 @@ template <
 
 		void announce_overflow(ProgramCounterType) {
 			/*
-				Should be impossible for now; this is intended to provide information
-				when page caching.
+				Parsing is bounded by page; the instruction that overflowed will be
+				looked up afresh if and when execution reaches it.
 			*/
 		}
 		void announce_instruction(ProgramCounterType, InstructionType instruction) {
 			// Dutifully map the instruction to a performer and keep it.
-			program_.push_back(static_cast<Executor *>(this)->action_for(instruction));
+			parse_target_->push_back(static_cast<Executor *>(this)->action_for(instruction));
 
 			if constexpr (retain_instructions) {
 				// TODO.
@@ -75,27 +78,38 @@ template <
 		ProgramCounterType program_counter_;
 
 		/*!
-			Moves the current point of execution to @c address, updating necessary performer caches
-			and doing any translation as is necessary.
+			Moves the current point of execution to @c address. The relevant performer sequence
+			is located — or, if necessary, parsed — once the current performer has completed,
+			so performers are free to make further adjustments to the program counter.
 		*/
 		void set_program_counter(ProgramCounterType address) {
 			// Set flag to terminate any inner loop currently running through
 			// previously-parsed content.
 			has_branched_ = true;
 			program_counter_ = address;
+			program_ = nullptr;
+		}
 
-			// Temporary implementation: just interpret.
-			program_.clear();
-			program_index_ = 0;
-			static_cast<Executor *>(this)->parse(address, ProgramCounterType(max_address));
-
-//			const auto page = find_page(address);
-//			const auto entry = page->entry_points.find(address);
-//			if(entry == page->entry_points.end()) {
-//				// Requested segment wasn't found; check whether it was
-//				// within the recently translated list and otherwise
-//				// translate it.
-//			}
+		/*!
+			Indicates that memory at @c address has been modified; discards any cached performers
+			that might have been decoded from it.
+		*/
+		void invalidate(ProgramCounterType address) {
+			const auto page = size_t(address >> page_shift);
+			invalidate_page(page);
+
+			if(page && pages_[page - 1].spans_next_page) {
+				invalidate_page(page - 1);
+			}
+		}
+
+		/*!
+			Discards all cached performers, e.g. because a new ROM has been installed.
+		*/
+		void invalidate_all() {
+			for(size_t page = 0; page < pages_.size(); ++page) {
+				invalidate_page(page);
+			}
 		}
 
 		/*!
@@ -110,10 +124,16 @@ template <
 		*/
 		void run_to_branch() {
 			has_branched_ = false;
-			for(auto index: program_) {
-				const auto performer = performers_[index];
-				(static_cast<Executor *>(this)->*performer)();
-				if(has_branched_) break;
+			Executor *const executor = static_cast<Executor *>(this);
+			while(!has_branched_) {
+				if(!program_ || program_index_ == program_->size()) {
+					find_program();
+					if(program_->empty()) return;
+				}
+
+				const auto performer = performers_[(*program_)[program_index_]];
+				++program_index_;
+				(executor->*performer)();
 			}
 		}
 
@@ -125,11 +145,25 @@ template <
 		void run_for(int duration) {
 			remaining_duration_ += duration;
 
+			Executor *const executor = static_cast<Executor *>(this);
 			while(remaining_duration_ > 0) {
+				// Locate the performers for the current program counter if the most recent
+				// sequence was branched away from, discarded or ran to completion.
+				if(!program_ || program_index_ == program_->size()) {
+					find_program();
+
+					// If nothing can be decoded here then there's nothing to execute.
+					if(program_->empty()) {
+						remaining_duration_ = 0;
+						return;
+					}
+				}
+
 				has_branched_ = false;
-				Executor *const executor = static_cast<Executor *>(this);
-				while(remaining_duration_ > 0 && !has_branched_) {
-					const auto performer = performers_[program_[program_index_]];
+				const PerformerIndex *const program = program_->data();
+				const size_t program_size = program_->size();
+				while(remaining_duration_ > 0 && !has_branched_ && program_index_ < program_size) {
+					const auto performer = performers_[program[program_index_]];
 					++program_index_;
 
 					(executor->*performer)();
@@ -148,50 +182,76 @@ template <
 	private:
 		bool has_branched_ = false;
 		int remaining_duration_ = 0;
-		std::vector<PerformerIndex> program_;
+
+		// The sequence currently being executed, and the page that it was entered from.
+		const std::vector<PerformerIndex> *program_ = nullptr;
 		size_t program_index_ = 0;
+		size_t program_page_ = 0;
 
-		/* TODO: almost below here can be shoved off into an LRUCache object, or similar. */
+		// The sequence currently being populated by the parser.
+		std::vector<PerformerIndex> *parse_target_ = nullptr;
 
-//		static constexpr size_t max_cached_pages = 64;
+		// TODO: are 1kb pages always appropriate?
+		static constexpr int page_shift = 10;
+		static constexpr uint64_t page_count = (max_address >> page_shift) + 1;
 
-//		struct Page {
-//			std::map<ProgramCounterType, PerformerIndex> entry_points;
+		struct Page {
+			/// Maps from entry points to the performers that follow them.
+			std::unordered_map<ProgramCounterType, std::vector<PerformerIndex>> entry_points;
 
-			// TODO: can I statically these two? Should I?
-//			std::vector<PerformerIndex> actions_;
-//			std::vector<typename std::enable_if<!std::is_same<InstructionType, void>::value, InstructionType>::type> instructions_;
-//		};
-//		std::array<Page, max_cached_pages> pages_;
+			/// Indicates that at least one sequence in @c entry_points was parsed from memory within the following page.
+			bool spans_next_page = false;
+		};
+		std::vector<Page> pages_ = std::vector<Page>(page_count);
 
-		// Maps from page numbers to pages.
-//		std::unordered_map<ProgramCounterType, Page *> cached_pages_;
+		void invalidate_page(size_t page) {
+			auto &target = pages_[page];
+			if(target.entry_points.empty()) {
+				return;
+			}
 
-		// Maintains an LRU of recently-used pages in case of a need for reuse.
-//		std::list<ProgramCounterType> touched_pages_;
+			// If the sequence currently in use is about to be discarded, ensure that it is
+			// not resumed; a fresh lookup will occur once the current performer completes.
+			if(program_ && program_page_ == page) {
+				program_ = nullptr;
+				has_branched_ = true;
+			}
+
+			target.entry_points.clear();
+			target.spans_next_page = false;
+		}
 
 		/*!
-			Finds or creates the page that contains @c address.
+			Finds or creates the performers that start at the current program counter.
 		*/
-/*		Page *find_page(ProgramCounterType address) {
-			// TODO: are 1kb pages always appropriate? Is 64 the correct amount to keep?
-			const auto page_address = ProgramCounterType(address >> 10);
-
-			auto page = cached_pages_.find(page_address);
-			if(page == cached_pages_.end()) {
-				// Page wasn't found; either allocate a new one or
-				// reuse one that already exists.
-				if(cached_pages_.size() == max_cached_pages) {
-
-				} else {
-
+		void find_program() {
+			Executor *const executor = static_cast<Executor *>(this);
+			const auto page_index = size_t(program_counter_ >> page_shift);
+			auto &page = pages_[page_index];
+
+			auto entry = page.entry_points.find(program_counter_);
+			if(entry == page.entry_points.end()) {
+				entry = page.entry_points.emplace(program_counter_, std::vector<PerformerIndex>()).first;
+				parse_target_ = &entry->second;
+
+				// Parse no further than the end of this page.
+				const auto page_end = [](size_t index) {
+					return ProgramCounterType(std::min(max_address, (uint64_t(index) << page_shift) - 1));
+				};
+				executor->parse(program_counter_, page_end(page_index + 1));
+
+				// If the very first instruction straddles the end of the page then nothing will
+				// have been parsed; in that case continue into the next page.
+				if(entry->second.empty() && page_index + 1 < page_count) {
+					page.spans_next_page = true;
+					executor->parse(program_counter_, page_end(page_index + 2));
 				}
-			} else {
-				// Page was found; LRU shuffle it.
 			}
 
-			return nullptr;
-		}*/
+			program_ = &entry->second;
+			program_index_ = 0;
+			program_page_ = page_index;
+		}
 };
 
 }
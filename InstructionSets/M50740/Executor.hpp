@@ -63,7 +63,7 @@ class Executor: public CachingExecutor {
 		}
 
 		/*!
-			Parses from @c start and no later than @c max_address, using the CachingExecutor as a target.
+			Parses from @c start and no later than @c closing_bound, using the CachingExecutor as a target.
 		*/
 		inline void parse(uint16_t start, uint16_t closing_bound) {
 			Parser<Executor, false> parser;
@@ -151,6 +151,7 @@ class ConcreteMachine:
 		void did_set_status() {
 			// This might have been a change of mode, so...
 			trans_ = executor_.registers().mode() == InstructionSet::ARM::Mode::User;
+			fetch_page_ = NoFetchPage;
 			fill_pipeline(executor_.pc());
 			update_interrupts();
 		}
@@ -555,9 +556,33 @@ class ConcreteMachine:
 			advance_pipeline(pc + 4);
 		}
 
+		// Instruction fetches are made directly from the most-recently used 4kb block of code
+		// for as long as the memory map is unchanged, bypassing the MEMC's zone and page lookups.
+		static constexpr uint32_t NoFetchPage = ~static_cast<uint32_t>(0);
+		uint32_t fetch_page_ = NoFetchPage;
+		uint32_t fetch_generation_ = 0;
+		const uint32_t *fetch_base_ = nullptr;
+
+		bool fetch(uint32_t pc, uint32_t &instruction) {
+			const uint32_t page = (pc >> 12) & 0x3fff;
+			if(page != fetch_page_ || fetch_generation_ != executor_.bus.mapping_generation()) {
+				fetch_base_ = executor_.bus.fetch_pointer(pc, trans_);
+				if(!fetch_base_) {
+					fetch_page_ = NoFetchPage;
+					return executor_.bus.read(pc, instruction, trans_);
+				}
+
+				fetch_page_ = page;
+				fetch_generation_ = executor_.bus.mapping_generation();
+			}
+
+			instruction = fetch_base_[(pc & 0xfff) >> 2];
+			return true;
+		}
+
 		uint32_t advance_pipeline(uint32_t pc) {
 			uint32_t instruction = 0;	// Value should never be used; this avoids a spurious GCC warning.
-			const bool did_read = executor_.bus.read(pc, instruction, trans_);
+			const bool did_read = fetch(pc, instruction);
 			return pipeline_.exchange(
 				did_read ? instruction : Pipeline::SWI,
 				did_read ? Pipeline::SWISubversion::None : Pipeline::SWISubversion::DataAbort);
@@ -143,6 +143,7 @@ struct MemoryController {
 
 						logger.info().append("MEMC Control: %08x -> OS:%d sound:%d video:%d refresh:%d high:%d low:%d size:%d", address, os_mode_, sound_dma_enable_, video_dma_enable_, dynamic_ram_refresh_, high_rom_access_time_, low_rom_access_time_, page_size_);
 						map_dirty_ = true;
+						++mapping_generation_;
 					break;
 				}
 			} break;
@@ -163,6 +164,7 @@ struct MemoryController {
 //				printf("Translator write at %08x; replaces %08x\n", address, pages_[address & 0x7f]);
 				pages_[address & 0x7f] = address;
 				map_dirty_ = true;
+				++mapping_generation_;
 			break;
 		}
 
@@ -210,6 +212,36 @@ struct MemoryController {
 		return read(address, source, trans);
 	}
 
+	/// Provides a fast path for instruction fetches.
+	///
+	/// @returns A pointer to the 4kb block of RAM or ROM that contains @c address, which can be read from directly
+	/// for as long as @c mapping_generation() is unchanged, or @c nullptr if that area isn't plain memory; in that
+	/// case use @c read.
+	const uint32_t *fetch_pointer(uint32_t address, bool trans) {
+		address &= ~static_cast<uint32_t>(0xfff);
+		switch(read_zones_[(address >> 21) & 31]) {
+			case ReadZone::LogicallyMappedRAM: {
+				const auto item = logical_ram<uint32_t, true>(address, trans);
+				return item < reinterpret_cast<uint32_t *>(ram_.data()) ? nullptr : item;
+			}
+
+			case ReadZone::PhysicallyMappedRAM:
+				return trans ? nullptr : &physical_ram<uint32_t>(address);
+
+			case ReadZone::HighROM:
+				// Defer to read() until it has unmapped the ROM from address 0.
+				return read_zones_[0] == ReadZone::HighROM ? nullptr : &high_rom<uint32_t>(address);
+
+			default:
+				return nullptr;
+		}
+	}
+
+	/// @returns A count that changes whenever the logical memory map changes.
+	uint32_t mapping_generation() const {
+		return mapping_generation_;
+	}
+
 	//
 	// Expose various IOC-owned things.
 	//
@@ -368,6 +400,7 @@ struct MemoryController {
 		}
 
 		bool map_dirty_ = true;
+		uint32_t mapping_generation_ = 0;
 
 		/// @returns A pointer to somewhere in @c ram_ if RAM is mapped to this area, or a pointer to somewhere lower than @c ram_.data() otherwise.
 		template <typename IntT, bool is_read>
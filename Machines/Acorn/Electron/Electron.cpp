@@ -31,6 +31,7 @@
 #include "Keyboard.hpp"
 #include "Plus3.hpp"
 #include "SoundGenerator.hpp"
+#include "State.hpp"
 #include "Tape.hpp"
 #include "Video.hpp"
 
@@ -43,6 +44,7 @@ template <bool has_scsi_bus> class ConcreteMachine:
 	public MachineTypes::AudioProducer,
 	public MachineTypes::MediaTarget,
 	public MachineTypes::MappedKeyboardMachine,
+	public MachineTypes::StateProducer,
 	public Configurable::Device,
 	public CPU::MOS6502::BusHandler,
 	public Tape::Delegate,
@@ -334,6 +336,7 @@ template <bool has_scsi_bus> class ConcreteMachine:
 					case 0xfe06:
 						if(!isReadOperation(operation)) {
 							update_audio();
+							sound_divider_ = *value;
 							sound_generator_.set_divider(*value);
 							tape_.set_counter(*value);
 						}
@@ -588,6 +591,70 @@ template <bool has_scsi_bus> class ConcreteMachine:
 			return &keyboard_mapper_;
 		}
 
+		// MARK: - StateProducer.
+		std::unique_ptr<Reflection::Struct> get_state() final {
+			auto state = std::make_unique<State>();
+
+			state->m6502 = CPU::MOS6502::State(m6502_);
+			state->video = VideoOutput::State(video_);
+
+			state->ram.assign(std::begin(ram_), std::end(ram_));
+			for(int c = 0; c < 16; c++) {
+				if(rom_write_masks_[c]) {
+					state->ram.insert(state->ram.end(), std::begin(roms_[c]), std::end(roms_[c]));
+				}
+			}
+
+			state->active_rom = uint8_t(active_rom_);
+			state->keyboard_is_active = keyboard_is_active_;
+			state->basic_is_active = basic_is_active_;
+
+			state->interrupt_status = interrupt_status_;
+			state->interrupt_control = interrupt_control_;
+
+			state->sound_divider = sound_divider_;
+			state->speaker_is_enabled = speaker_is_enabled_;
+
+			return state;
+		}
+
+		bool set_state(const Reflection::Struct &state) final {
+			const auto electron_state = dynamic_cast<const State *>(&state);
+			if(!electron_state) return false;
+
+			electron_state->m6502.apply(m6502_);
+			electron_state->video.apply(video_);
+
+			auto source = electron_state->ram.begin();
+			const auto copy = [&](uint8_t *begin, uint8_t *end) {
+				const auto length = std::min(end - begin, electron_state->ram.end() - source);
+				std::copy(source, source + length, begin);
+				source += length;
+			};
+			copy(std::begin(ram_), std::end(ram_));
+			for(int c = 0; c < 16; c++) {
+				if(rom_write_masks_[c]) {
+					copy(std::begin(roms_[c]), std::end(roms_[c]));
+				}
+			}
+
+			active_rom_ = electron_state->active_rom & 0xf;
+			keyboard_is_active_ = electron_state->keyboard_is_active;
+			basic_is_active_ = electron_state->basic_is_active;
+
+			interrupt_status_ = electron_state->interrupt_status;
+			interrupt_control_ = electron_state->interrupt_control;
+			evaluate_interrupts();
+
+			update_audio();
+			sound_divider_ = electron_state->sound_divider;
+			speaker_is_enabled_ = electron_state->speaker_is_enabled;
+			sound_generator_.set_divider(sound_divider_);
+			sound_generator_.set_is_enabled(speaker_is_enabled_);
+
+			return true;
+		}
+
 		// MARK: - Configuration options.
 		std::unique_ptr<Reflection::Struct> get_options() final {
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
@@ -769,11 +836,14 @@ template <bool has_scsi_bus> class ConcreteMachine:
 		// Outputs
 		VideoOutput video_;
 
-		Concurrency::AsyncTaskQueue<false> audio_queue_;
+		// Single producer: the sound generator is updated only by ULA writes as the CPU runs, and
+		// by set_state, which the host never calls concurrently with run_for.
+		Concurrency::SingleProducerTaskQueue audio_queue_;
 		SoundGenerator sound_generator_;
 		Outputs::Speaker::PullLowpass<SoundGenerator> speaker_;
 
 		bool speaker_is_enabled_ = false;
+		uint8_t sound_divider_ = 0;
 
 		// MARK: - Caps Lock status and the activity observer.
 		const std::string caps_led = "CAPS";
@@ -15,7 +15,7 @@ namespace Electron {
 
 class SoundGenerator: public ::Outputs::Speaker::BufferSource<SoundGenerator, false> {
 	public:
-		SoundGenerator(Concurrency::AsyncTaskQueue<false> &audio_queue);
+		SoundGenerator(Concurrency::SingleProducerTaskQueue &audio_queue);
 
 		void set_divider(uint8_t divider);
 
@@ -29,7 +29,7 @@ class SoundGenerator: public ::Outputs::Speaker::BufferSource<SoundGenerator, fa
 		void set_sample_volume_range(std::int16_t range);
 
 	private:
-		Concurrency::AsyncTaskQueue<false> &audio_queue_;
+		Concurrency::SingleProducerTaskQueue &audio_queue_;
 		unsigned int counter_ = 0;
 		unsigned int divider_ = 0;
 		bool is_enabled_ = false;
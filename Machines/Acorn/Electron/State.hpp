@@ -0,0 +1,57 @@
+//
+//  State.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "../../../Reflection/Struct.hpp"
+#include "../../../Processors/6502/State/State.hpp"
+
+#include "Video.hpp"
+
+#include <vector>
+
+namespace Electron {
+
+struct State: public Reflection::StructImpl<State> {
+	CPU::MOS6502::State m6502;
+	VideoOutput::State video;
+
+	// The 32kb of main RAM, followed by the contents of any sideways RAM
+	// slots in ascending slot order.
+	std::vector<uint8_t> ram;
+
+	// ROM paging.
+	uint8_t active_rom = 0;
+	bool keyboard_is_active = false;
+	bool basic_is_active = false;
+
+	// Interrupt status and control, as per &FE00.
+	uint8_t interrupt_status = 0;
+	uint8_t interrupt_control = 0;
+
+	// Sound: the most recent value written to &FE06, and whether output is enabled.
+	uint8_t sound_divider = 0;
+	bool speaker_is_enabled = false;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(m6502);
+			DeclareField(video);
+			DeclareField(ram);
+			DeclareField(active_rom);
+			DeclareField(keyboard_is_active);
+			DeclareField(basic_is_active);
+			DeclareField(interrupt_status);
+			DeclareField(interrupt_control);
+			DeclareField(sound_divider);
+			DeclareField(speaker_is_enabled);
+		}
+	}
+};
+
+}
@@ -135,22 +135,7 @@ uint8_t VideoOutput::run_for(const Cycles cycles) {
 		}
 
 		if(stage != output_ || screen_pitch != screen_pitch_) {
-			switch(output_) {
-				case OutputStage::Sync:			crt_.output_sync(output_length_);					break;
-				case OutputStage::Blank:		crt_.output_blank(output_length_);					break;
-				case OutputStage::ColourBurst:	crt_.output_default_colour_burst(output_length_);	break;
-				case OutputStage::Pixels:
-					if(current_output_target_) {
-						crt_.output_data(
-							output_length_,
-							static_cast<size_t>(current_output_target_ - initial_output_target_)
-						);
-					} else {
-						crt_.output_data(output_length_);
-					}
-				break;
-			}
-			output_length_ = 0;
+			end_output_run();
 			output_ = stage;
 			screen_pitch_ = screen_pitch;
 
@@ -221,6 +206,25 @@ uint8_t VideoOutput::run_for(const Cycles cycles) {
 	return interrupts;
 }
 
+void VideoOutput::end_output_run() {
+	switch(output_) {
+		case OutputStage::Sync:			crt_.output_sync(output_length_);					break;
+		case OutputStage::Blank:		crt_.output_blank(output_length_);					break;
+		case OutputStage::ColourBurst:	crt_.output_default_colour_burst(output_length_);	break;
+		case OutputStage::Pixels:
+			if(current_output_target_) {
+				crt_.output_data(
+					output_length_,
+					static_cast<size_t>(current_output_target_ - initial_output_target_)
+				);
+			} else {
+				crt_.output_data(output_length_);
+			}
+		break;
+	}
+	output_length_ = 0;
+}
+
 // MARK: - Register hub
 
 void VideoOutput::write(int address, uint8_t value) {
@@ -236,60 +240,126 @@ void VideoOutput::write(int address, uint8_t value) {
 				((value << 9) & 0b0111'1110'0000'0000) |
 				(screen_base_ & 0b0000'0001'1100'0000);
 		break;
-		case 0x07: {
-			uint8_t mode = (value >> 3)&7;
-			mode_40_ = mode >= 4;
-			mode_text_ = mode == 3 || mode == 6;
-
-			switch(mode) {
-				case 0:
-				case 1:
-				case 2:		mode_base_ = 0x3000;	break;
-				case 3:		mode_base_ = 0x4000;	break;
-				case 6:		mode_base_ = 0x6000;	break;
-				default:	mode_base_ = 0x5800;	break;
-			}
-
-			switch(mode) {
-				default:	mode_bpp_ = Bpp::One;	break;
-				case 1:
-				case 5:		mode_bpp_ = Bpp::Two;	break;
-				case 2:		mode_bpp_ = Bpp::Four;	break;
-			}
-		} break;
+		case 0x07:
+			set_mode((value >> 3)&7);
+		break;
 		case 0x08: case 0x09: case 0x0a: case 0x0b:
-		case 0x0c: case 0x0d: case 0x0e: case 0x0f: {
+		case 0x0c: case 0x0d: case 0x0e: case 0x0f:
 			palette_[address - 8] = ~value;
+			update_palettes(address);
+		break;
+	}
+}
 
-			if(address <= 0x09) {
-				palette1bpp_[0] = palette_entry<1, 0, 1, 4, 0, 4>();
-				palette1bpp_[1] = palette_entry<1, 2, 0, 6, 0, 2>();
+void VideoOutput::set_mode(uint8_t mode) {
+	mode_ = mode;
+	mode_40_ = mode >= 4;
+	mode_text_ = mode == 3 || mode == 6;
+
+	switch(mode) {
+		case 0:
+		case 1:
+		case 2:		mode_base_ = 0x3000;	break;
+		case 3:		mode_base_ = 0x4000;	break;
+		case 6:		mode_base_ = 0x6000;	break;
+		default:	mode_base_ = 0x5800;	break;
+	}
 
-				palette2bpp_[0] = palette_entry<1, 0, 1, 4, 0, 4>();
-				palette2bpp_[1] = palette_entry<1, 1, 1, 5, 0, 5>();
-				palette2bpp_[2] = palette_entry<1, 2, 0, 2, 0, 6>();
-				palette2bpp_[3] = palette_entry<1, 3, 0, 3, 0, 7>();
-			}
+	switch(mode) {
+		default:	mode_bpp_ = Bpp::One;	break;
+		case 1:
+		case 5:		mode_bpp_ = Bpp::Two;	break;
+		case 2:		mode_bpp_ = Bpp::Four;	break;
+	}
+}
+
+void VideoOutput::update_palettes(int address) {
+	if(address <= 0x09) {
+		palette1bpp_[0] = palette_entry<1, 0, 1, 4, 0, 4>();
+		palette1bpp_[1] = palette_entry<1, 2, 0, 6, 0, 2>();
 
-			palette4bpp_[0] = palette_entry<1, 0, 1, 4, 0, 4>();
-			palette4bpp_[2] = palette_entry<1, 1, 1, 5, 0, 5>();
-			palette4bpp_[8] = palette_entry<1, 2, 0, 2, 0, 6>();
-			palette4bpp_[10] = palette_entry<1, 3, 0, 3, 0, 7>();
-
-			palette4bpp_[4] = palette_entry<3, 0, 3, 4, 2, 4>();
-			palette4bpp_[6] = palette_entry<3, 1, 3, 5, 2, 5>();
-			palette4bpp_[12] = palette_entry<3, 2, 2, 2, 2, 6>();
-			palette4bpp_[14] = palette_entry<3, 3, 2, 3, 2, 7>();
-
-			palette4bpp_[5] = palette_entry<5, 0, 5, 4, 4, 4>();
-			palette4bpp_[7] = palette_entry<5, 1, 5, 5, 4, 5>();
-			palette4bpp_[13] = palette_entry<5, 2, 4, 2, 4, 6>();
-			palette4bpp_[15] = palette_entry<5, 3, 4, 3, 4, 7>();
-
-			palette4bpp_[1] = palette_entry<7, 0, 7, 4, 6, 4>();
-			palette4bpp_[3] = palette_entry<7, 1, 7, 5, 6, 5>();
-			palette4bpp_[9] = palette_entry<7, 2, 6, 2, 6, 6>();
-			palette4bpp_[11] = palette_entry<7, 3, 6, 3, 6, 7>();
-		} break;
+		palette2bpp_[0] = palette_entry<1, 0, 1, 4, 0, 4>();
+		palette2bpp_[1] = palette_entry<1, 1, 1, 5, 0, 5>();
+		palette2bpp_[2] = palette_entry<1, 2, 0, 2, 0, 6>();
+		palette2bpp_[3] = palette_entry<1, 3, 0, 3, 0, 7>();
 	}
+
+	palette4bpp_[0] = palette_entry<1, 0, 1, 4, 0, 4>();
+	palette4bpp_[2] = palette_entry<1, 1, 1, 5, 0, 5>();
+	palette4bpp_[8] = palette_entry<1, 2, 0, 2, 0, 6>();
+	palette4bpp_[10] = palette_entry<1, 3, 0, 3, 0, 7>();
+
+	palette4bpp_[4] = palette_entry<3, 0, 3, 4, 2, 4>();
+	palette4bpp_[6] = palette_entry<3, 1, 3, 5, 2, 5>();
+	palette4bpp_[12] = palette_entry<3, 2, 2, 2, 2, 6>();
+	palette4bpp_[14] = palette_entry<3, 3, 2, 3, 2, 7>();
+
+	palette4bpp_[5] = palette_entry<5, 0, 5, 4, 4, 4>();
+	palette4bpp_[7] = palette_entry<5, 1, 5, 5, 4, 5>();
+	palette4bpp_[13] = palette_entry<5, 2, 4, 2, 4, 6>();
+	palette4bpp_[15] = palette_entry<5, 3, 4, 3, 4, 7>();
+
+	palette4bpp_[1] = palette_entry<7, 0, 7, 4, 6, 4>();
+	palette4bpp_[3] = palette_entry<7, 1, 7, 5, 6, 5>();
+	palette4bpp_[9] = palette_entry<7, 2, 6, 2, 6, 6>();
+	palette4bpp_[11] = palette_entry<7, 3, 6, 3, 6, 7>();
+}
+
+// MARK: - State
+
+VideoOutput::State::State() {
+	if(needs_declare()) {
+		DeclareField(palette);
+		DeclareField(screen_base);
+		DeclareField(mode);
+		DeclareField(v_count);
+		DeclareField(h_count);
+		DeclareField(field);
+		DeclareField(row_addr);
+		DeclareField(byte_addr);
+		DeclareField(char_row);
+		DeclareField(vsync_int);
+		DeclareField(hsync_int);
+	}
+}
+
+VideoOutput::State::State(const VideoOutput &source) : State() {
+	std::memcpy(palette, source.palette_, sizeof(palette));
+	screen_base = source.screen_base_;
+	mode = source.mode_;
+
+	v_count = source.v_count_;
+	h_count = source.h_count_;
+	field = source.field_;
+
+	row_addr = source.row_addr_;
+	byte_addr = source.byte_addr_;
+	char_row = source.char_row_;
+
+	vsync_int = source.vsync_int_;
+	hsync_int = source.hsync_int_;
+}
+
+void VideoOutput::State::apply(VideoOutput &target) const {
+	std::memcpy(target.palette_, palette, sizeof(palette));
+	target.update_palettes(0x08);
+	target.screen_base_ = screen_base;
+	target.set_mode(mode);
+
+	target.v_count_ = v_count;
+	target.h_count_ = h_count;
+	target.field_ = field;
+
+	target.row_addr_ = row_addr;
+	target.byte_addr_ = byte_addr;
+	target.char_row_ = char_row;
+
+	target.vsync_int_ = vsync_int;
+	target.hsync_int_ = hsync_int;
+
+	// Close whatever was being output; the raster may have moved arbitrarily so
+	// output resumes with a fresh run of whatever is next due.
+	target.end_output_run();
+	target.output_ = OutputStage::Blank;
+	target.current_output_target_ = nullptr;
 }
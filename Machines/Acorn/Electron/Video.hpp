@@ -10,6 +10,7 @@
 
 #include "../../../Outputs/CRT/CRT.hpp"
 #include "../../../ClockReceiver/ClockReceiver.hpp"
+#include "../../../Reflection/Struct.hpp"
 #include "Interrupts.hpp"
 
 #include <vector>
@@ -76,6 +77,31 @@ class VideoOutput {
 		*/
 		unsigned int get_cycles_until_next_ram_availability(int from_time);
 
+		/*!
+			Captures the ULA's video registers and raster position; output already
+			posted to the CRT is not included.
+		*/
+		struct State: public Reflection::StructImpl<State> {
+			uint8_t palette[8]{};
+			uint16_t screen_base = 0;
+			uint8_t mode = 0;
+
+			int v_count = 0;
+			int h_count = 0;
+			bool field = true;
+
+			uint16_t row_addr = 0;
+			uint16_t byte_addr = 0;
+			int char_row = 0;
+
+			bool vsync_int = false;
+			bool hsync_int = false;
+
+			State();
+			State(const VideoOutput &);
+			void apply(VideoOutput &) const;
+		};
+
 	private:
 		const uint8_t *ram_ = nullptr;
 
@@ -92,12 +118,18 @@ class VideoOutput {
 		int current_output_divider_ = 1;
 		Outputs::CRT::CRT crt_;
 
+		/// Posts the current run of output to the CRT.
+		void end_output_run();
+
 		// Palettes.
 		uint8_t palette_[8]{};
 		uint8_t palette1bpp_[2]{};
 		uint8_t palette2bpp_[4]{};
 		uint8_t palette4bpp_[16]{};
 
+		/// Rebuilds the per-mode palettes from @c palette_ following a write to register @c address.
+		void update_palettes(int address);
+
 		template <int index, int source_bit, int target_bit>
 		uint8_t channel() {
 			if constexpr (source_bit < target_bit) {
@@ -115,8 +147,11 @@ class VideoOutput {
 		// User-selected base address; constrained to a 64-byte boundary by the setter.
 		uint16_t screen_base_ = 0;
 
-		// Parameters implied by mode selection.
-		uint16_t mode_base_ = 0;
+		// Parameters implied by mode selection; initial values are as per mode 4, so that
+		// mode_ is always sufficient to reconstruct the rest.
+		void set_mode(uint8_t mode);
+		uint8_t mode_ = 4;
+		uint16_t mode_base_ = 0x5800;
 		bool mode_40_ = true;
 		bool mode_text_ = false;
 		enum class Bpp {
@@ -175,8 +175,21 @@ class ConcreteMachine:
 			return total_length - cycle.length;
 		}
 
+		template <typename Microcycle> uint8_t *fixed_timing_memory(const Microcycle &cycle, int) {
+			// Only chip RAM is shared with the chipset; all other memory has fixed timing.
+			if(*cycle.address < 0x20'0000) return nullptr;
+
+			const uint32_t address = cycle.host_endian_byte_address();
+			if((address & 0xe0'0000) == 0xa0'0000) return nullptr;
+
+			const auto &region = memory_.regions[address >> 18];
+			const auto permission = (cycle.operation & CPU::MC68000::Operation::Read) ?
+				CPU::MC68000::Operation::PermitRead : CPU::MC68000::Operation::PermitWrite;
+			return (region.read_write_mask & permission) ? &region.contents[address] : nullptr;
+		}
+
 	private:
-		CPU::MC68000::Processor<ConcreteMachine, true, true> mc68000_;
+		CPU::MC68000::Processor<ConcreteMachine, true, true, false, true> mc68000_;
 
 		// MARK: - Memory map.
 
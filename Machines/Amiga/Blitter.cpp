@@ -11,101 +11,168 @@
 #include "Minterms.hpp"
 #include "../../Outputs/Log.hpp"
 
+#include <array>
 #include <cassert>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 using namespace Amiga;
 
 namespace {
 
 Log::Logger<Log::Source::AmigaBlitter> logger;
 
-/// @returns Either the final carry flag or the output nibble when using fill mode given that it either @c is_exclusive fill mode, or isn't;
-/// and the specified initial @c carry and input @c nibble.
-template <bool wants_carry> constexpr uint32_t fill_nibble(bool is_exclusive, uint8_t carry, uint8_t nibble) {
-	uint8_t fill_output = 0;
-	uint8_t bit = 0x01;
-	while(bit < 0x10) {
-		auto pre_toggle = nibble & bit, post_toggle = pre_toggle;
-		if(!is_exclusive) {
-			pre_toggle &= ~carry;	// Accept bits that would transition to set immediately.
-			post_toggle &= carry;	// Accept bits that would transition to clear after the fact.
+/// @returns The output of fill mode applied to @c byte in b0–b7 and the final carry flag in b8, given that it either @c is_exclusive
+/// fill mode, or isn't; and the specified initial @c carry.
+constexpr uint16_t fill_byte(bool is_exclusive, int carry, int byte) {
+	int fill_output = 0;
+	for(int bit = 0; bit < 8; bit++) {
+		const int input = (byte >> bit) & 1;
+
+		// Exclusive fill toggles before output; inclusive fill outputs every edge
+		// and toggles after the fact.
+		if(is_exclusive) {
+			carry ^= input;
+			fill_output |= carry << bit;
 		} else {
-			post_toggle = 0;		// Just do the pre-toggle.
+			fill_output |= (carry | input) << bit;
+			carry ^= input;
 		}
-
-		carry ^= pre_toggle;
-		fill_output |= carry;
-		carry ^= post_toggle;
-
-		bit <<= 1;
-		carry <<= 1;
-	}
-
-	if constexpr (wants_carry) {
-		return carry >> 4;
-	} else {
-		return fill_output;
 	}
+	return uint16_t(fill_output | (carry << 8));
 }
 
-// Lookup key for these tables is:
-//
-//		b0–b3: input nibble
-//		b4: carry
-//		b5: is_exclusive
-//
-// i.e. it's in the range [0, 63].
+// Lookup key for this table is:
 //
-// Tables below are indexed such that the higher-order bits select a table entry, lower-order bits select
-// a bit or nibble from within the indexed item.
-
-constexpr uint32_t fill_carries[] = {
-	(fill_nibble<true>(false, 0, 0x0) << 0x0) | (fill_nibble<true>(false, 0, 0x1) << 0x1) | (fill_nibble<true>(false, 0, 0x2) << 0x2) | (fill_nibble<true>(false, 0, 0x3) << 0x3) |
-	(fill_nibble<true>(false, 0, 0x4) << 0x4) | (fill_nibble<true>(false, 0, 0x5) << 0x5) | (fill_nibble<true>(false, 0, 0x6) << 0x6) | (fill_nibble<true>(false, 0, 0x7) << 0x7) |
-	(fill_nibble<true>(false, 0, 0x8) << 0x8) | (fill_nibble<true>(false, 0, 0x9) << 0x9) | (fill_nibble<true>(false, 0, 0xa) << 0xa) | (fill_nibble<true>(false, 0, 0xb) << 0xb) |
-	(fill_nibble<true>(false, 0, 0xc) << 0xc) | (fill_nibble<true>(false, 0, 0xd) << 0xd) | (fill_nibble<true>(false, 0, 0xe) << 0xe) | (fill_nibble<true>(false, 0, 0xf) << 0xf) |
-
-	(fill_nibble<true>(false, 1, 0x0) << 0x10) | (fill_nibble<true>(false, 1, 0x1) << 0x11) | (fill_nibble<true>(false, 1, 0x2) << 0x12) | (fill_nibble<true>(false, 1, 0x3) << 0x13) |
-	(fill_nibble<true>(false, 1, 0x4) << 0x14) | (fill_nibble<true>(false, 1, 0x5) << 0x15) | (fill_nibble<true>(false, 1, 0x6) << 0x16) | (fill_nibble<true>(false, 1, 0x7) << 0x17) |
-	(fill_nibble<true>(false, 1, 0x8) << 0x18) | (fill_nibble<true>(false, 1, 0x9) << 0x19) | (fill_nibble<true>(false, 1, 0xa) << 0x1a) | (fill_nibble<true>(false, 1, 0xb) << 0x1b) |
-	(fill_nibble<true>(false, 1, 0xc) << 0x1c) | (fill_nibble<true>(false, 1, 0xd) << 0x1d) | (fill_nibble<true>(false, 1, 0xe) << 0x1e) | (fill_nibble<true>(false, 1, 0xf) << 0x1f),
-
-	(fill_nibble<true>(true, 0, 0x0) << 0x0) | (fill_nibble<true>(true, 0, 0x1) << 0x1) | (fill_nibble<true>(true, 0, 0x2) << 0x2) | (fill_nibble<true>(true, 0, 0x3) << 0x3) |
-	(fill_nibble<true>(true, 0, 0x4) << 0x4) | (fill_nibble<true>(true, 0, 0x5) << 0x5) | (fill_nibble<true>(true, 0, 0x6) << 0x6) | (fill_nibble<true>(true, 0, 0x7) << 0x7) |
-	(fill_nibble<true>(true, 0, 0x8) << 0x8) | (fill_nibble<true>(true, 0, 0x9) << 0x9) | (fill_nibble<true>(true, 0, 0xa) << 0xa) | (fill_nibble<true>(true, 0, 0xb) << 0xb) |
-	(fill_nibble<true>(true, 0, 0xc) << 0xc) | (fill_nibble<true>(true, 0, 0xd) << 0xd) | (fill_nibble<true>(true, 0, 0xe) << 0xe) | (fill_nibble<true>(true, 0, 0xf) << 0xf) |
-
-	(fill_nibble<true>(true, 1, 0x0) << 0x10) | (fill_nibble<true>(true, 1, 0x1) << 0x11) | (fill_nibble<true>(true, 1, 0x2) << 0x12) | (fill_nibble<true>(true, 1, 0x3) << 0x13) |
-	(fill_nibble<true>(true, 1, 0x4) << 0x14) | (fill_nibble<true>(true, 1, 0x5) << 0x15) | (fill_nibble<true>(true, 1, 0x6) << 0x16) | (fill_nibble<true>(true, 1, 0x7) << 0x17) |
-	(fill_nibble<true>(true, 1, 0x8) << 0x18) | (fill_nibble<true>(true, 1, 0x9) << 0x19) | (fill_nibble<true>(true, 1, 0xa) << 0x1a) | (fill_nibble<true>(true, 1, 0xb) << 0x1b) |
-	(fill_nibble<true>(true, 1, 0xc) << 0x1c) | (fill_nibble<true>(true, 1, 0xd) << 0x1d) | (fill_nibble<true>(true, 1, 0xe) << 0x1e) | (fill_nibble<true>(true, 1, 0xf) << 0x1f),
-};
-
-constexpr uint32_t fill_values[] = {
-	(fill_nibble<false>(false, 0, 0x0) << 0) | (fill_nibble<false>(false, 0, 0x1) << 4) | (fill_nibble<false>(false, 0, 0x2) << 8) | (fill_nibble<false>(false, 0, 0x3) << 12) |
-	(fill_nibble<false>(false, 0, 0x4) << 16) | (fill_nibble<false>(false, 0, 0x5) << 20) | (fill_nibble<false>(false, 0, 0x6) << 24) | (fill_nibble<false>(false, 0, 0x7) << 28),
-
-	(fill_nibble<false>(false, 0, 0x8) << 0) | (fill_nibble<false>(false, 0, 0x9) << 4) | (fill_nibble<false>(false, 0, 0xa) << 8) | (fill_nibble<false>(false, 0, 0xb) << 12) |
-	(fill_nibble<false>(false, 0, 0xc) << 16) | (fill_nibble<false>(false, 0, 0xd) << 20) | (fill_nibble<false>(false, 0, 0xe) << 24) | (fill_nibble<false>(false, 0, 0xf) << 28),
+//		b0–b7: input byte
+//		b8: carry
+//		b9: is_exclusive
+constexpr auto fill_table = [] {
+	std::array<uint16_t, 1024> table{};
+	for(int c = 0; c < 1024; c++) {
+		table[size_t(c)] = fill_byte(c & 0x200, (c >> 8) & 1, c & 0xff);
+	}
+	return table;
+}();
+
+/// @returns The result of applying fill mode to @c value, with initial carry @c carry; @c carry is updated to the final carry.
+uint16_t fill(uint16_t value, int &carry, bool is_exclusive) {
+	const int type = is_exclusive ? 0x200 : 0x000;
+	const uint16_t low = fill_table[size_t(type | (carry << 8) | (value & 0xff))];
+	const uint16_t high = fill_table[size_t(type | (low & 0x100) | (value >> 8))];
+	carry = high >> 8;
+	return uint16_t((low & 0xff) | (high << 8));
+}
 
-	(fill_nibble<false>(false, 1, 0x0) << 0) | (fill_nibble<false>(false, 1, 0x1) << 4) | (fill_nibble<false>(false, 1, 0x2) << 8) | (fill_nibble<false>(false, 1, 0x3) << 12) |
-	(fill_nibble<false>(false, 1, 0x4) << 16) | (fill_nibble<false>(false, 1, 0x5) << 20) | (fill_nibble<false>(false, 1, 0x6) << 24) | (fill_nibble<false>(false, 1, 0x7) << 28),
+/// @returns The output of the barrel shifter given the two most-recent input words in @c source,
+/// with the newer in the low 16 bits. The shifter shifts right when blitting in ascending
+/// address order but left when descending.
+constexpr uint16_t barrel_shift(uint32_t source, int shift, bool descending) {
+	if(!shift) return uint16_t(source);
+	return descending ?
+		uint16_t((source << shift) | (source >> (32 - shift))) :
+		uint16_t(source >> shift);
+}
 
-	(fill_nibble<false>(false, 1, 0x8) << 0) | (fill_nibble<false>(false, 1, 0x9) << 4) | (fill_nibble<false>(false, 1, 0xa) << 8) | (fill_nibble<false>(false, 1, 0xb) << 12) |
-	(fill_nibble<false>(false, 1, 0xc) << 16) | (fill_nibble<false>(false, 1, 0xd) << 20) | (fill_nibble<false>(false, 1, 0xe) << 24) | (fill_nibble<false>(false, 1, 0xf) << 28),
+/// Minterms with a dedicated kernel in bulk execution; others share a kernel that reads the
+/// minterm at runtime. Specialising all 256 would cost around a megabyte of code for little gain.
+constexpr bool has_specialised_kernel(int minterm) {
+	switch(minterm) {
+		default: return false;
+
+		case 0x00:	// D = 0
+		case 0xff:	// D = 1
+		case 0xf0:	// D = A
+		case 0xcc:	// D = B
+		case 0xaa:	// D = C
+		case 0x0f:	// D = /A
+		case 0x33:	// D = /B
+		case 0xc0:	// D = AB
+		case 0x3c:	// D = A ^ B
+		case 0x5a:	// D = A ^ C
+		case 0x0a:	// D = /AC, i.e. clear through a mask.
+		case 0xfa:	// D = A + C
+		case 0xea:	// D = AB + C
+		case 0xca:	// D = AB + /AC, i.e. a cookie cut.
+		case 0x6a:	// D = AB ^ C, i.e. a cookie cut by exclusive or.
+		return true;
+	}
+}
 
-	(fill_nibble<false>(true, 0, 0x0) << 0) | (fill_nibble<false>(true, 0, 0x1) << 4) | (fill_nibble<false>(true, 0, 0x2) << 8) | (fill_nibble<false>(true, 0, 0x3) << 12) |
-	(fill_nibble<false>(true, 0, 0x4) << 16) | (fill_nibble<false>(true, 0, 0x5) << 20) | (fill_nibble<false>(true, 0, 0x6) << 24) | (fill_nibble<false>(true, 0, 0x7) << 28),
+/// Minterms with a vectorised implementation in @c copy_span.
+constexpr bool has_span_kernel(int minterm) {
+	return
+		minterm == 0xf0 ||		// D = A
+		minterm == 0xcc ||		// D = B
+		minterm == 0xca;		// D = AB + /AC, i.e. a cookie cut.
+}
 
-	(fill_nibble<false>(true, 0, 0x8) << 0) | (fill_nibble<false>(true, 0, 0x9) << 4) | (fill_nibble<false>(true, 0, 0xa) << 8) | (fill_nibble<false>(true, 0, 0xb) << 12) |
-	(fill_nibble<false>(true, 0, 0xc) << 16) | (fill_nibble<false>(true, 0, 0xd) << 20) | (fill_nibble<false>(true, 0, 0xe) << 24) | (fill_nibble<false>(true, 0, 0xf) << 28),
+/// Produces eight words of output to @c d for one of the minterms accepted by @c has_span_kernel,
+/// in ascending address mode and with neither mask nor fill applicable.
+///
+/// @c a, @c b and @c c point to the first word of input on their respective channels; the word
+/// before each of @c a and @c b is also read in order to supply the barrel shifter. All must
+/// be valid, even if the minterm doesn't use them.
+///
+/// @returns @c true if any output was non-zero; @c false otherwise.
+template <int minterm> bool copy_span(uint16_t *d, const uint16_t *a, const uint16_t *b, const uint16_t *c, int a_shift, int b_shift) {
+#if defined(__SSE2__) || defined(_M_X64)
+	const auto shifted = [](const uint16_t *source, int shift) {
+		return _mm_or_si128(
+			_mm_srl_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source)), _mm_cvtsi32_si128(shift)),
+			_mm_sll_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source - 1)), _mm_cvtsi32_si128(16 - shift)));
+	};
+
+	__m128i output;
+	if constexpr (minterm == 0xf0) {
+		output = shifted(a, a_shift);
+	} else if constexpr (minterm == 0xcc) {
+		output = shifted(b, b_shift);
+	} else {
+		const __m128i mask = shifted(a, a_shift);
+		output = _mm_or_si128(
+			_mm_and_si128(mask, shifted(b, b_shift)),
+			_mm_andnot_si128(mask, _mm_loadu_si128(reinterpret_cast<const __m128i *>(c))));
+	}
 
-	(fill_nibble<false>(true, 1, 0x0) << 0) | (fill_nibble<false>(true, 1, 0x1) << 4) | (fill_nibble<false>(true, 1, 0x2) << 8) | (fill_nibble<false>(true, 1, 0x3) << 12) |
-	(fill_nibble<false>(true, 1, 0x4) << 16) | (fill_nibble<false>(true, 1, 0x5) << 20) | (fill_nibble<false>(true, 1, 0x6) << 24) | (fill_nibble<false>(true, 1, 0x7) << 28),
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(d), output);
+	return _mm_movemask_epi8(_mm_cmpeq_epi16(output, _mm_setzero_si128())) != 0xffff;
+#elif defined(__ARM_NEON)
+	const auto shifted = [](const uint16_t *source, int shift) {
+		return vorrq_u16(
+			vshlq_u16(vld1q_u16(source), vdupq_n_s16(int16_t(-shift))),
+			vshlq_u16(vld1q_u16(source - 1), vdupq_n_s16(int16_t(16 - shift))));
+	};
+
+	uint16x8_t output;
+	if constexpr (minterm == 0xf0) {
+		output = shifted(a, a_shift);
+	} else if constexpr (minterm == 0xcc) {
+		output = shifted(b, b_shift);
+	} else {
+		output = vbslq_u16(shifted(a, a_shift), shifted(b, b_shift), vld1q_u16(c));
+	}
 
-	(fill_nibble<false>(true, 1, 0x8) << 0) | (fill_nibble<false>(true, 1, 0x9) << 4) | (fill_nibble<false>(true, 1, 0xa) << 8) | (fill_nibble<false>(true, 1, 0xb) << 12) |
-	(fill_nibble<false>(true, 1, 0xc) << 16) | (fill_nibble<false>(true, 1, 0xd) << 20) | (fill_nibble<false>(true, 1, 0xe) << 24) | (fill_nibble<false>(true, 1, 0xf) << 28),
-};
+	vst1q_u16(d, output);
+	const uint16x4_t halves = vorr_u16(vget_low_u16(output), vget_high_u16(output));
+	return vget_lane_u64(vreinterpret_u64_u16(halves), 0);
+#else
+	uint16_t any_output = 0;
+	for(int x = 0; x < 8; x++) {
+		const uint16_t shifted_a = barrel_shift(uint32_t((a[x-1] << 16) | a[x]), a_shift, false);
+		const uint16_t shifted_b = barrel_shift(uint32_t((b[x-1] << 16) | b[x]), b_shift, false);
+		d[x] = apply_minterm<uint16_t>(shifted_a, shifted_b, c[x], minterm);
+		any_output |= d[x];
+	}
+	return any_output;
+#endif
+}
 
 }
 
@@ -230,33 +297,67 @@ void Blitter<record_bus>::add_modulos() {
 }
 
 template <bool record_bus>
-template <bool complete_immediately>
-bool Blitter<record_bus>::advance_dma() {
-	if(!height_) return false;
+void Blitter<record_bus>::step_line() {
+	constexpr int LEFT	= 1 << 0;
+	constexpr int RIGHT	= 1 << 1;
+	constexpr int UP	= 1 << 2;
+	constexpr int DOWN	= 1 << 3;
+	int step = (line_direction_ & 4) ?
+		((line_direction_ & 1) ? LEFT : RIGHT) :
+		((line_direction_ & 1) ? UP : DOWN);
+
+	if(error_ < 0) {
+		error_ += modulos_[1];
+	} else {
+		step |=
+			(line_direction_ & 4) ?
+				((line_direction_ & 2) ? UP : DOWN) :
+				((line_direction_ & 2) ? LEFT : RIGHT);
 
-	// TODO: eliminate @c complete_immediately and this workaround.
-	// See commentary in Chipset.cpp.
-	if constexpr (complete_immediately) {
+		error_ += modulos_[0];
+	}
 
-		// HACK! HACK!! HACK!!!
-		//
-		// This resolves an issue with loading the particular copy of Spindizzy Worlds
-		// I am testing against.
-		//
-		// TODO: DO NOT PUBLISH THIS.
-		//
-		// This is committed solely so that I can continue researching the real, underlying
-		// issue across machines. It would not be acceptable to me to ship this.
-		// (and the printf is another reminder-to-self)
-		if(width_ == 8 && height_ == 32) {
-			printf("Accelerating %d x %d\n", width_, height_);
-
-			while(get_status() & 0x4000) {
-				advance_dma<false>();
+	if(step & LEFT) {
+		--shifts_[0];
+		if(shifts_[0] == -1) {
+			--pointer_[3];
+		}
+	} else if(step & RIGHT) {
+		++shifts_[0];
+		if(shifts_[0] == 16) {
+			++pointer_[3];
+		}
+	}
+	shifts_[0] &= 15;
+
+	if(step & UP) {
+		pointer_[3] -= modulos_[2];
+		draw_ = true;
+	} else if(step & DOWN) {
+		pointer_[3] += modulos_[2];
+		draw_ = true;
+	}
+}
+
+template <bool record_bus>
+bool Blitter<record_bus>::advance_dma(bool is_unobserved) {
+	if(!height_) return false;
+
+	// A blit that begins while nothing else can observe memory has all its memory accesses
+	// performed at the start, but still occupies the same DMA slots as it would otherwise.
+	// Bus recording is supported only slot by slot.
+	if constexpr (!record_bus) {
+		if(is_unobserved && !busy_) {
+			if(line_mode_) {
+				complete_line();
+			} else {
+				complete_copy();
 			}
-			return true;
 		}
 	}
+	if(is_completing_) {
+		return advance_completion();
+	}
 
 	if(line_mode_) {
 		not_zero_flag_ = false;
@@ -351,45 +452,7 @@ bool Blitter<record_bus>::advance_dma() {
 			}
 		}
 
-		constexpr int LEFT	= 1 << 0;
-		constexpr int RIGHT	= 1 << 1;
-		constexpr int UP	= 1 << 2;
-		constexpr int DOWN	= 1 << 3;
-		int step = (line_direction_ & 4) ?
-			((line_direction_ & 1) ? LEFT : RIGHT) :
-			((line_direction_ & 1) ? UP : DOWN);
-
-		if(error_ < 0) {
-			error_ += modulos_[1];
-		} else {
-			step |=
-				(line_direction_ & 4) ?
-					((line_direction_ & 2) ? UP : DOWN) :
-					((line_direction_ & 2) ? LEFT : RIGHT);
-
-			error_ += modulos_[0];
-		}
-
-		if(step & LEFT) {
-			--shifts_[0];
-			if(shifts_[0] == -1) {
-				--pointer_[3];
-			}
-		} else if(step & RIGHT) {
-			++shifts_[0];
-			if(shifts_[0] == 16) {
-				++pointer_[3];
-			}
-		}
-		shifts_[0] &= 15;
-
-		if(step & UP) {
-			pointer_[3] -= modulos_[2];
-			draw_ = true;
-		} else if(step & DOWN) {
-			pointer_[3] += modulos_[2];
-			draw_ = true;
-		}
+		step_line();
 
 		--height_;
 		if(!height_) {
@@ -492,25 +555,8 @@ bool Blitter<record_bus>::advance_dma() {
 		a32_ = (a32_ << 16) | (a_data_ & transient_a_mask_);
 		b32_ = (b32_ << 16) | b_data_;
 
-		uint16_t a, b;
-
-		// The barrel shifter shifts to the right in ascending address mode,
-		// but to the left otherwise.
-		if(!one_dot_) {
-			a = uint16_t(a32_ >> shifts_[0]);
-			b = uint16_t(b32_ >> shifts_[1]);
-		} else {
-			// TODO: there must be a neater solution than this.
-			a = uint16_t(
-				(a32_ << shifts_[0]) |
-				(a32_ >> (32 - shifts_[0]))
-			);
-
-			b = uint16_t(
-				(b32_ << shifts_[1]) |
-				(b32_ >> (32 - shifts_[1]))
-			);
-		}
+		const uint16_t a = barrel_shift(a32_, shifts_[0], one_dot_);
+		const uint16_t b = barrel_shift(b32_, shifts_[1], one_dot_);
 
 		uint16_t output =
 			apply_minterm<uint16_t>(
@@ -520,19 +566,9 @@ bool Blitter<record_bus>::advance_dma() {
 				minterms_);
 
 		if(exclusive_fill_ || inclusive_fill_) {
-			// Use the fill tables nibble-by-nibble to figure out the filled word.
-			uint16_t fill_output = 0;
-			int ongoing_carry = fill_carry_;
-			const int type_mask = exclusive_fill_ ? (1 << 5) : 0;
-			for(int c = 0; c < 16; c += 4) {
-				const int total_index = (output & 0xf) | (ongoing_carry << 4) | type_mask;
-				fill_output |= ((fill_values[total_index >> 3] >> ((total_index & 7) * 4)) & 0xf) << c;
-				ongoing_carry = (fill_carries[total_index >> 5] >> (total_index & 31)) & 1;
-				output >>= 4;
-			}
-
-			output = fill_output;
-			fill_carry_ = ongoing_carry;
+			int carry = fill_carry_;
+			output = fill(output, carry, exclusive_fill_);
+			fill_carry_ = carry;
 		}
 
 		not_zero_flag_ |= output;
@@ -563,6 +599,297 @@ bool Blitter<record_bus>::advance_dma() {
 	return true;
 }
 
+//
+// Bulk execution.
+//
+
+template <bool record_bus>
+template <size_t... minterms>
+constexpr auto Blitter<record_bus>::line_kernels(std::index_sequence<minterms...>) {
+	return std::array<void (Blitter::*)(), sizeof...(minterms)>{
+		&Blitter::draw_line<has_specialised_kernel(int(minterms)) ? int(minterms) : GenericMinterm>...
+	};
+}
+
+template <bool record_bus>
+template <size_t... minterms>
+constexpr auto Blitter<record_bus>::copy_kernels(std::index_sequence<minterms...>) {
+	return std::array<void (Blitter::*)(), sizeof...(minterms)>{
+		&Blitter::copy_rows<has_specialised_kernel(int(minterms)) ? int(minterms) : GenericMinterm>...
+	};
+}
+
+template <bool record_bus>
+void Blitter<record_bus>::complete_line() {
+	// As-yet unimplemented:
+	assert(b_data_ == 0xffff);
+
+	static constexpr auto kernels = line_kernels(std::make_index_sequence<256>());
+	(this->*kernels[minterms_])();
+
+	busy_ = true;
+	is_completing_ = true;
+	has_c_data_ = false;
+	line_step_ = 0;
+}
+
+template <bool record_bus>
+template <int minterm>
+void Blitter<record_bus>::draw_line() {
+	const int function = minterm == GenericMinterm ? minterms_ : minterm;
+	error_ = int16_t(pointer_[0] << 1) >> 1;
+	draw_ = true;
+
+	// Record which steps draw, since those occupy two slots rather than one.
+	line_draws_.clear();
+	line_draws_.reserve(size_t(height_));
+
+	const uint16_t b = b_data_;
+	for(int step = 0; step < height_; step++) {
+		// Per the slot-by-slot implementation, the zero flag reflects only the final step.
+		not_zero_flag_ = false;
+
+		line_draws_.push_back(draw_);
+		if(draw_) {
+			uint16_t &target = ram_[pointer_[3] & ram_mask_];
+			c_data_ = target;
+			target = apply_minterm<uint16_t>(a_data_ >> shifts_[0], b, c_data_, function);
+			not_zero_flag_ = target;
+			draw_ = !one_dot_;
+		}
+
+		step_line();
+	}
+}
+
+template <bool record_bus>
+void Blitter<record_bus>::complete_copy() {
+	not_zero_flag_ = false;
+	a32_ = b32_ = 0;
+
+	if(sequencer_.channel_enabled<3>()) {
+		static constexpr auto kernels = copy_kernels(std::make_index_sequence<256>());
+		(this->*kernels[minterms_])();
+	} else {
+		// With no destination there's no output and therefore nothing to
+		// calculate; just run the source pointers.
+		for(int y = 0; y < height_; y++) {
+			for(int x = 0; x < width_; x++) {
+				if(sequencer_.channel_enabled<0>()) {
+					a_data_ = ram_[pointer_[0] & ram_mask_];
+					pointer_[0] += direction_;
+				}
+				if(sequencer_.channel_enabled<1>()) {
+					b_data_ = ram_[pointer_[1] & ram_mask_];
+					pointer_[1] += direction_;
+				}
+				if(sequencer_.channel_enabled<2>()) {
+					c_data_ = ram_[pointer_[2] & ram_mask_];
+					pointer_[2] += direction_;
+				}
+			}
+			add_modulos();
+		}
+	}
+
+	// Prepare to walk the sequencer through the same slots as the slot-by-slot implementation.
+	sequencer_.begin();
+	y_ = 0;
+	x_ = 0;
+	loop_index_ = -1;
+	write_phase_ = WritePhase::Starting;
+	busy_ = true;
+	is_completing_ = true;
+}
+
+template <bool record_bus>
+bool Blitter<record_bus>::advance_completion() {
+	bool did_use_slot = true;
+
+	if(line_mode_) {
+		if(line_draws_[size_t(line_step_)]) {
+			// A drawn step reads C in one slot and writes D in the next.
+			has_c_data_ = !has_c_data_;
+			if(has_c_data_) {
+				return true;
+			}
+		} else {
+			did_use_slot = false;
+		}
+
+		++line_step_;
+		--height_;
+		if(height_) {
+			return did_use_slot;
+		}
+	} else {
+		// Per the slot-by-slot implementation, but with no memory accesses.
+		const auto next = sequencer_.next();
+		if(next.second != loop_index_) {
+			++x_;
+			if(x_ == width_) {
+				x_ = 0;
+				++y_;
+				if(y_ == height_) {
+					sequencer_.complete();
+				}
+			}
+			++loop_index_;
+		}
+
+		switch(next.first) {
+			case BlitterSequencer::Channel::FlushPipeline:	break;
+			case BlitterSequencer::Channel::None:			return false;
+			default:										return true;
+		}
+		height_ = 0;
+	}
+
+	busy_ = false;
+	is_completing_ = false;
+	posit_interrupt(InterruptFlag::Blitter);
+	return did_use_slot;
+}
+
+/// @returns @c true if the current row can be produced in part by @c copy_span. That requires
+/// ascending addresses, no fill, and that no channel's addresses either wrap or overlap those of
+/// the destination, other than that C may exactly match D.
+template <bool record_bus>
+bool Blitter<record_bus>::can_copy_spans(int minterm) const {
+	if(!has_span_kernel(minterm) || one_dot_ || exclusive_fill_ || inclusive_fill_) {
+		return false;
+	}
+
+	// Inputs must actually be fetched for any channel that the minterm uses.
+	const int channels = sequencer_.channel_enabled<0>() * 8 + sequencer_.channel_enabled<1>() * 4 + sequencer_.channel_enabled<2>() * 2;
+	const int required = (minterm == 0xf0) ? 8 : ((minterm == 0xcc) ? 4 : 14);
+	if((channels & required) != required) {
+		return false;
+	}
+
+	const uint32_t width = uint32_t(width_);
+	const uint32_t destination = pointer_[3] & ram_mask_;
+	if(destination + width > ram_mask_ + 1) {
+		return false;
+	}
+	for(int channel = 0; channel < 3; channel++) {
+		if(!(channels & (8 >> channel))) continue;
+
+		const uint32_t source = pointer_[size_t(channel)] & ram_mask_;
+		if(source + width > ram_mask_ + 1) {
+			return false;
+		}
+		if(channel == 2 && source == destination) {
+			continue;
+		}
+		if(source < destination + width && destination < source + width) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template <bool record_bus>
+template <int minterm>
+void Blitter<record_bus>::copy_rows() {
+	const int function = minterm == GenericMinterm ? minterms_ : minterm;
+	const bool use_a = sequencer_.channel_enabled<0>();
+	const bool use_b = sequencer_.channel_enabled<1>();
+	const bool use_c = sequencer_.channel_enabled<2>();
+	const bool use_fill = exclusive_fill_ || inclusive_fill_;
+	int carry = fill_carry_;
+
+	// Output is written with a one-word delay, as per the pipeline; this preserves the
+	// slot-by-slot ordering of reads and writes in the event that channels overlap.
+	bool has_pending_write = false;
+	uint32_t pending_address = 0;
+	uint16_t pending_value = 0;
+
+	for(int y = 0; y < height_; y++) {
+		const bool use_spans = can_copy_spans(function);
+
+		int x = 0;
+		while(x < width_) {
+			// Spans avoid both the first-word mask and the first word's contribution to
+			// the barrel shifter, and must leave the final word, with its mask, to the
+			// scalar path.
+			if constexpr (has_span_kernel(minterm)) {
+				if(use_spans && x >= 2 && x + 8 < width_) {
+					if(has_pending_write) {
+						ram_[pending_address & ram_mask_] = pending_value;
+						has_pending_write = false;
+					}
+
+					uint16_t *const d = &ram_[pointer_[3] & ram_mask_];
+					const uint16_t *const a = use_a ? &ram_[pointer_[0] & ram_mask_] : d;
+					const uint16_t *const b = use_b ? &ram_[pointer_[1] & ram_mask_] : d;
+					const uint16_t *const c = use_c ? &ram_[pointer_[2] & ram_mask_] : d;
+					if(use_a) a_data_ = a[7];
+					if(use_b) b_data_ = b[7];
+					if(use_c) c_data_ = c[7];
+					a32_ = a_data_;
+					b32_ = b_data_;
+
+					not_zero_flag_ |= copy_span<minterm>(d, a, b, c, shifts_[0], shifts_[1]);
+
+					pointer_[0] += 8 * use_a;
+					pointer_[1] += 8 * use_b;
+					pointer_[2] += 8 * use_c;
+					pointer_[3] += 8;
+					x += 8;
+					continue;
+				}
+			}
+
+			uint16_t a_mask = x ? 0xffff : a_mask_[0];
+			if(x == width_ - 1) a_mask &= a_mask_[1];
+
+			if(use_a) {
+				a_data_ = ram_[pointer_[0] & ram_mask_];
+				pointer_[0] += direction_;
+			}
+			if(use_b) {
+				b_data_ = ram_[pointer_[1] & ram_mask_];
+				pointer_[1] += direction_;
+			}
+			if(use_c) {
+				c_data_ = ram_[pointer_[2] & ram_mask_];
+				pointer_[2] += direction_;
+			}
+
+			a32_ = (a32_ << 16) | (a_data_ & a_mask);
+			b32_ = (b32_ << 16) | b_data_;
+
+			uint16_t output = apply_minterm<uint16_t>(
+				barrel_shift(a32_, shifts_[0], one_dot_),
+				barrel_shift(b32_, shifts_[1], one_dot_),
+				c_data_,
+				function);
+			if(use_fill) {
+				output = fill(output, carry, exclusive_fill_);
+			}
+			not_zero_flag_ |= output;
+
+			if(has_pending_write) {
+				ram_[pending_address & ram_mask_] = pending_value;
+			}
+			has_pending_write = true;
+			pending_address = pointer_[3];
+			pending_value = output;
+			pointer_[3] += direction_;
+
+			++x;
+		}
+
+		add_modulos();
+	}
+
+	if(has_pending_write) {
+		ram_[pending_address & ram_mask_] = pending_value;
+	}
+	fill_carry_ = carry;
+}
+
 template <bool record_bus>
 std::vector<typename Blitter<record_bus>::Transaction> Blitter<record_bus>::get_and_reset_transactions() {
 	std::vector<Transaction> result;
@@ -572,7 +899,3 @@ std::vector<typename Blitter<record_bus>::Transaction> Blitter<record_bus>::get_
 
 template class Amiga::Blitter<false>;
 template class Amiga::Blitter<true>;
-template bool Amiga::Blitter<true>::advance_dma<true>();
-template bool Amiga::Blitter<true>::advance_dma<false>();
-template bool Amiga::Blitter<false>::advance_dma<true>();
-template bool Amiga::Blitter<false>::advance_dma<false>();
@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
@@ -47,7 +48,29 @@ template <bool record_bus = false> class Blitter: public DMADevice<4, 4> {
 
 		uint16_t get_status();
 
-		template <bool complete_immediately> bool advance_dma();
+		/// Advances the Blitter by one DMA slot. If @c is_unobserved is @c true then nothing else could
+		/// observe memory during a blit that begins now, so it may be performed in bulk.
+		///
+		/// @returns @c true if the slot was used; @c false otherwise.
+		bool advance_dma(bool is_unobserved = false);
+
+		/// @returns @c true if a blit beginning now, with current settings, would use every DMA slot
+		/// offered to it until it ends; with Blitter priority set that leaves none for the CPU.
+		bool claims_every_slot() const {
+			return line_mode_ ? !one_dot_ : sequencer_.is_continuous();
+		}
+
+		/// @returns @c true if a blit has been requested but has not yet begun.
+		bool is_starting() const {
+			return height_ && !busy_;
+		}
+
+		/// @returns An upper bound on the number of DMA slots that a blit beginning now, with current settings,
+		/// will use: two per step of a line, or one per slot of the sequence per word of a copy; plus any
+		/// final pipeline flush.
+		int slots_required() const {
+			return (line_mode_ ? 2 * height_ : int(sequencer_.length()) * width_ * height_) + 2;
+		}
 
 		struct Transaction {
 			enum class Type {
@@ -121,7 +144,28 @@ template <bool record_bus = false> class Blitter: public DMADevice<4, 4> {
 		bool has_c_data_ = false;
 
 		void add_modulos();
+		void step_line();
 		std::vector<Transaction> transactions_;
+
+		// Bulk execution: performs all memory accesses for an entire blit in a single call, with
+		// an inner loop specialised for each minterm. The blit then remains in progress, occupying
+		// the same slots as the slot-by-slot implementation would, until advance_completion
+		// has been called for each of them.
+		void complete_line();
+		void complete_copy();
+		bool advance_completion();
+		bool is_completing_ = false;
+		std::vector<bool> line_draws_;
+		int line_step_ = 0;
+
+		// Kernels are specialised for the most common minterms only; GenericMinterm
+		// selects a kernel that applies minterms_ at runtime.
+		static constexpr int GenericMinterm = -1;
+		template <int minterm> void draw_line();
+		template <int minterm> void copy_rows();
+		template <size_t... minterms> static constexpr auto line_kernels(std::index_sequence<minterms...>);
+		template <size_t... minterms> static constexpr auto copy_kernels(std::index_sequence<minterms...>);
+		bool can_copy_spans(int minterm) const;
 };
 
 }
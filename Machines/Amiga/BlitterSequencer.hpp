@@ -103,10 +103,27 @@ class BlitterSequencer {
 			return std::make_pair(next, loop_);
 		}
 
-		template <int channel> bool channel_enabled() {
+		template <int channel> bool channel_enabled() const {
 			return control_ & (8 >> channel);
 		}
 
+		/// @returns @c true if no slot between the start and end of a sequence with the current
+		/// control value is Channel::None.
+		bool is_continuous() const {
+			return control_ == 0xa || control_ == 0xe || control_ == 0xf;
+		}
+
+		/// @returns The number of slots in each iteration of the sequence with the current control value.
+		size_t length() const {
+			constexpr size_t lengths[] = {
+				pattern0.size(), pattern1.size(), pattern2.size(), pattern3.size(),
+				pattern4.size(), pattern5.size(), pattern6.size(), pattern7.size(),
+				pattern8.size(), pattern9.size(), patternA.size(), patternB.size(),
+				patternC.size(), patternD.size(), patternE.size(), patternF.size(),
+			};
+			return lengths[control_];
+		}
+
 	private:
 		static constexpr std::array<Channel, 1> pattern0 = { Channel::None };
 		static constexpr std::array<Channel, 2> pattern1 = { Channel::Write, Channel::None };
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <tuple>
 
 namespace {
@@ -654,12 +655,65 @@ template <int cycle, bool stop_if_cpu> bool Chipset::perform_cycle() {
 
 	// Give first refusal to the Blitter (if enabled), otherwise pass on to the CPU.
 	//
-	// TODO: determine why I see Blitter issues if I don't allow it to complete immediately.
-	// All tests pass without immediate completion, and immediate completion just runs the
-	// non-immediate version until the busy flag is disabled. So probably a scheduling or
-	// signalling issue out here.
+	// A blit may be performed in bulk only if nothing could observe memory before it ends.
+	// The CPU must be stalled awaiting a chip RAM slot that it won't get until the blit is
+	// over — i.e. Blitter priority is set and the blit claims every slot. Sprite, disk and
+	// audio DMA occur on every line so must be disabled; bitplane and Copper DMA may be
+	// enabled provided that the whole blit fits before either could next access memory.
+	// Otherwise each access happens in its own slot.
+	//
+	// TODO: a copy of Spindizzy Worlds previously failed to load unless 8x32 blits were
+	// completed immediately. That workaround has been removed; the underlying scheduling or
+	// signalling issue hasn't yet been found.
 	constexpr auto BlitterEnabled = DMAFlag::AllBelow | DMAFlag::Blitter;
-	return (dma_control_ & BlitterEnabled) != BlitterEnabled || !blitter_.advance_dma<true>();
+	if((dma_control_ & BlitterEnabled) != BlitterEnabled) {
+		return true;
+	}
+	constexpr auto Observers =
+		DMAFlag::Sprites | DMAFlag::Disk |
+		DMAFlag::AudioChannel0 | DMAFlag::AudioChannel1 | DMAFlag::AudioChannel2 | DMAFlag::AudioChannel3;
+	const bool is_unobserved =
+		stop_if_cpu &&
+		blitter_.is_starting() &&
+		(dma_control_ & (Observers | DMAFlag::BlitterPriority)) == DMAFlag::BlitterPriority &&
+		blitter_.claims_every_slot() &&
+		blitter_.slots_required() <= unobserved_slots(cycle);
+	return !blitter_.advance_dma(is_unobserved);
+}
+
+/// @returns A lower bound on the number of slots, starting from @c cycle, that will be available to
+/// the Blitter before bitplane or Copper DMA could next access memory, assuming that neither the
+/// CPU nor the Copper can alter any relevant register in the meantime.
+int Chipset::unobserved_slots(int cycle) const {
+	// Counts slots until @c target_cycle on the line @c lines from now, allowing for the four
+	// refresh slots on each line.
+	const auto slots_until = [&](int lines, int target_cycle) {
+		return std::max(lines * line_length_ + target_cycle - cycle - 4 * (lines + 1), 0);
+	};
+	int slots = std::numeric_limits<int>::max();
+
+	// Bitplane fetches occur within the fetch window on each line of the vertical display window.
+	constexpr auto BitplaneEnabled = DMAFlag::AllBelow | DMAFlag::Bitplane;
+	if((dma_control_ & BitplaneEnabled) == BitplaneEnabled) {
+		if(fetch_vertical_) {
+			if(horizontal_fetch_ != HorizontalFetch::Stopped) return 0;
+			slots = slots_until(cycle < fetch_window_[0] ? 0 : 1, fetch_window_[0]);
+		} else {
+			// Fields are at least short_field_height_ lines long; assume the shortest.
+			const int start = std::min(int(display_window_start_[1]), short_field_height_ - 1);
+			const int lines = start > y_ ? start - y_ : short_field_height_ - y_ + start;
+			slots = slots_until(lines, fetch_window_[0]);
+		}
+	}
+
+	// The Copper won't access memory again until reloaded at the end of the field if it is dormant.
+	constexpr auto CopperEnabled = DMAFlag::AllBelow | DMAFlag::Copper;
+	if((dma_control_ & CopperEnabled) == CopperEnabled) {
+		if(!copper_.is_dormant(line_length_)) return 0;
+		slots = std::min(slots, slots_until(std::max(short_field_height_ - y_ - 1, 0), line_length_));
+	}
+
+	return slots;
 }
 
 /// Performs all slots starting with @c first_slot and ending just before @c last_slot.
@@ -139,6 +139,7 @@ class Chipset: private ClockingHint::Observer {
 		template <bool stop_on_cpu> Changes run(HalfCycles duration = HalfCycles::max());
 		template <bool stop_on_cpu> int advance_slots(int, int);
 		template <int cycle, bool stop_if_cpu> bool perform_cycle();
+		int unobserved_slots(int cycle) const;
 		template <int cycle> void output();
 		void output_pixels(int cycles_until_sync);
 		void apply_ham(uint8_t);
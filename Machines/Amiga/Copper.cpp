@@ -11,6 +11,8 @@
 
 #include "../../Outputs/Log.hpp"
 
+#include <algorithm>
+
 using namespace Amiga;
 
 namespace {
@@ -76,6 +78,17 @@ Log::Logger<Log::Source::AmigaCopper> logger;
 //			b8–b14:	vertical beam comparison mask
 //			b15:	1 => don't also test whether the Blitter is finished; 0 => test.
 //
+bool Copper::is_dormant(int line_length) const {
+	if(state_ == State::Stopped) return true;
+	if(state_ != State::Waiting) return false;
+
+	// The greatest masked position that could occur has every masked vertical bit set,
+	// and a horizontal part no greater than either its mask or the final slot of a line.
+	const uint16_t mask = 0x8000 | (instruction_[1] & 0x7ffe);
+	const uint16_t greatest = (mask & 0xff00) | std::min(mask & 0xfe, line_length - 1);
+	return (instruction_[0] & mask) > greatest;
+}
+
 bool Copper::advance_dma(uint16_t position, uint16_t blitter_status) {
 	switch(state_) {
 		default: return false;
@@ -37,6 +37,11 @@ class Copper: public DMADevice<2> {
 			state_ = State::Stopped;
 		}
 
+		/// @returns @c true if the Copper won't access memory again until it is next reloaded: it is either
+		/// stopped or waiting for a beam position that never occurs on lines of @c line_length slots, such
+		/// as the conventional end-of-list WAIT $FFFF,$FFFE.
+		bool is_dormant(int line_length) const;
+
 	private:
 		uint32_t address_ = 0;
 		uint16_t control_ = 0;
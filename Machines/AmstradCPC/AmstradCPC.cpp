@@ -121,6 +121,7 @@ class AYDeferrer {
 		/// Constructs a new AY instance and sets its clock rate.
 		AYDeferrer() : ay_(GI::AY38910::Personality::AY38910, audio_queue_), speaker_(ay_) {
 			speaker_.set_input_rate(1000000);
+			speaker_.set_band_limited_steps_enabled(true);
 			// Per the CPC Wiki:
 			// "A is output to the right, channel C is output left, and channel B is output to both left and right".
 			ay_.set_output_mixing(0.0, 0.5, 1.0, 1.0, 0.5, 0.0);
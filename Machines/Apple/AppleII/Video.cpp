@@ -8,8 +8,40 @@
 
 #include "Video.hpp"
 
+#include <cstring>
+
 using namespace Apple::II::Video;
 
+namespace {
+
+/*!
+	Tabulates, for every 7-bit pattern, the @c width samples that it produces when each bit is held for
+	@c width / 7 samples, taking bits in the order supplied by @c bit — which maps a sample
+	index to the mask for the bit that it displays.
+
+	Each sample retains the value of its masked bit rather than being normalised, exactly as if it
+	had been individually calculated.
+*/
+template <size_t width, typename BitT>
+constexpr std::array<std::array<uint8_t, width>, 128> patterns(BitT bit) {
+	std::array<std::array<uint8_t, width>, 128> result{};
+	for(size_t value = 0; value < 128; value++) {
+		for(size_t c = 0; c < width; c++) {
+			result[value][c] = uint8_t(value & bit(c));
+		}
+	}
+	return result;
+}
+
+// Text is output MSB to LSB; graphics LSB to MSB. Everything other than 80-column modes holds
+// each bit for two samples.
+constexpr auto text_patterns = patterns<14>([](size_t c) { return 0x40 >> (c >> 1); });
+constexpr auto double_text_patterns = patterns<7>([](size_t c) { return 0x40 >> c; });
+constexpr auto high_resolution_patterns = patterns<14>([](size_t c) { return 1 << (c >> 1); });
+constexpr auto double_high_resolution_patterns = patterns<7>([](size_t c) { return 1 << c; });
+
+}
+
 VideoBase::VideoBase(bool is_iie, std::function<void(Cycles)> &&target) :
 	VideoSwitches<Cycles>(is_iie, Cycles(2), std::move(target)),
 	crt_(910, 1, Outputs::Display::Type::NTSC60, Outputs::Display::InputDataType::Luminance1),
@@ -83,14 +115,7 @@ void VideoBase::output_text(uint8_t *target, const uint8_t *const source, size_t
 		const std::size_t character_address = size_t(character << 3) + pixel_row;
 		const uint8_t character_pattern = character_rom_[character_address] ^ xor_mask;
 
-		// The character ROM is output MSB to LSB rather than LSB to MSB.
-		target[0] = target[1] = character_pattern & 0x40;
-		target[2] = target[3] = character_pattern & 0x20;
-		target[4] = target[5] = character_pattern & 0x10;
-		target[6] = target[7] = character_pattern & 0x08;
-		target[8] = target[9] = character_pattern & 0x04;
-		target[10] = target[11] = character_pattern & 0x02;
-		target[12] = target[13] = character_pattern & 0x01;
+		std::memcpy(target, text_patterns[character_pattern & 0x7f].data(), 14);
 		graphics_carry_ = character_pattern & 0x01;
 		target += 14;
 	}
@@ -116,21 +141,8 @@ void VideoBase::output_double_text(uint8_t *target, const uint8_t *const source,
 			)
 		};
 
-		// The character ROM is output MSB to LSB rather than LSB to MSB.
-		target[0] = character_patterns[0] & 0x40;
-		target[1] = character_patterns[0] & 0x20;
-		target[2] = character_patterns[0] & 0x10;
-		target[3] = character_patterns[0] & 0x08;
-		target[4] = character_patterns[0] & 0x04;
-		target[5] = character_patterns[0] & 0x02;
-		target[6] = character_patterns[0] & 0x01;
-		target[7] = character_patterns[1] & 0x40;
-		target[8] = character_patterns[1] & 0x20;
-		target[9] = character_patterns[1] & 0x10;
-		target[10] = character_patterns[1] & 0x08;
-		target[11] = character_patterns[1] & 0x04;
-		target[12] = character_patterns[1] & 0x02;
-		target[13] = character_patterns[1] & 0x01;
+		std::memcpy(&target[0], double_text_patterns[character_patterns[0] & 0x7f].data(), 7);
+		std::memcpy(&target[7], double_text_patterns[character_patterns[1] & 0x7f].data(), 7);
 		graphics_carry_ = character_patterns[1] & 0x01;
 		target += 14;
 	}
@@ -208,23 +220,12 @@ void VideoBase::output_high_resolution(uint8_t *target, const uint8_t *const sou
 		// If there is a delay, the previous output level is held to bridge the gap.
 		// Delays may be ignored on a IIe if Annunciator 3 is set; that's the state that
 		// high_resolution_mask_ models.
+		const auto &pattern = high_resolution_patterns[source[c] & 0x7f];
 		if(source[c] & high_resolution_mask_ & 0x80) {
 			target[0] = graphics_carry_;
-			target[1] = target[2] = source[c] & 0x01;
-			target[3] = target[4] = source[c] & 0x02;
-			target[5] = target[6] = source[c] & 0x04;
-			target[7] = target[8] = source[c] & 0x08;
-			target[9] = target[10] = source[c] & 0x10;
-			target[11] = target[12] = source[c] & 0x20;
-			target[13] = source[c] & 0x40;
+			std::memcpy(&target[1], pattern.data(), 13);
 		} else {
-			target[0] = target[1] = source[c] & 0x01;
-			target[2] = target[3] = source[c] & 0x02;
-			target[4] = target[5] = source[c] & 0x04;
-			target[6] = target[7] = source[c] & 0x08;
-			target[8] = target[9] = source[c] & 0x10;
-			target[10] = target[11] = source[c] & 0x20;
-			target[12] = target[13] = source[c] & 0x40;
+			std::memcpy(target, pattern.data(), 14);
 		}
 		graphics_carry_ = source[c] & 0x40;
 		target += 14;
@@ -233,20 +234,8 @@ void VideoBase::output_high_resolution(uint8_t *target, const uint8_t *const sou
 
 void VideoBase::output_double_high_resolution(uint8_t *target, const uint8_t *const source, const uint8_t *const auxiliary_source, size_t length) const {
 	for(size_t c = 0; c < length; ++c) {
-		target[0] = auxiliary_source[c] & 0x01;
-		target[1] = auxiliary_source[c] & 0x02;
-		target[2] = auxiliary_source[c] & 0x04;
-		target[3] = auxiliary_source[c] & 0x08;
-		target[4] = auxiliary_source[c] & 0x10;
-		target[5] = auxiliary_source[c] & 0x20;
-		target[6] = auxiliary_source[c] & 0x40;
-		target[7] = source[c] & 0x01;
-		target[8] = source[c] & 0x02;
-		target[9] = source[c] & 0x04;
-		target[10] = source[c] & 0x08;
-		target[11] = source[c] & 0x10;
-		target[12] = source[c] & 0x20;
-		target[13] = source[c] & 0x40;
+		std::memcpy(&target[0], double_high_resolution_patterns[auxiliary_source[c] & 0x7f].data(), 7);
+		std::memcpy(&target[7], double_high_resolution_patterns[source[c] & 0x7f].data(), 7);
 
 		graphics_carry_ = auxiliary_source[c] & 0x40;
 		target += 14;
@@ -20,7 +20,7 @@ const std::size_t sample_length = 352 / 2;
 
 }
 
-Audio::Audio(Concurrency::AsyncTaskQueue<false> &task_queue) : task_queue_(task_queue) {}
+Audio::Audio(Concurrency::SingleProducerTaskQueue &task_queue) : task_queue_(task_queue) {}
 
 // MARK: - Inputs
 
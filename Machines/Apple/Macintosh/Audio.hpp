@@ -25,7 +25,7 @@ namespace Apple::Macintosh {
 */
 class Audio: public ::Outputs::Speaker::BufferSource<Audio, false> {
 	public:
-		Audio(Concurrency::AsyncTaskQueue<false> &task_queue);
+		Audio(Concurrency::SingleProducerTaskQueue &task_queue);
 
 		/*!
 			Macintosh audio is (partly) sourced by the same scanning
@@ -56,7 +56,7 @@ class Audio: public ::Outputs::Speaker::BufferSource<Audio, false> {
 		void set_sample_volume_range(std::int16_t range);
 
 	private:
-		Concurrency::AsyncTaskQueue<false> &task_queue_;
+		Concurrency::SingleProducerTaskQueue &task_queue_;
 
 		// A queue of fetched samples; read from by one thread,
 		// written to by another.
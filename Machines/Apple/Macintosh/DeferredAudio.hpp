@@ -14,7 +14,8 @@
 namespace Apple::Macintosh {
 
 struct DeferredAudio {
-	Concurrency::AsyncTaskQueue<false> queue;
+	// Single producer: only VIA writes and video fetches, both made as the CPU runs, enqueue to this.
+	Concurrency::SingleProducerTaskQueue queue;
 	Audio audio;
 	Outputs::Speaker::PullLowpass<Audio> speaker;
 	HalfCycles time_since_update;
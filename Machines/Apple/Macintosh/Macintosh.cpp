@@ -13,6 +13,7 @@
 #include "DeferredAudio.hpp"
 #include "DriveSpeedAccumulator.hpp"
 #include "Keyboard.hpp"
+#include "State.hpp"
 #include "Video.hpp"
 
 #include "../../MachineTypes.hpp"
@@ -69,6 +70,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 	public Machine,
 	public MachineTypes::TimedMachine,
 	public MachineTypes::ScanProducer,
+	public MachineTypes::StateProducer,
 	public MachineTypes::AudioProducer,
 	public MachineTypes::MediaTarget,
 	public MachineTypes::MouseMachine,
@@ -130,6 +132,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 			ram_mask_ = ram_size - 1;
 			rom_mask_ = rom_size - 1;
 			ram_.resize(ram_size);
+			tracked_ram_.set_memory(ram_.data(), ram_.size());
 			video_.set_ram(reinterpret_cast<uint16_t *>(ram_.data()), ram_mask_ >> 1);
 
 			// Grab a copy of the ROM and convert it into big-endian data.
@@ -340,6 +343,9 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 
 					memory_base = ram_.data();
 					address &= ram_mask_;
+					if(!(cycle.operation & CPU::MC68000::Operation::Read)) {
+						tracked_ram_.mark(address);
+					}
 
 					// Apply a delay due to video contention if applicable; scheme applied:
 					// only every other access slot is available during the period of video
@@ -365,6 +371,15 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 			return delay;
 		}
 
+		template <typename Microcycle> uint8_t *fixed_timing_memory(const Microcycle &cycle, int) {
+			// ROM is never subject to video contention, so reads from it have fixed timing.
+			if(!(cycle.operation & CPU::MC68000::Operation::Read)) return nullptr;
+
+			const auto address = cycle.host_endian_byte_address();
+			if(address >= 0xe0'0000 || memory_map_[address >> 17] != BusDevice::ROM) return nullptr;
+			return &rom_[address & rom_mask_];
+		}
+
 		void flush_output(int) {
 			// Flush the video before the audio queue; in a Mac the
 			// video is responsible for providing part of the
@@ -501,6 +516,80 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 			}
 		}
 
+		// MARK: - StateProducer.
+		std::unique_ptr<Reflection::Struct> get_state() final {
+			const auto mc68000 = CPU::MC68000::ProcessorState::capture(mc68000_);
+			if(!mc68000) return nullptr;
+
+			auto state = std::make_unique<State>();
+
+			via_.flush();
+			state->mc68000 = *mc68000;
+			state->video = Video::State(video_);
+			state->via = MOS::MOS6522::State(via_);
+			state->scc = Zilog::SCC::State(scc_);
+			state->clock = Apple::Clock::State(clock_);
+
+			if(!tracked_ram_.is_external()) {
+				state->ram = ram_;
+			}
+
+			state->phase = phase_;
+			state->ram_subcycle = ram_subcycle_;
+			state->via_clock = via_clock_.as_integral();
+			state->real_time_clock = real_time_clock_.as_integral();
+			state->keyboard_clock = keyboard_clock_.as_integral();
+			state->time_since_video_update = time_since_video_update_.as_integral();
+			state->time_until_video_event = time_until_video_event_.as_integral();
+
+			return state;
+		}
+
+		TrackedMemory *tracked_memory() final {
+			return &tracked_ram_;
+		}
+
+		bool set_state(const Reflection::Struct &state) final {
+			const auto mac_state = dynamic_cast<const State *>(&state);
+			if(!mac_state) return false;
+
+			// Replay the VIA's port outputs in order to reestablish everything that hangs off
+			// them: the memory overlay, buffer selection, audio volume and enable, and floppy
+			// head selection. This may poke the real-time clock, so do it before restoring that.
+			via_.flush();
+			const auto &via = mac_state->via;
+			const uint8_t timer_control_bit = via.auxiliary_control & 0x80;
+			via_port_handler_.set_port_output(MOS::MOS6522::Port::A, via.output[0], via.data_direction[0]);
+			via_port_handler_.set_port_output(
+				MOS::MOS6522::Port::B,
+				(via.output[1] & (0xff ^ timer_control_bit)) | timer_control_bit,
+				via.data_direction[1] | timer_control_bit);
+
+			mac_state->mc68000.apply(mc68000_);
+			mac_state->video.apply(video_);
+			mac_state->via.apply(via_);
+			mac_state->scc.apply(scc_);
+			mac_state->clock.apply(clock_);
+
+			if(!tracked_ram_.is_external()) {
+				std::copy(
+					mac_state->ram.begin(),
+					mac_state->ram.begin() + std::min(mac_state->ram.size(), ram_.size()),
+					ram_.begin());
+			}
+
+			phase_ = mac_state->phase;
+			ram_subcycle_ = mac_state->ram_subcycle;
+			via_clock_ = HalfCycles(mac_state->via_clock);
+			real_time_clock_ = HalfCycles(mac_state->real_time_clock);
+			keyboard_clock_ = HalfCycles(mac_state->keyboard_clock);
+			time_since_video_update_ = HalfCycles(mac_state->time_since_video_update);
+			time_until_video_event_ = HalfCycles(mac_state->time_until_video_event);
+
+			update_interrupt_input();
+			return true;
+		}
+
 		// MARK: - Configuration options.
 		std::unique_ptr<Reflection::Struct> get_options() final {
 			auto options = std::make_unique<Options>(Configurable::OptionsType::UserFriendly);
@@ -524,6 +613,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 				ram_[0x02af] = 0x00;
 				ram_[0x02b0] = 0x00;
 				ram_[0x02b1] = 0x00;
+				tracked_ram_.mark(0x02ae);
 			}
 		}
 
@@ -749,7 +839,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 				Inputs::QuadratureMouse &mouse_;
 		};
 
-		CPU::MC68000::Processor<ConcreteMachine, true, true> mc68000_;
+		CPU::MC68000::Processor<ConcreteMachine, true, true, false, true> mc68000_;
 
 		DriveSpeedAccumulator drive_speed_accumulator_;
 		IWMActor iwm_;
@@ -833,6 +923,7 @@ template <Analyser::Static::Macintosh::Target::Model model> class ConcreteMachin
 		uint32_t rom_mask_ = 0;
 		uint8_t rom_[128*1024];
 		std::vector<uint8_t> ram_;
+		TrackedMemory tracked_ram_;
 };
 
 }
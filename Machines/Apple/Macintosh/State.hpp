@@ -0,0 +1,61 @@
+//
+//  State.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "../../../Reflection/Struct.hpp"
+#include "../../../Processors/68000/State/State.hpp"
+#include "../../../Components/6522/6522.hpp"
+#include "../../../Components/8530/z8530.hpp"
+#include "../../../Components/AppleClock/AppleClock.hpp"
+
+#include "Video.hpp"
+
+#include <vector>
+
+namespace Apple::Macintosh {
+
+struct State: public Reflection::StructImpl<State> {
+	CPU::MC68000::ProcessorState mc68000;
+	Video::State video;
+	MOS::MOS6522::State via;
+	Zilog::SCC::State scc;
+	Apple::Clock::State clock;
+
+	std::vector<uint8_t> ram;
+
+	// Bus phase and the residues of the various divided clocks, all in half cycles
+	// of the 68000 clock other than the phase and RAM subcycle counters.
+	int phase = 1;
+	int ram_subcycle = 0;
+	int64_t via_clock = 0;
+	int64_t real_time_clock = 0;
+	int64_t keyboard_clock = 0;
+	int64_t time_since_video_update = 0;
+	int64_t time_until_video_event = 0;
+
+	State() {
+		if(needs_declare()) {
+			DeclareField(mc68000);
+			DeclareField(video);
+			DeclareField(via);
+			DeclareField(scc);
+			DeclareField(clock);
+			DeclareField(ram);
+			DeclareField(phase);
+			DeclareField(ram_subcycle);
+			DeclareField(via_clock);
+			DeclareField(real_time_clock);
+			DeclareField(keyboard_clock);
+			DeclareField(time_since_video_update);
+			DeclareField(time_until_video_event);
+		}
+	}
+};
+
+}
@@ -195,3 +195,28 @@ void Video::set_ram(uint16_t *ram, uint32_t mask) {
 	ram_ = ram;
 	ram_mask_ = mask;
 }
+
+// MARK: - State
+
+Video::State::State() {
+	if(needs_declare()) {
+		DeclareField(frame_position);
+		DeclareField(video_address);
+		DeclareField(audio_address);
+	}
+}
+
+Video::State::State(const Video &source) : State() {
+	frame_position = source.frame_position_.as_integral();
+	video_address = uint32_t(source.video_address_);
+	audio_address = uint32_t(source.audio_address_);
+}
+
+void Video::State::apply(Video &target) const {
+	target.frame_position_ = HalfCycles(frame_position);
+	target.video_address_ = video_address;
+	target.audio_address_ = audio_address;
+
+	// Any line of pixels in progress is abandoned; it'll be completed as blank.
+	target.pixel_buffer_ = nullptr;
+}
@@ -10,6 +10,7 @@
 
 #include "../../../Outputs/CRT/CRT.hpp"
 #include "../../../ClockReceiver/ClockReceiver.hpp"
+#include "../../../Reflection/Struct.hpp"
 #include "DeferredAudio.hpp"
 #include "DriveSpeedAccumulator.hpp"
 
@@ -81,6 +82,20 @@ class Video {
 		*/
 		HalfCycles next_sequence_point();
 
+		/*!
+			Captures the raster position and fetch addresses; buffer selection is
+			owned by the VIA so is not included, nor is output already posted to the CRT.
+		*/
+		struct State: public Reflection::StructImpl<State> {
+			int64_t frame_position = 0;
+			uint32_t video_address = 0;
+			uint32_t audio_address = 0;
+
+			State();
+			State(const Video &);
+			void apply(Video &) const;
+		};
+
 	private:
 		DeferredAudio &audio_;
 		DriveSpeedAccumulator &drive_speed_accumulator_;
@@ -23,7 +23,10 @@ class Bus {
 	public:
 		Bus() :
 			tia_sound_(audio_queue_),
-			speaker_(tia_sound_) {}
+			speaker_(tia_sound_) {
+			// The TIA changes level only rarely relative to its clock, so steps are much cheaper than filtering.
+			speaker_.set_band_limited_steps_enabled(true);
+		}
 
 		virtual ~Bus() {
 			audio_queue_.flush();
@@ -38,7 +41,8 @@ class Bus {
 		PIA mos6532_;
 		TIA tia_;
 
-		Concurrency::AsyncTaskQueue<false> audio_queue_;
+		// Single producer: only TIA register writes, made as the CPU runs, enqueue to this.
+		Concurrency::SingleProducerTaskQueue audio_queue_;
 		TIASound tia_sound_;
 		Outputs::Speaker::PullLowpass<TIASound> speaker_;
 
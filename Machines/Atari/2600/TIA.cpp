@@ -214,6 +214,7 @@ void TIA::set_colour_palette_entry(size_t index, uint8_t colour) {
 		}
 	}
 
+	line_colours_are_valid_ = false;
 	colour_palette_[index].original = colour;
 	uint8_t *target = reinterpret_cast<uint8_t *>(&colour_palette_[index].luminance_phase);
 	target[0] = luminance;
@@ -254,6 +255,7 @@ void TIA::set_playfield_control_and_ball_size(uint8_t value) {
 	}
 
 	ball_.size = 1 << ((value >> 4)&3);
+	line_colours_are_valid_ = false;
 }
 
 void TIA::set_playfield_ball_colour(uint8_t colour) {
@@ -468,13 +470,20 @@ void TIA::output_for_cycles(int number_of_cycles) {
 			pixel_target_ = reinterpret_cast<uint16_t *>(crt_.begin_data(160));
 		}
 
-		// convert that into pixels
-		if(pixel_target_) output_pixels(output_cursor, horizontal_counter_);
+		if(output_cursor == first_pixel_cycle && horizontal_counter_ == cycles_per_line) {
+			// This run covers the entire visible portion of the line, so no register can
+			// have been written during it.
+			output_visible_line();
+			output_cursor = horizontal_counter_;
+		} else {
+			// convert that into pixels
+			if(pixel_target_) output_pixels(output_cursor, horizontal_counter_);
 
-		// accumulate collision flags
-		while(output_cursor < horizontal_counter_) {
-			collision_flags_ |= collision_flags_by_buffer_vaules_[collision_buffer_[output_cursor - first_pixel_cycle]];
-			output_cursor++;
+			// accumulate collision flags
+			while(output_cursor < horizontal_counter_) {
+				collision_flags_ |= collision_flags_by_buffer_vaules_[collision_buffer_[output_cursor - first_pixel_cycle]];
+				output_cursor++;
+			}
 		}
 
 		if(horizontal_counter_ == cycles_per_line) {
@@ -526,6 +535,51 @@ void TIA::output_pixels(int start, int end) {
 	}
 }
 
+void TIA::output_visible_line() {
+	if(!line_colours_are_valid_) {
+		ColourMode modes[2];
+		switch(playfield_priority_) {
+			default:							modes[0] = modes[1] = ColourMode::Standard;							break;
+			case PlayfieldPriority::OnTop:		modes[0] = modes[1] = ColourMode::OnTop;							break;
+			case PlayfieldPriority::Score:		modes[0] = ColourMode::ScoreLeft; modes[1] = ColourMode::ScoreRight;	break;
+		}
+
+		for(int side = 0; side < 2; side++) {
+			for(int c = 0; c < 64; c++) {
+				line_colours_[side][c] = colour_palette_[colour_mask_by_mode_collision_flags_[int(modes[side])][c]].luminance_phase;
+			}
+		}
+		line_colours_are_valid_ = true;
+	}
+
+	// Note which collision buffer values occur, for a single collision flag update at the end.
+	uint64_t values_present = 0;
+	if(pixel_target_) {
+		for(int side = 0; side < 2; side++) {
+			const uint16_t *const colours = line_colours_[side];
+			for(int c = side * 80; c < (side + 1) * 80; c++) {
+				const uint8_t buffer_value = collision_buffer_[c];
+				values_present |= uint64_t(1) << buffer_value;
+				pixel_target_[c] = colours[buffer_value];
+			}
+		}
+
+		if(horizontal_blank_extend_) {
+			std::fill(pixel_target_, pixel_target_ + 8, 0xff00);	// TODO: this assumes little endianness.
+		}
+	} else {
+		for(int c = 0; c < 160; c++) {
+			values_present |= uint64_t(1) << collision_buffer_[c];
+		}
+	}
+
+	for(int c = 0; values_present; c++, values_present >>= 1) {
+		if(values_present & 1) {
+			collision_flags_ |= collision_flags_by_buffer_vaules_[c];
+		}
+	}
+}
+
 void TIA::output_line() {
 	switch(output_mode_) {
 		default:
@@ -309,6 +309,13 @@ class TIA {
 		int pixels_start_location_ = 0;
 		uint16_t *pixel_target_ = nullptr;
 		inline void output_pixels(int start, int end);
+
+		// Lines with no register writes during their visible portion are resolved in
+		// a single pass, using a per-line mapping from collision buffer values directly
+		// to output colours for the left and right halves of the display.
+		uint16_t line_colours_[2][64];
+		bool line_colours_are_valid_ = false;
+		inline void output_visible_line();
 };
 
 }
@@ -19,7 +19,7 @@ constexpr int CPUTicksPerAudioTick = 2;
 
 class TIASound: public Outputs::Speaker::BufferSource<TIASound, false> {
 	public:
-		TIASound(Concurrency::AsyncTaskQueue<false> &audio_queue);
+		TIASound(Concurrency::SingleProducerTaskQueue &audio_queue);
 
 		void set_volume(int channel, uint8_t volume);
 		void set_divider(int channel, uint8_t divider);
@@ -30,8 +30,12 @@ class TIASound: public Outputs::Speaker::BufferSource<TIASound, false> {
 		void apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target);
 		void set_sample_volume_range(std::int16_t range);
 
+		static constexpr bool has_band_limited_steps = true;
+		template <typename TargetT>
+		void apply_steps(std::size_t number_of_samples, TargetT &target);
+
 	private:
-		Concurrency::AsyncTaskQueue<false> &audio_queue_;
+		Concurrency::SingleProducerTaskQueue &audio_queue_;
 
 		uint8_t volume_[2];
 		uint8_t divider_[2];
@@ -44,6 +48,9 @@ class TIASound: public Outputs::Speaker::BufferSource<TIASound, false> {
 
 		int divider_counter_[2];
 		int16_t per_channel_volume_ = 0;
+		Outputs::Speaker::MonoSample last_level_ = 0;
+
+		Outputs::Speaker::MonoSample next_sample();
 };
 
 }
@@ -436,6 +436,15 @@ class ConcreteMachine:
 			return HalfCycles(0);
 		}
 
+		template <typename Microcycle> uint8_t *fixed_timing_memory(const Microcycle &cycle, int) {
+			// ROM isn't subject to the DTack alignment rule that applies to RAM, so reads from it have fixed timing.
+			if(!(cycle.operation & CPU::MC68000::Operation::Read)) return nullptr;
+
+			const auto address = cycle.host_endian_byte_address();
+			if(memory_map_[address >> 16] != BusDevice::ROM) return nullptr;
+			return &rom_[address - rom_start_];
+		}
+
 		void reinstall_rom_vector() {
 			std::copy(rom_.begin(), rom_.begin() + 8, ram_.begin());
 		}
@@ -502,7 +511,7 @@ class ConcreteMachine:
 			speaker_.run_for(audio_queue_, cycles_since_audio_update_.divide_cycles(Cycles(4)));
 		}
 
-		CPU::MC68000::Processor<ConcreteMachine, true, true> mc68000_;
+		CPU::MC68000::Processor<ConcreteMachine, true, true, false, true> mc68000_;
 		HalfCycles bus_phase_;
 
 		JustInTimeActor<Video> video_;
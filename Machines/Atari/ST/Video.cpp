@@ -9,6 +9,7 @@
 #include "Video.hpp"
 
 #include "../../../Outputs/Log.hpp"
+#include "../../../Numeric/PlanarToChunky.hpp"
 
 #include <algorithm>
 #include <cstring>
@@ -690,46 +691,62 @@ void Video::VideoStream::output_pixels(int duration) {
 		int pixels_to_draw = std::min(allocation_size - pixel_pointer_, pixels);
 		pixels -= pixels_to_draw;
 
-		switch(bpp_) {
-			case OutputBpp::One:
-				while(pixels_to_draw--) {
-					pixel_buffer_[pixel_pointer_] = ((output_shifter_ >> 63) & 1) * 0xffff;
-					output_shifter_ <<= 1;
+		// Convert at most sixteen pixels at a time, that being the width of each plane
+		// word. The shifter then moves by however many pixels were drawn.
+		uint8_t indices[16];
+		while(pixels_to_draw) {
+			const int chunk = std::min(16, pixels_to_draw);
+			uint16_t *const target = &pixel_buffer_[pixel_pointer_];
+
+			switch(bpp_) {
+				case OutputBpp::One: {
+					static constexpr uint16_t monochrome[] = {0x0000, 0xffff};
+					const uint16_t plane = uint16_t(output_shifter_ >> 48);
+					Numeric::planar_to_chunky<1>(&plane, indices);
+					Numeric::map_palette(indices, size_t(chunk), monochrome, target);
+
+					output_shifter_ <<= chunk;
+				} break;
+
+				case OutputBpp::Two: {
+					// Each of the top two words is fed from the word 32 bits below it.
+					uint32_t streams[2] = {
+						uint32_t(((output_shifter_ >> 32) & 0xffff'0000) | ((output_shifter_ >> 16) & 0xffff)),
+						uint32_t(((output_shifter_ >> 16) & 0xffff'0000) | (output_shifter_ & 0xffff)),
+					};
+					const uint16_t planes[] = {uint16_t(streams[0] >> 16), uint16_t(streams[1] >> 16)};
+					Numeric::planar_to_chunky<2>(planes, indices);
+					Numeric::map_palette(indices, size_t(chunk), palette_, target);
+
+					streams[0] <<= chunk;
+					streams[1] <<= chunk;
+					output_shifter_ =
+						(uint64_t(streams[0] & 0xffff'0000) << 32) |
+						(uint64_t(streams[1] & 0xffff'0000) << 16) |
+						(uint64_t(streams[0] & 0xffff) << 16) |
+						uint64_t(streams[1] & 0xffff);
+				} break;
+
+				case OutputBpp::Four: {
+					const uint16_t planes[] = {
+						uint16_t(output_shifter_ >> 48),
+						uint16_t(output_shifter_ >> 32),
+						uint16_t(output_shifter_ >> 16),
+						uint16_t(output_shifter_),
+					};
+					Numeric::planar_to_chunky<4>(planes, indices);
+					if(chunk == 16) {
+						Numeric::map_palette16(indices, palette_, target);
+						output_shifter_ = 0;
+					} else {
+						Numeric::map_palette(indices, size_t(chunk), palette_, target);
+						output_shifter_ = (output_shifter_ << chunk) & (0x0001'0001'0001'0001 * uint16_t(0xffff << chunk));
+					}
+				} break;
+			}
 
-					++pixel_pointer_;
-				}
-			break;
-
-			case OutputBpp::Two:
-				while(pixels_to_draw--) {
-					pixel_buffer_[pixel_pointer_] = palette_[
-						((output_shifter_ >> 63) & 1) |
-						((output_shifter_ >> 46) & 2)
-					];
-					// This ensures that the top two words shift one to the left;
-					// their least significant bits are fed from the most significant bits
-					// of the bottom two words, respectively.
-					shifter_halves_[upper] = (shifter_halves_[upper] << 1) & 0xfffefffe;
-					shifter_halves_[upper] |= (shifter_halves_[upper^1] & 0x80008000) >> 15;
-					shifter_halves_[upper^1] = (shifter_halves_[upper^1] << 1) & 0xfffefffe;
-
-					++pixel_pointer_;
-				}
-			break;
-
-			case OutputBpp::Four:
-				while(pixels_to_draw--) {
-					pixel_buffer_[pixel_pointer_] = palette_[
-						((output_shifter_ >> 63) & 1) |
-						((output_shifter_ >> 46) & 2) |
-						((output_shifter_ >> 29) & 4) |
-						((output_shifter_ >> 12) & 8)
-					];
-					output_shifter_ = (output_shifter_ << 1) & 0xfffefffefffefffe;
-
-					++pixel_pointer_;
-				}
-			break;
+			pixel_pointer_ += chunk;
+			pixels_to_draw -= chunk;
 		}
 
 		// Check whether the limit has been reached.
@@ -124,7 +124,7 @@ class Video {
 		Range get_memory_access_range();
 
 	private:
-		DeferredQueue<HalfCycles> deferrer_;
+		FixedDeferredQueue<HalfCycles> deferrer_;
 
 		Outputs::CRT::CRT crt_;
 		RangeObserver *range_observer_ = nullptr;
@@ -12,7 +12,7 @@ using namespace Enterprise::Dave;
 
 // MARK: - Audio generator
 
-Audio::Audio(Concurrency::AsyncTaskQueue<false> &audio_queue) :
+Audio::Audio(Concurrency::SingleProducerTaskQueue &audio_queue) :
 	audio_queue_(audio_queue) {}
 
 void Audio::write(uint16_t address, uint8_t value) {
@@ -63,9 +63,9 @@ void Audio::write(uint16_t address, uint8_t value) {
 }
 
 void Audio::set_sample_volume_range(int16_t range) {
-	audio_queue_.enqueue([range, this] {
-		volume_ = range / (63*4);
-	});
+	// This may be called from any thread, so is applied directly rather than
+	// via the audio queue, which accepts actions only from the emulation thread.
+	volume_.store(int16_t(range / (63*4)), std::memory_order_relaxed);
 }
 
 void Audio::update_channel(int c) {
@@ -102,13 +102,14 @@ void Audio::update_channel(int c) {
 template <Outputs::Speaker::Action action>
 void Audio::apply_samples(std::size_t number_of_samples, Outputs::Speaker::StereoSample *target) {
 	Outputs::Speaker::StereoSample output_level;
+	const int16_t volume = volume_.load(std::memory_order_relaxed);
 
 	size_t c = 0;
 	while(c < number_of_samples) {
 		// I'm unclear on the details of the time division multiplexing so,
 		// for now, just sum the outputs.
 		output_level.left =
-			volume_ *
+			volume *
 				(use_direct_output_[0] ?
 					channels_[0].amplitude[0]
 					: (
@@ -119,7 +120,7 @@ void Audio::apply_samples(std::size_t number_of_samples, Outputs::Speaker::Stere
 				));
 
 		output_level.right =
-			volume_ *
+			volume *
 				(use_direct_output_[1] ?
 					channels_[0].amplitude[1]
 					: (
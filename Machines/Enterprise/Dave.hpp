@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
@@ -28,7 +29,7 @@ enum class Interrupt: uint8_t {
 */
 class Audio: public Outputs::Speaker::BufferSource<Audio, true> {
 	public:
-		Audio(Concurrency::AsyncTaskQueue<false> &audio_queue);
+		Audio(Concurrency::SingleProducerTaskQueue &audio_queue);
 
 		/// Modifies an register in the audio range; only the low 4 bits are
 		/// used for register decoding so it's assumed that the caller has
@@ -41,7 +42,7 @@ class Audio: public Outputs::Speaker::BufferSource<Audio, true> {
 		void apply_samples(std::size_t number_of_samples, Outputs::Speaker::StereoSample *target);
 
 	private:
-		Concurrency::AsyncTaskQueue<false> &audio_queue_;
+		Concurrency::SingleProducerTaskQueue &audio_queue_;
 
 		// Global divider (i.e. 8MHz/12Mhz switch).
 		uint8_t global_divider_;
@@ -98,8 +99,9 @@ class Audio: public Outputs::Speaker::BufferSource<Audio, true> {
 
 		bool use_direct_output_[2]{};
 
-		// Global volume, per SampleSource obligations.
-		int16_t volume_ = 0;
+		// Global volume, per SampleSource obligations. This is set from whichever
+		// thread adjusts the speaker, so is atomic rather than queued.
+		std::atomic<int16_t> volume_ = 0;
 
 		// Polynomials that are always running.
 		Numeric::LFSRv<0xc> poly4_;
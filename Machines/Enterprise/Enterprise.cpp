@@ -708,7 +708,9 @@ template <bool has_disk_controller, bool is_6mhz> class ConcreteMachine:
 		bool previous_nick_interrupt_line_ = false;
 		// Cf. timing guesses above.
 
-		Concurrency::AsyncTaskQueue<false> audio_queue_;
+		// Single producer: only Dave port writes, made as the CPU runs, enqueue to this; Dave's
+		// set_sample_volume_range deliberately doesn't.
+		Concurrency::SingleProducerTaskQueue audio_queue_;
 		Dave::Audio dave_audio_;
 		Outputs::Speaker::PullLowpass<Dave::Audio> speaker_;
 		HalfCycles time_since_audio_update_;
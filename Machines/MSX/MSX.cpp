@@ -142,7 +142,10 @@ template <> struct Speaker<false> {
 		audio_toggle(audio_queue),
 		scc(audio_queue),
 		mixer(ay, audio_toggle, scc),
-		speaker(mixer) {}
+		speaker(mixer) {
+		// Without an OPLL, every source can describe itself as steps.
+		speaker.set_band_limited_steps_enabled(true);
+	}
 
 	Concurrency::AsyncTaskQueue<false> audio_queue;
 	GI::AY38910::AY38910<false> ay;
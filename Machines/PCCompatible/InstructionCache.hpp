@@ -0,0 +1,64 @@
+//
+//  InstructionCache.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace PCCompatible {
+
+/*!
+	A direct-mapped cache of decoded instructions, keyed by linear address.
+
+	Each entry records the generation of the memory page that it was decoded from, and is considered
+	valid only while that generation is unchanged. Instructions that straddle a page boundary
+	are not cached.
+*/
+template <typename InstructionT, int page_shift>
+class InstructionCache {
+	public:
+		using Decoded = std::pair<int, InstructionT>;
+
+		/// @returns The cached decoding of the instruction at @c address if there is one that is
+		/// still current for page generation @c generation; @c nullptr otherwise.
+		const Decoded *find(uint32_t address, uint64_t generation) const {
+			const Entry &entry = entries_[address & (Size - 1)];
+			if(entry.address == address && entry.generation == generation) {
+				return &entry.decoded;
+			}
+			return nullptr;
+		}
+
+		/// Stores @c decoded as the decoding of the instruction at @c address, found within
+		/// a page of generation @c generation.
+		void insert(uint32_t address, uint64_t generation, const Decoded &decoded) {
+			if(decoded.first <= 0 || (address >> page_shift) != ((address + uint32_t(decoded.first) - 1) >> page_shift)) {
+				return;
+			}
+
+			Entry &entry = entries_[address & (Size - 1)];
+			entry.address = address;
+			entry.generation = generation;
+			entry.decoded = decoded;
+		}
+
+	private:
+		static constexpr uint32_t Size = 8192;
+		static constexpr uint32_t NoAddress = 0xffff'ffff;
+
+		struct Entry {
+			uint32_t address = NoAddress;
+			uint64_t generation = 0;
+			Decoded decoded{};
+		};
+		std::array<Entry, Size> entries_;
+};
+
+}
@@ -56,6 +56,13 @@ struct Memory {
 		// Accesses an address based on physical location.
 		template <typename IntT, AccessType type>
 		typename InstructionSet::x86::Accessor<IntT, type>::type access(uint32_t address) {
+			if constexpr (is_writeable(type)) {
+				did_write(address);
+				if constexpr (std::is_same_v<IntT, uint16_t>) {
+					did_write(address + 1);
+				}
+			}
+
 			// Dispense with the single-byte case trivially.
 			if constexpr (std::is_same_v<IntT, uint8_t>) {
 				return memory[address];
@@ -70,6 +77,8 @@ struct Memory {
 		void write_back() {
 			if constexpr (std::is_same_v<IntT, uint16_t>) {
 				if(write_back_address_[0] != NoWriteBack) {
+					did_write(write_back_address_[0]);
+					did_write(write_back_address_[1]);
 					memory[write_back_address_[0]] = write_back_value_ & 0xff;
 					memory[write_back_address_[1]] = write_back_value_ >> 8;
 					write_back_address_[0]  = 0;
@@ -84,18 +93,26 @@ struct Memory {
 		void preauthorised_write(InstructionSet::x86::Source segment, uint16_t offset, IntT value) {
 			// Bytes can be written without further ado.
 			if constexpr (std::is_same_v<IntT, uint8_t>) {
-				memory[address(segment, offset) & 0xf'ffff] = value;
+				const uint32_t target = address(segment, offset) & 0xf'ffff;
+				did_write(target);
+				memory[target] = value;
 				return;
 			}
 
 			// Words that straddle the segment end must be split in two.
 			if(offset == 0xffff) {
-				memory[address(segment, offset) & 0xf'ffff] = value & 0xff;
-				memory[address(segment, 0x0000) & 0xf'ffff] = value >> 8;
+				const uint32_t low = address(segment, offset) & 0xf'ffff;
+				const uint32_t high = address(segment, 0x0000) & 0xf'ffff;
+				did_write(low);
+				did_write(high);
+				memory[low] = value & 0xff;
+				memory[high] = value >> 8;
 				return;
 			}
 
 			const uint32_t target = address(segment, offset) & 0xf'ffff;
+			did_write(target);
+			did_write(target + 1);
 
 			// Words that straddle the end of physical RAM must also be split in two.
 			if(target == 0xf'ffff) {
@@ -120,13 +137,33 @@ struct Memory {
 			return std::make_pair(memory.data(), 0x10'000);
 		}
 
+		//
+		// Write tracking, for the benefit of anything that caches derived forms of memory contents,
+		// such as decoded instructions. Each page's generation is incremented upon every write to it.
+		//
+		static constexpr int PageShift = 8;
+		static constexpr uint32_t PageSize = 1 << PageShift;
+
+		uint64_t generation(uint32_t address) const {
+			return generations_[(address & 0xf'ffff) >> PageShift];
+		}
+
 		//
 		// External access.
 		//
 		void install(size_t address, const uint8_t *data, size_t length) {
 			std::copy(data, data + length, memory.begin() + std::vector<uint8_t>::difference_type(address));
+			for(size_t page = address >> PageShift; page <= (address + length - 1) >> PageShift; page++) {
+				++generations_[page];
+			}
 		}
 
+		void write(uint32_t address, uint8_t value) {
+			did_write(address);
+			memory[address] = value;
+		}
+
+		// Provides direct access to memory; writes via this pointer are not tracked.
 		uint8_t *at(uint32_t address) {
 			return &memory[address];
 		}
@@ -135,6 +172,11 @@ struct Memory {
 		std::array<uint8_t, 1024*1024> memory{0xff};
 		Registers &registers_;
 		const Segments &segments_;
+		std::array<uint64_t, ((1024*1024) >> PageShift)> generations_{};
+
+		void did_write(uint32_t address) {
+			++generations_[(address & 0xf'ffff) >> PageShift];
+		}
 
 		uint32_t segment_base(InstructionSet::x86::Source segment) {
 			using Source = InstructionSet::x86::Source;
@@ -10,6 +10,7 @@
 
 #include "CGA.hpp"
 #include "DMA.hpp"
+#include "InstructionCache.hpp"
 #include "KeyboardMapper.hpp"
 #include "MDA.hpp"
 #include "Memory.hpp"
@@ -44,8 +45,10 @@
 
 #include "../../Analyser/Static/PCCompatible/Target.hpp"
 
+#include <algorithm>
 #include <array>
 #include <iostream>
+#include <limits>
 
 namespace PCCompatible {
 
@@ -380,6 +383,11 @@ class KeyboardController {
 			}
 		}
 
+		/// @returns The number of ticks until this controller will next act of its own accord.
+		int ticks_until_event() const {
+			return reset_delay_ > 0 ? reset_delay_ : std::numeric_limits<int>::max();
+		}
+
 		void run_for(Cycles cycles) {
 			if(reset_delay_ <= 0) {
 				return;
@@ -430,7 +438,10 @@ class KeyboardController {
 struct PCSpeaker {
 	PCSpeaker() :
 		toggle(queue),
-		speaker(toggle) {}
+		speaker(toggle) {
+		// A toggle is nothing but steps, so this is far cheaper than filtering at the PIT rate.
+		speaker.set_band_limited_steps_enabled(true);
+	}
 
 	void update() {
 		speaker.run_for(queue, cycles_since_update);
@@ -596,10 +607,21 @@ class IO {
 		IO(PIT &pit, DMA &dma, PPI &ppi, PIC &pic, typename Adaptor<video>::type &card, FloppyController &fdc, RTC &rtc) :
 			pit_(pit), dma_(dma), ppi_(ppi), pic_(pic), video_(card), fdc_(fdc), rtc_(rtc) {}
 
+		struct Delegate {
+			/// Called prior to any port access, giving the opportunity to bring hardware up to date.
+			virtual void io_will_access_port() = 0;
+			/// Called after any port write, which may have changed when hardware will next act.
+			virtual void io_did_write_port() = 0;
+		};
+		void set_delegate(Delegate *delegate) {
+			delegate_ = delegate;
+		}
+
 		template <typename IntT> void out(uint16_t port, IntT value) {
 			static constexpr uint16_t crtc_base =
 				video == Target::VideoAdaptor::MDA ? 0x03b0 : 0x03d0;
 
+			if(delegate_) delegate_->io_will_access_port();
 			switch(port) {
 				default:
 					if constexpr (std::is_same_v<IntT, uint8_t>) {
@@ -710,8 +732,10 @@ class IO {
 					// Ignore serial port accesses.
 				break;
 			}
+			if(delegate_) delegate_->io_did_write_port();
 		}
 		template <typename IntT> IntT in([[maybe_unused]] uint16_t port) {
+			if(delegate_) delegate_->io_will_access_port();
 			switch(port) {
 				default:
 					printf("Unhandled in: %04x\n", port);
@@ -795,6 +819,8 @@ class IO {
 		}
 
 	private:
+		Delegate *delegate_ = nullptr;
+
 		PIT &pit_;
 		DMA &dma_;
 		PPI &ppi_;
@@ -866,7 +892,8 @@ class ConcreteMachine:
 	public MachineTypes::MediaTarget,
 	public MachineTypes::ScanProducer,
 	public Activity::Source,
-	public Configurable::Device
+	public Configurable::Device,
+	public IO<video>::Delegate
 {
 		static constexpr int DriveCount = 1;
 		using Video = typename Adaptor<video>::type;
@@ -884,8 +911,12 @@ class ConcreteMachine:
 			ppi_(ppi_handler_),
 			context(pit_, dma_, ppi_, pic_, video_, fdc_, rtc_)
 		{
-			// Capture speed.
+			// Capture speed; at unlimited speed, hardware is brought up to date only as and when the CPU
+			// might observe it.
 			speed_ = target.speed;
+			if(speed_ == Target::Speed::Unlimited) {
+				context.io.set_delegate(this);
+			}
 
 			// Set up DMA source/target.
 			dma_.set_memory(&context.memory);
@@ -933,9 +964,68 @@ class ConcreteMachine:
 			switch(speed_) {
 				case Target::Speed::ApproximatelyOriginal:	run_for<Target::Speed::ApproximatelyOriginal>(duration);	break;
 				case Target::Speed::Fast: 					run_for<Target::Speed::Fast>(duration);						break;
+				case Target::Speed::Unlimited:				run_unlimited(duration);									break;
 			}
 		}
 
+		/// At unlimited speed, each instruction is charged 1/InstructionsPerTick of a PIT tick.
+		static constexpr int InstructionsPerTick = 32;
+
+		/// Runs the CPU freely, charging each instruction a fraction of a PIT tick. All other hardware is
+		/// caught up lazily: only when the CPU accesses a port, or when the time charged reaches the next
+		/// event horizon, i.e. the next point at which the PIT might signal an interrupt or toggle the speaker,
+		/// or at which the keyboard might post a code. While the CPU is halted nothing can change before
+		/// that horizon, so time proceeds directly to it.
+		void run_unlimited(const Cycles duration) {
+			unlimited_ticks_remaining_ += duration.as<int>();
+			set_unlimited_horizon();
+
+			while(unlimited_ticks_remaining_) {
+				while(unlimited_instructions_ < unlimited_horizon_) {
+					poll_interrupts();
+					if(context.flow_controller.halted()) {
+						unlimited_instructions_ = unlimited_horizon_;
+						break;
+					}
+					perform_instruction();
+					++unlimited_instructions_;
+				}
+				catch_up_unlimited();
+			}
+		}
+
+		/// Advances all hardware other than the CPU by the whole PIT ticks charged since it was last brought up to date.
+		void catch_up_unlimited() {
+			const int ticks = unlimited_instructions_ / InstructionsPerTick;
+			if(!ticks) {
+				return;
+			}
+			unlimited_instructions_ %= InstructionsPerTick;
+			unlimited_ticks_remaining_ -= ticks;
+
+			// Nothing observable by the CPU can occur other than in the final tick.
+			speaker_.cycles_since_update += Cycles(ticks - 1);
+			pit_.run_for(ticks);
+			++speaker_.cycles_since_update;
+			video_.run_for(Cycles(ticks));
+			keyboard_.run_for(Cycles(ticks));
+
+			set_unlimited_horizon();
+		}
+
+		/// Sets the number of instructions the CPU may perform before hardware next must be brought up to date.
+		void set_unlimited_horizon() {
+			// PIT channel 1 is omitted because its output is connected to nothing. The PIC needs no
+			// horizon of its own: it changes state only upon edges from PIT channel 0 and the keyboard,
+			// which are included, and from the FDC, which signals only in response to port accesses.
+			unlimited_horizon_ = InstructionsPerTick * std::min({
+				unlimited_ticks_remaining_,
+				pit_.ticks_until_output_change<0>(),
+				pit_.ticks_until_output_change<2>(),
+				keyboard_.ticks_until_event(),
+			});
+		}
+
 		template <Target::Speed speed>
 		void run_for(const Cycles duration) {
 			const auto pit_ticks = duration.as<int>();
@@ -986,20 +1076,7 @@ class ConcreteMachine:
 				//
 
 				// Query for interrupts and apply if pending.
-				if(pic_.pending() && context.flags.template flag<InstructionSet::x86::Flag::Interrupt>()) {
-					// Regress the IP if a REP is in-progress so as to resume it later.
-					if(context.flow_controller.should_repeat()) {
-						context.registers.ip() = decoded_ip_;
-						context.flow_controller.begin_instruction();
-					}
-
-					// Signal interrupt.
-					context.flow_controller.unhalt();
-					InstructionSet::x86::interrupt(
-						pic_.acknowledge(),
-						context
-					);
-				}
+				poll_interrupts();
 
 				// Do nothing if currently halted.
 				if(context.flow_controller.halted()) {
@@ -1025,19 +1102,45 @@ class ConcreteMachine:
 			}
 		}
 
+		void poll_interrupts() {
+			if(pic_.pending() && context.flags.template flag<InstructionSet::x86::Flag::Interrupt>()) {
+				// Regress the IP if a REP is in-progress so as to resume it later.
+				if(context.flow_controller.should_repeat()) {
+					context.registers.ip() = decoded_ip_;
+					context.flow_controller.begin_instruction();
+				}
+
+				// Signal interrupt.
+				context.flow_controller.unhalt();
+				InstructionSet::x86::interrupt(
+					pic_.acknowledge(),
+					context
+				);
+			}
+		}
+
 		void perform_instruction() {
 			// Get the next thing to execute.
 			if(!context.flow_controller.should_repeat()) {
-				// Decode from the current IP.
+				// Use a cached decoding of the current IP if one is available.
 				decoded_ip_ = context.registers.ip();
-				const auto remainder = context.memory.next_code();
-				decoded = decoder.decode(remainder.first, remainder.second);
-
-				// If that didn't yield a whole instruction then the end of memory must have been hit;
-				// continue from the beginning.
-				if(decoded.first <= 0) {
-					const auto all = context.memory.all();
-					decoded = decoder.decode(all.first, all.second);
+				const uint32_t linear_ip = (context.segments.cs_base_ + decoded_ip_) & 0xf'ffff;
+				const uint64_t generation = context.memory.generation(linear_ip);
+				if(const auto cached = instruction_cache_.find(linear_ip, generation); cached) {
+					decoded = *cached;
+				} else {
+					// Otherwise decode from the current IP.
+					const auto remainder = context.memory.next_code();
+					decoded = decoder.decode(remainder.first, remainder.second);
+
+					// If that didn't yield a whole instruction then the end of memory must have been hit;
+					// continue from the beginning.
+					if(decoded.first <= 0) {
+						const auto all = context.memory.all();
+						decoded = decoder.decode(all.first, all.second);
+					} else {
+						instruction_cache_.insert(linear_ip, generation, decoded);
+					}
 				}
 
 				context.registers.ip() += decoded.first;
@@ -1072,6 +1175,14 @@ class ConcreteMachine:
 			);
 		}
 
+		// MARK: - IO::Delegate.
+		void io_will_access_port() final {
+			catch_up_unlimited();
+		}
+		void io_did_write_port() final {
+			set_unlimited_horizon();
+		}
+
 		// MARK: - ScanProducer.
 		void set_scan_target(Outputs::Display::ScanTarget *scan_target) override {
 			video_.set_scan_target(scan_target);
@@ -1181,16 +1292,18 @@ class ConcreteMachine:
 			static constexpr auto model = InstructionSet::x86::Model::i8086;
 		} context;
 
-		// TODO: eliminate use of Decoder8086 and Decoder8086 in gneral in favour of the templated version, as soon
-		// as whatever error is preventing GCC from picking up Decoder's explicit instantiations becomes apparent.
-		InstructionSet::x86::Decoder8086 decoder;
-//		InstructionSet::x86::Decoder<InstructionSet::x86::Model::i8086> decoder;
+		InstructionSet::x86::Decoder<InstructionSet::x86::Model::i8086> decoder;
 
 		uint16_t decoded_ip_ = 0;
 		std::pair<int, InstructionSet::x86::Instruction<false>> decoded;
+		InstructionCache<InstructionSet::x86::Instruction<false>, Memory::PageShift> instruction_cache_;
 
 		int cpu_divisor_ = 0;
 		Target::Speed speed_{};
+
+		int unlimited_ticks_remaining_ = 0;
+		int unlimited_instructions_ = 0;
+		int unlimited_horizon_ = 0;
 };
 
 
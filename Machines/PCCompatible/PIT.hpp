@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+
 namespace PCCompatible {
 
 template <bool is_8254, typename PITObserver>
@@ -47,6 +50,12 @@ class i8253 {
 			}
 		}
 
+		/// @returns A number of ticks that can definitely elapse before the output of @c channel next changes;
+		/// this may be an underestimate but is never an overestimate.
+		template <int channel> int ticks_until_output_change() const {
+			return channels_[channel].ticks_until_output_change();
+		}
+
 	private:
 		// The target for output changes.
 		PITObserver &observer_;
@@ -190,6 +199,27 @@ class i8253 {
 				}
 			}
 
+			int ticks_until_output_change() const {
+				static constexpr int Never = std::numeric_limits<int>::max();
+				if(gated || awaiting_reload) return Never;
+
+				switch(mode) {
+					case OperatingMode::InterruptOnTerminalCount:
+					case OperatingMode::HardwareRetriggerableOneShot:
+						if(output) return Never;
+					return std::max(int(counter), 1);
+
+					case OperatingMode::SquareWaveGenerator:
+					return std::max(int(counter) >> 1, 1);
+
+					case OperatingMode::RateGenerator:
+					return std::max(int(counter) - 1, 1);
+
+					default:
+					return Never;
+				}
+			}
+
 			template <int channel>
 			void write([[maybe_unused]] PITObserver &observer, uint8_t value) {
 				switch(latch_mode) {
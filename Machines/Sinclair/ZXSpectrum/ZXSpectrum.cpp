@@ -128,6 +128,7 @@ template<Model model> class ConcreteMachine:
 	public MachineTypes::MappedKeyboardMachine,
 	public MachineTypes::MediaTarget,
 	public MachineTypes::ScanProducer,
+	public MachineTypes::StateProducer,
 	public MachineTypes::TimedMachine,
 	public Utility::TypeRecipient<CharacterMapper> {
 	public:
@@ -145,6 +146,7 @@ template<Model model> class ConcreteMachine:
 		{
 			set_clock_rate(clock_rate());
 			speaker_.set_input_rate(float(clock_rate()) / 2.0f);
+			speaker_.set_band_limited_steps_enabled(true);
 
 			ROM::Name rom_name;
 			switch(model) {
@@ -189,25 +191,7 @@ template<Model model> class ConcreteMachine:
 
 			// Install state if supplied.
 			if(target.state) {
-				const auto state = static_cast<State *>(target.state.get());
-				state->z80.apply(z80_);
-				state->video.apply(*video_.last_valid());
-				state->ay.apply(ay_);
-
-				// If this is a 48k or 16k machine, remap source data from its original
-				// linear form to whatever the banks end up being; otherwise copy as is.
-				if(model <= Model::FortyEightK) {
-					const size_t num_banks = std::min(size_t(48*1024), state->ram.size()) >> 14;
-					for(size_t c = 0; c < num_banks; c++) {
-						memcpy(&banks_[c + 1].write[(c+1) * 0x4000], &state->ram[c * 0x4000], 0x4000);
-					}
-				} else {
-					memcpy(ram_.data(), state->ram.data(), std::min(ram_.size(), state->ram.size()));
-
-					port1ffd_ = state->last_1ffd;
-					port7ffd_ = state->last_7ffd;
-					update_memory_map();
-				}
+				install_state(*static_cast<State *>(target.state.get()));
 			}
 		}
 
@@ -737,6 +721,43 @@ template<Model model> class ConcreteMachine:
 			set_use_fast_tape();
 		}
 
+		// MARK: - StateProducer.
+
+		std::unique_ptr<Reflection::Struct> get_state() final {
+			auto state = std::make_unique<State>();
+
+			video_.flush();
+			state->z80 = CPU::Z80::State(z80_);
+			state->video = Video::State(*video_.last_valid());
+			state->ay = GI::AY38910::State(ay_);
+
+			// Store RAM in the same form as a snapshot file would: linear
+			// for a 16kb or 48kb machine, all banks in order otherwise.
+			if(model <= Model::FortyEightK) {
+				const size_t num_banks = model == Model::SixteenK ? 1 : 3;
+				state->ram.resize(num_banks * 0x4000);
+				for(size_t c = 0; c < num_banks; c++) {
+					memcpy(&state->ram[c * 0x4000], &banks_[c + 1].read[(c+1) * 0x4000], 0x4000);
+				}
+			} else {
+				state->ram.assign(ram_.begin(), ram_.end());
+				state->last_7ffd = port7ffd_;
+				state->last_1ffd = port1ffd_;
+			}
+
+			return state;
+		}
+
+		bool set_state(const Reflection::Struct &state) final {
+			const auto spectrum_state = dynamic_cast<const State *>(&state);
+			if(!spectrum_state) return false;
+
+			update_audio();
+			video_.flush();
+			install_state(*spectrum_state);
+			return true;
+		}
+
 		// MARK: - AudioProducer.
 
 		Outputs::Speaker::Speaker *get_speaker() override {
@@ -838,6 +859,29 @@ template<Model model> class ConcreteMachine:
 			banks_[bank].write = ((source < 0x80) ? read : scratch_.data()) - offset;
 		}
 
+		void install_state(const State &state) {
+			state.z80.apply(z80_);
+			state.video.apply(*video_.last_valid());
+			state.ay.apply(ay_);
+
+			// If this is a 48k or 16k machine, remap source data from its original
+			// linear form to whatever the banks end up being; otherwise copy as is.
+			if(model <= Model::FortyEightK) {
+				const size_t num_banks = std::min(size_t(48*1024), state.ram.size()) >> 14;
+				for(size_t c = 0; c < num_banks; c++) {
+					memcpy(&banks_[c + 1].write[(c+1) * 0x4000], &state.ram[c * 0x4000], 0x4000);
+				}
+			} else {
+				memcpy(ram_.data(), state.ram.data(), std::min(ram_.size(), state.ram.size()));
+
+				port1ffd_ = state.last_1ffd;
+				port7ffd_ = state.last_7ffd;
+				disable_paging_ = false;
+				update_memory_map();
+				set_video_address();
+			}
+		}
+
 		void set_video_address() {
 			video_->set_video_source(&ram_[((port7ffd_ & 0x08) ? 7 : 5) * 16384]);
 			update_video_base();
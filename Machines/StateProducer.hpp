@@ -8,16 +8,90 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include "../Analyser/Static/StaticAnalyser.hpp"
+#include <vector>
+
+#include "../Reflection/Struct.hpp"
 
 namespace MachineTypes {
 
+/*!
+	A state producer can capture a snapshot of its current state — CPU, chipset and RAM — and can later
+	be returned to any snapshot it has produced.
+
+	Snapshots are reflective structs, so can be converted to and from BSON via Reflection::Struct::serialise
+	and Reflection::Struct::deserialise. To restore a snapshot from BSON, obtain a state from any machine of the
+	same type and configuration, deserialise into that and pass the result to @c set_state.
+
+	Inserted media, input devices and anything already in flight to the host's display and audio are not
+	part of a snapshot.
+*/
 struct StateProducer {
-	// TODO.
-//	virtual bool get_state(Analyser::Static::State *, [[maybe_unused]] bool advance_to_simple = false) {
-//		return false;
-//	}
-};
+	/*!
+		@returns A snapshot of the current state of this machine, or @c nullptr if no snapshot can be taken
+			right now — e.g. if the processor is partway through an instruction. Running the machine for
+			a short while longer will usually resolve that.
+	*/
+	virtual std::unique_ptr<Reflection::Struct> get_state() = 0;
+
+	/*!
+		Restores the machine to @c state, which should have been produced by a machine of the same type and configuration.
+
+		@returns @c true if the state was applied; @c false if it was of the wrong type.
+	*/
+	virtual bool set_state(const Reflection::Struct &state) = 0;
+
+	/*!
+		A block of memory for which the owning machine records, per page, whether any write has occurred
+		since the flags were last cleared.
+
+		Once @c set_is_external(true) has been called, snapshots from @c get_state omit this memory and @c set_state
+		leaves it untouched; whoever made that call takes over preserving and restoring it, which the dirty flags allow
+		to be done without comparing or copying unmodified pages.
+	*/
+	class TrackedMemory {
+		public:
+			static constexpr size_t PageSize = 4096;
 
+			/// Sets the memory to track, marking all of it as dirty.
+			void set_memory(uint8_t *contents, size_t size) {
+				contents_ = contents;
+				size_ = size;
+				dirty_.assign((size + PageSize - 1) / PageSize, 1);
+			}
+
+			/// Marks the page that contains @c address as dirty.
+			void mark(size_t address) {
+				dirty_[address / PageSize] = 1;
+			}
+
+			bool is_dirty(size_t page) const	{	return dirty_[page];	}
+			void clear_dirty()					{	std::fill(dirty_.begin(), dirty_.end(), 0);	}
+
+			uint8_t *contents() const			{	return contents_;		}
+			size_t size() const					{	return size_;			}
+			size_t page_count() const			{	return dirty_.size();	}
+
+			void set_is_external(bool is_external)	{	is_external_ = is_external;	}
+			bool is_external() const				{	return is_external_;		}
+
+		private:
+			uint8_t *contents_ = nullptr;
+			size_t size_ = 0;
+			std::vector<uint8_t> dirty_;
+			bool is_external_ = false;
+	};
+
+	/*!
+		@returns This machine's tracked memory, if it has any. Machines with a lot of RAM should
+			track it, so that frequent snapshots needn't copy all of it.
+	*/
+	virtual TrackedMemory *tracked_memory() {
+		return nullptr;
+	}
 };
+
+}
@@ -59,6 +59,11 @@ class TimedMachine {
 			return speed_multiplier_;
 		}
 
+		/// @returns This machine's clock rate.
+		double get_clock_rate() const {
+			return clock_rate_;
+		}
+
 		/// @returns The confidence that this machine is running content it understands.
 		virtual float get_confidence() { return 0.5f; }
 		virtual std::string debug_type() { return ""; }
@@ -82,15 +87,7 @@ class TimedMachine {
 			clock_rate_ = clock_rate;
 		}
 
-		/// Gets this machine's clock rate.
-		double get_clock_rate() const {
-			return clock_rate_;
-		}
-
 	private:
-		// Give the ScanProducer access to this machine's clock rate.
-		friend class ScanProducer;
-
 		double clock_rate_ = 1.0;
 		double clock_conversion_error_ = 0.0;
 		double speed_multiplier_ = 1.0;
@@ -0,0 +1,224 @@
+//
+//  Rewinder.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "Rewinder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+using namespace Utility;
+
+Rewinder::Rewinder(MachineTypes::StateProducer &producer, int interval, size_t capacity) :
+	producer_(producer),
+	memory_(producer.tracked_memory()),
+	interval_(std::max(interval, 1)),
+	capacity_(std::max(capacity, size_t(1))) {
+	if(memory_) {
+		memory_->set_is_external(true);
+	}
+}
+
+Rewinder::~Rewinder() {
+	if(memory_) {
+		memory_->set_is_external(false);
+	}
+}
+
+void Rewinder::advance() {
+	++tick_;
+	if(!(tick_ % uint64_t(interval_))) {
+		capture();
+	}
+}
+
+namespace {
+
+/// @returns The length of the BSON element that begins at @c element, or 0 if it is malformed or of an
+/// unrecognised type.
+size_t element_size(const uint8_t *const element, const uint8_t *const end) {
+	// Skip the type and the name.
+	const uint8_t *value = element + 1;
+	while(value < end && *value) ++value;
+	++value;
+	if(value > end) return 0;
+
+	const auto length = [&]() -> size_t {
+		if(end - value < 4) return 0;
+		return size_t(value[0] | (value[1] << 8) | (value[2] << 16) | (value[3] << 24));
+	};
+
+	size_t value_size;
+	switch(*element) {
+		default: return 0;
+
+		case 0x08:				value_size = 1;				break;	// Boolean.
+		case 0x10:				value_size = 4;				break;	// 32-bit int.
+		case 0x01: case 0x12:	value_size = 8;				break;	// Double or 64-bit int.
+		case 0x02:				value_size = 4 + length();	break;	// String.
+		case 0x03: case 0x04:	value_size = length();		break;	// Document or array.
+		case 0x05:				value_size = 5 + length();	break;	// Binary.
+	}
+
+	const size_t size = size_t(value - element) + value_size;
+	return size <= size_t(end - element) ? size : 0;
+}
+
+}
+
+void Rewinder::capture() {
+	const auto state = producer_.get_state();
+	if(!state) return;
+	state->serialise(bson_);
+	const auto &bson = bson_;
+
+	// If this follows a seek then anything newer than the current tick
+	// describes a future that will no longer happen.
+	while(!snapshots_.empty() && snapshots_.back().tick >= tick_) {
+		snapshots_.pop_back();
+	}
+
+	Snapshot snapshot;
+	snapshot.tick = tick_;
+
+	// Walk the top-level elements, i.e. everything between the document's leading
+	// size and its terminating zero, paging each separately so that a change in the
+	// length of one doesn't disturb the alignment of any other.
+	const Snapshot *const previous = snapshots_.empty() ? nullptr : &snapshots_.back();
+	const uint8_t *const end = bson.data() + bson.size() - 1;
+	const uint8_t *element = bson.data() + 4;
+	while(element < end) {
+		size_t size = element_size(element, end);
+		if(!size) size = size_t(end - element);
+
+		const size_t index = snapshot.fields.size();
+		const Field *const prior = previous && index < previous->fields.size() ? &previous->fields[index] : nullptr;
+
+		Field &field = snapshot.fields.emplace_back();
+		field.reserve((size + PageSize - 1) / PageSize);
+		for(size_t offset = 0; offset < size; offset += PageSize) {
+			const size_t page = offset / PageSize;
+			const size_t length = std::min(PageSize, size - offset);
+
+			// Share the previous snapshot's page if it's unchanged; only changed
+			// pages are copied out of the serialised form.
+			if(
+				prior &&
+				page < prior->size() &&
+				(*prior)[page]->size() == length &&
+				!std::memcmp((*prior)[page]->data(), element + offset, length)
+			) {
+				field.push_back((*prior)[page]);
+				continue;
+			}
+
+			field.push_back(std::make_shared<const Page>(element + offset, element + offset + length));
+		}
+
+		element += size;
+	}
+
+	// Copy only those pages of tracked memory that have been written to since the last
+	// capture or restore; all others are as they were then.
+	if(memory_) {
+		const uint8_t *const contents = memory_->contents();
+		const auto page_size = MachineTypes::StateProducer::TrackedMemory::PageSize;
+		snapshot.memory.reserve(memory_->page_count());
+		for(size_t page = 0; page < memory_->page_count(); page++) {
+			if(!memory_->is_dirty(page) && page < clean_memory_.size()) {
+				snapshot.memory.push_back(clean_memory_[page]);
+				continue;
+			}
+
+			const size_t offset = page * page_size;
+			const size_t length = std::min(page_size, memory_->size() - offset);
+			snapshot.memory.push_back(std::make_shared<const Page>(contents + offset, contents + offset + length));
+		}
+		memory_->clear_dirty();
+		clean_memory_ = snapshot.memory;
+	}
+
+	snapshots_.push_back(std::move(snapshot));
+	while(snapshots_.size() > capacity_) {
+		snapshots_.pop_front();
+	}
+}
+
+std::optional<uint64_t> Rewinder::seek(uint64_t tick) {
+	// Find the first snapshot that is newer than the target, then step back one.
+	const auto newer = std::upper_bound(
+		snapshots_.begin(), snapshots_.end(), tick,
+		[](uint64_t tick, const Snapshot &snapshot) { return tick < snapshot.tick; });
+	if(newer == snapshots_.begin()) return std::nullopt;
+	const Snapshot &snapshot = *std::prev(newer);
+
+	// Reassemble the serialised form: a four-byte size, the fields and a terminating zero.
+	auto &bson = bson_;
+	bson.resize(4);
+	for(const auto &field: snapshot.fields) {
+		for(const auto &page: field) {
+			bson.insert(bson.end(), page->begin(), page->end());
+		}
+	}
+	bson.push_back(0);
+
+	const auto size = uint32_t(bson.size());
+	for(size_t c = 0; c < 4; c++) {
+		bson[c] = uint8_t(size >> (c * 8));
+	}
+
+	// Obtain a state of the proper type to deserialise into, then apply it.
+	const auto state = producer_.get_state();
+	if(!state || !state->deserialise(bson) || !producer_.set_state(*state)) {
+		return std::nullopt;
+	}
+
+	// Restore tracked memory, which isn't part of the serialised state.
+	if(memory_) {
+		uint8_t *const contents = memory_->contents();
+		size_t offset = 0;
+		for(const auto &page: snapshot.memory) {
+			std::copy(page->begin(), page->end(), contents + offset);
+			offset += page->size();
+		}
+		memory_->clear_dirty();
+		clean_memory_ = snapshot.memory;
+	}
+
+	tick_ = snapshot.tick;
+	return tick_;
+}
+
+std::optional<uint64_t> Rewinder::earliest() const {
+	if(snapshots_.empty()) return std::nullopt;
+	return snapshots_.front().tick;
+}
+
+std::optional<uint64_t> Rewinder::latest() const {
+	if(snapshots_.empty()) return std::nullopt;
+	return snapshots_.back().tick;
+}
+
+size_t Rewinder::retained_bytes() const {
+	std::unordered_set<const Page *> counted;
+	size_t total = 0;
+	const auto count = [&](const Field &field) {
+		for(const auto &page: field) {
+			if(counted.insert(page.get()).second) {
+				total += page->size();
+			}
+		}
+	};
+	for(const auto &snapshot: snapshots_) {
+		for(const auto &field: snapshot.fields) {
+			count(field);
+		}
+		count(snapshot.memory);
+	}
+	return total;
+}
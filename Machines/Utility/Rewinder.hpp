@@ -0,0 +1,116 @@
+//
+//  Rewinder.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "../StateProducer.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Utility {
+
+/*!
+	Retains a bounded history of snapshots from a @c MachineTypes::StateProducer, allowing the machine
+	to be returned to any retained point.
+
+	Snapshots are stored as serialised state, divided first into top-level fields and then each field into
+	pages of at most @c PageSize bytes. Each page that is identical to the corresponding page of the same field
+	in the previous snapshot is shared with it rather than copied. Since pages are aligned to field boundaries,
+	a change in the length of one field doesn't disturb the pages of any other, so the marginal cost of a snapshot
+	is proportional to the amount of state that has changed since the last one — for most machines that's a small
+	fraction of RAM.
+
+	If the producer offers @c tracked_memory then that is excluded from serialisation and paged directly instead,
+	with only the pages that it reports as dirty being copied; neither serialisation nor comparison of that memory
+	then occurs.
+
+	Time is measured in ticks of the caller's choosing, usually frames; @c advance should be called once
+	per tick and a snapshot will be captured every @c interval ticks.
+*/
+class Rewinder {
+	public:
+		static constexpr size_t PageSize = 4096;
+
+		/*!
+			@param producer The source of state and the target for restoration.
+			@param interval The number of ticks between automatic snapshots.
+			@param capacity The maximum number of snapshots to retain; once full, the oldest is discarded.
+		*/
+		Rewinder(MachineTypes::StateProducer &producer, int interval, size_t capacity);
+		~Rewinder();
+
+		/// Advances the current tick count by one, capturing a snapshot if one is due.
+		void advance();
+
+		/// Captures a snapshot at the current tick, regardless of interval.
+		void capture();
+
+		/*!
+			Restores the most recent retained snapshot that was captured at or before @c tick, and
+			makes that the current tick.
+
+			Snapshots after that point are retained until the next capture, so that repeated seeks — e.g.
+			in a bisection — don't have to regenerate them.
+
+			@returns The tick that was restored to, or an empty optional if no retained snapshot is old
+				enough or it couldn't be applied.
+		*/
+		std::optional<uint64_t> seek(uint64_t tick);
+
+		/// @returns The current tick count.
+		uint64_t tick() const {
+			return tick_;
+		}
+
+		/// @returns The number of snapshots currently retained.
+		size_t size() const {
+			return snapshots_.size();
+		}
+
+		/// @returns The tick of the oldest retained snapshot, if any.
+		std::optional<uint64_t> earliest() const;
+
+		/// @returns The tick of the newest retained snapshot, if any.
+		std::optional<uint64_t> latest() const;
+
+		/// @returns The total number of bytes of serialised state held across all retained snapshots,
+		/// counting each shared page once.
+		size_t retained_bytes() const;
+
+	private:
+		using Page = std::vector<uint8_t>;
+		using Field = std::vector<std::shared_ptr<const Page>>;
+		struct Snapshot {
+			uint64_t tick;
+			std::vector<Field> fields;
+			Field memory;
+		};
+
+		MachineTypes::StateProducer &producer_;
+		MachineTypes::StateProducer::TrackedMemory *const memory_;
+		const int interval_;
+		const size_t capacity_;
+
+		uint64_t tick_ = 0;
+		std::deque<Snapshot> snapshots_;
+
+		// Serialised state is built here by both capture and seek, so that its storage
+		// is reused rather than reallocated each time.
+		std::vector<uint8_t> bson_;
+
+		// The pages that tracked memory holds wherever it isn't marked as dirty, i.e. those of
+		// whichever snapshot was most recently captured or restored.
+		Field clean_memory_;
+};
+
+}
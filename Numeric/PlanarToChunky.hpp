@@ -0,0 +1,115 @@
+//
+//  PlanarToChunky.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Numeric {
+
+/*!
+	Converts sixteen pixels from planar to chunky form.
+
+	@c planes should point to @c plane_count 16-bit words, the first being plane 0; the most-significant
+	bit of each word supplies the leftmost pixel. @c target receives sixteen bytes, one per pixel
+	from left to right, in which bit n is the value of that pixel in plane n.
+*/
+template <int plane_count> void planar_to_chunky(const uint16_t *planes, uint8_t *target) {
+	static_assert(plane_count >= 1 && plane_count <= 8);
+
+#if defined(__SSE2__) || defined(_M_X64)
+	const __m128i bits = _mm_setr_epi8(
+		char(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+		char(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+	__m128i result = _mm_setzero_si128();
+	for(int plane = 0; plane < plane_count; plane++) {
+		const __m128i source = _mm_unpacklo_epi64(
+			_mm_set1_epi8(char(planes[plane] >> 8)),
+			_mm_set1_epi8(char(planes[plane])));
+		const __m128i is_set = _mm_cmpeq_epi8(_mm_and_si128(source, bits), bits);
+		result = _mm_or_si128(result, _mm_and_si128(is_set, _mm_set1_epi8(char(1 << plane))));
+	}
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(target), result);
+#elif defined(__ARM_NEON)
+	static constexpr uint8_t bit_values[] = {
+		0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+		0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+	};
+	const uint8x16_t bits = vld1q_u8(bit_values);
+	uint8x16_t result = vdupq_n_u8(0);
+	for(int plane = 0; plane < plane_count; plane++) {
+		const uint8x16_t source = vcombine_u8(
+			vdup_n_u8(uint8_t(planes[plane] >> 8)),
+			vdup_n_u8(uint8_t(planes[plane])));
+		result = vorrq_u8(result, vandq_u8(vtstq_u8(source, bits), vdupq_n_u8(uint8_t(1 << plane))));
+	}
+	vst1q_u8(target, result);
+#else
+	for(int pixel = 0; pixel < 16; pixel++) {
+		uint8_t value = 0;
+		for(int plane = 0; plane < plane_count; plane++) {
+			value |= ((planes[plane] >> (15 - pixel)) & 1) << plane;
+		}
+		target[pixel] = value;
+	}
+#endif
+}
+
+/*!
+	Writes @c count pixels to @c target by looking up each of @c indices in @c palette.
+*/
+template <typename PixelT> void map_palette(const uint8_t *indices, size_t count, const PixelT *palette, PixelT *target) {
+	for(size_t c = 0; c < count; c++) {
+		target[c] = palette[indices[c]];
+	}
+}
+
+/*!
+	Writes sixteen 16-bit pixels to @c target by looking up each of @c indices, all of which must be
+	less than 16, in @c palette.
+*/
+inline void map_palette16(const uint8_t *indices, const uint16_t *palette, uint16_t *target) {
+#if defined(__SSSE3__)
+	// Split the palette into low and high bytes, use each as a byte shuffle, then interleave.
+	const __m128i entries_low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(palette));
+	const __m128i entries_high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(palette + 8));
+	const __m128i low_bytes = _mm_set1_epi16(0x00ff);
+	const __m128i palette_low = _mm_packus_epi16(_mm_and_si128(entries_low, low_bytes), _mm_and_si128(entries_high, low_bytes));
+	const __m128i palette_high = _mm_packus_epi16(_mm_srli_epi16(entries_low, 8), _mm_srli_epi16(entries_high, 8));
+
+	const __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+	const __m128i low = _mm_shuffle_epi8(palette_low, source);
+	const __m128i high = _mm_shuffle_epi8(palette_high, source);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(target), _mm_unpacklo_epi8(low, high));
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(target + 8), _mm_unpackhi_epi8(low, high));
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const uint8x16x2_t entries = vld2q_u8(reinterpret_cast<const uint8_t *>(palette));
+	const uint8x16_t source = vld1q_u8(indices);
+	uint8x16x2_t result;
+	result.val[0] = vqtbl1q_u8(entries.val[0], source);
+	result.val[1] = vqtbl1q_u8(entries.val[1], source);
+	vst2q_u8(reinterpret_cast<uint8_t *>(target), result);
+#else
+	map_palette(indices, 16, palette, target);
+#endif
+}
+
+}
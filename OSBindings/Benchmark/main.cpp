@@ -0,0 +1,388 @@
+//
+//  main.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../Analyser/Static/StaticAnalyser.hpp"
+#include "../../Machines/Utility/MachineForTarget.hpp"
+
+#include "../../ClockReceiver/TimeTypes.hpp"
+#include "../../Machines/MachineTypes.hpp"
+#include "../../Outputs/ScanTarget.hpp"
+#include "../../Outputs/ScanTargets/FrameSkippingScanTarget.hpp"
+#include "../../Outputs/Software/ScanTarget.hpp"
+#include "../../Outputs/Speaker/Speaker.hpp"
+
+#include "../../Reflection/Struct.hpp"
+
+/*
+	A headless throughput benchmark: builds each requested machine, connects it to a
+	null scan target and a speaker delegate that discards all audio, then runs it as
+	quickly as possible for a fixed amount of emulated time.
+
+	Results are reported as emulated seconds per wall-clock second and as emulated
+	cycles per wall-clock second.
+
+	Optionally video can instead be rendered via the software scan target, in which
+	case the final frame can also be saved.
+*/
+
+namespace {
+
+struct ParsedArguments {
+	std::vector<std::string> file_names;
+	std::map<std::string, std::string> selections;	// The empty string will be inserted for arguments without an = suffix.
+
+	void apply(Reflection::Struct *reflectable) const {
+		for(const auto &argument: selections) {
+			// Replace any dashes with underscores in the argument name.
+			std::string property;
+			std::transform(argument.first.begin(), argument.first.end(), std::back_inserter(property), [](char c) { return c == '-' ? '_' : c; });
+
+			if(argument.second.empty()) {
+				Reflection::set<bool>(*reflectable, property, true);
+			} else {
+				Reflection::fuzzy_set(*reflectable, property, argument.second);
+			}
+		}
+	}
+
+	std::string value(const std::string &name, const std::string &fallback = "") const {
+		const auto selection = selections.find(name);
+		return selection != selections.end() ? selection->second : fallback;
+	}
+};
+
+/*! Parses an argc/argv pair to discern program arguments. */
+ParsedArguments parse_arguments(int argc, char *argv[]) {
+	ParsedArguments arguments;
+
+	for(int index = 1; index < argc; ++index) {
+		char *arg = argv[index];
+
+		// Accepted format is as per the SDL binding:
+		//
+		//	--flag			sets a Boolean option to true.
+		//	--flag=value	sets the value for a list option.
+		//	name			sets the file name to load.
+		if(arg[0] == '-') {
+			while(*arg == '-') arg++;
+
+			std::string argument = arg;
+			std::size_t split_index = argument.find("=");
+
+			if(split_index == std::string::npos) {
+				arguments.selections[argument];
+			} else {
+				const std::string name = argument.substr(0, split_index);
+				arguments.selections[name] = argument.substr(split_index+1, std::string::npos);
+			}
+		} else {
+			arguments.file_names.push_back(arg);
+		}
+	}
+
+	return arguments;
+}
+
+/*!
+	Receives and discards all audio; the speaker still performs its full
+	filtering and resampling work in order to get this far.
+*/
+struct NullSpeakerDelegate: public Outputs::Speaker::Speaker::Delegate {
+	void speaker_did_complete_samples(Outputs::Speaker::Speaker *, const std::vector<int16_t> &buffer) final {
+		samples += buffer.size();
+	}
+	size_t samples = 0;
+};
+
+/*!
+	Provides a ROM fetcher that looks in the same places as the SDL binding:
+
+		/usr/local/share/CLK/[system];
+		/usr/share/CLK/[system]; or
+		[user-supplied path]/[system]
+*/
+ROMMachine::ROMFetcher rom_fetcher(const std::string &rom_path, ROM::Request &missing_roms) {
+	std::vector<std::string> paths = {
+		"/usr/local/share/CLK/",
+		"/usr/share/CLK/"
+	};
+
+	if(!rom_path.empty()) {
+		std::string path = rom_path;
+		if(path.back() != '/') {
+			path += '/';
+		}
+
+		const size_t tilde_position = path.find("~");
+		if(tilde_position != std::string::npos) {
+			path.replace(tilde_position, 1, getenv("HOME"));
+		}
+
+		paths.push_back(path);
+	}
+
+	return [paths, &missing_roms] (const ROM::Request &roms) -> ROM::Map {
+		ROM::Map results;
+		for(const auto &description: roms.all_descriptions()) {
+			for(const auto &file_name: description.file_names) {
+				FILE *file = nullptr;
+				for(const auto &path: paths) {
+					const std::string local_path = path + description.machine_name + "/" + file_name;
+					file = std::fopen(local_path.c_str(), "rb");
+					if(file) break;
+				}
+				if(!file) continue;
+
+				std::vector<uint8_t> data;
+				std::fseek(file, 0, SEEK_END);
+				data.resize(std::ftell(file));
+				std::fseek(file, 0, SEEK_SET);
+				const std::size_t read = fread(data.data(), 1, data.size(), file);
+				std::fclose(file);
+
+				if(read == data.size()) {
+					results[description.name] = std::move(data);
+				}
+			}
+		}
+
+		missing_roms = roms.subtract(results);
+		return results;
+	};
+}
+
+struct Result {
+	Time::Seconds emulated = 0.0;
+	Time::Seconds wall = 0.0;
+	double cycles = 0.0;
+	size_t audio_samples = 0;
+	Outputs::Display::Software::ScanTarget::Screenshot screenshot;
+};
+
+/// The size of framebuffer to use if rendering video.
+constexpr int RenderWidth = 640;
+constexpr int RenderHeight = 480;
+
+/*!
+	Runs @c machine for @c duration seconds of emulated time, in @c slice -sized steps,
+	flushing all output after each just as a real host would.
+
+	If @c render is @c true then video is also rendered after each step, and the final
+	frame is returned; only one in every @c frame_interval frames will be rendered.
+*/
+Result benchmark(Machine::DynamicMachine &machine, Time::Seconds duration, Time::Seconds slice, bool render, int frame_interval) {
+	Result result;
+
+	std::unique_ptr<Outputs::Display::Software::ScanTarget> scan_target;
+	Outputs::Display::FrameSkippingScanTarget frame_skipper;
+	if(render) {
+		scan_target = std::make_unique<Outputs::Display::Software::ScanTarget>();
+		frame_skipper.set_target(scan_target.get());
+		frame_skipper.set_interval(frame_interval);
+		machine.scan_producer()->set_scan_target(&frame_skipper);
+	} else {
+		machine.scan_producer()->set_scan_target(&Outputs::Display::NullScanTarget::singleton);
+	}
+
+	NullSpeakerDelegate speaker_delegate;
+	const auto audio_producer = machine.audio_producer();
+	Outputs::Speaker::Speaker *speaker = audio_producer ? audio_producer->get_speaker() : nullptr;
+	if(speaker) {
+		speaker->set_output_rate(48000, 1024, speaker->get_is_stereo());
+		speaker->set_delegate(&speaker_delegate);
+	}
+
+	const auto timed_machine = machine.timed_machine();
+	const auto start_time = Time::nanos_now();
+	while(result.emulated < duration) {
+		const Time::Seconds step = std::min(slice, duration - result.emulated);
+		timed_machine->run_for(step);
+		timed_machine->flush_output(MachineTypes::TimedMachine::Output::All);
+		if(scan_target) {
+			scan_target->update(RenderWidth, RenderHeight);
+		}
+
+		result.emulated += step;
+		result.cycles += step * timed_machine->get_clock_rate();
+	}
+	result.wall = Time::seconds(Time::nanos_now() - start_time);
+
+	if(speaker) {
+		speaker->set_delegate(nullptr);
+	}
+	result.audio_samples = speaker_delegate.samples;
+
+	if(scan_target) {
+		result.screenshot = scan_target->screenshot();
+		machine.scan_producer()->set_scan_target(&Outputs::Display::NullScanTarget::singleton);
+	}
+
+	return result;
+}
+
+/*!
+	Writes @c screenshot to @c file_name as a binary PPM.
+
+	@returns @c true on success; @c false otherwise.
+*/
+bool write_ppm(const std::string &file_name, const Outputs::Display::Software::ScanTarget::Screenshot &screenshot) {
+	FILE *const file = std::fopen(file_name.c_str(), "wb");
+	if(!file) return false;
+
+	std::fprintf(file, "P6\n%d %d\n255\n", screenshot.width, screenshot.height);
+	for(size_t pixel = 0; pixel < screenshot.pixel_data.size(); pixel += 4) {
+		std::fwrite(&screenshot.pixel_data[pixel], 1, 3, file);
+	}
+	return !std::fclose(file);
+}
+
+}
+
+int main(int argc, char *argv[]) {
+	const ParsedArguments arguments = parse_arguments(argc, argv);
+
+	if(arguments.selections.find("help") != arguments.selections.end() || arguments.selections.find("h") != arguments.selections.end()) {
+		std::cout << "Usage: clkbenchmark [files...] [--new={machine}] [--seconds={emulated seconds per machine}] [--slice={seconds per run_for}] [--rompath={path to ROMs}] [--render] [--screenshot={PPM file for final frame}] [--frame-skip={N}] [OPTIONS]" << std::endl;
+		std::cout << "With --render, video is rendered in software rather than discarded; --screenshot implies --render." << std::endl;
+		std::cout << "With --frame-skip, only one in every N frames is rendered; the others are reduced to sync alone." << std::endl;
+		std::cout << "With neither files nor --new, every machine that can start without media is benchmarked:" << std::endl << std::endl;
+		for(const auto &name: Machine::AllMachines(Machine::Type::DoesntRequireMedia, false)) {
+			std::cout << '\t' << name << std::endl;
+		}
+		return EXIT_SUCCESS;
+	}
+
+	const Time::Seconds duration = std::atof(arguments.value("seconds", "10").c_str());
+	const Time::Seconds slice = std::atof(arguments.value("slice", "0.02").c_str());
+	if(duration <= 0.0 || slice <= 0.0) {
+		std::cerr << "Both --seconds and --slice must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const std::string screenshot_file = arguments.value("screenshot");
+	const bool render = !screenshot_file.empty() || arguments.selections.find("render") != arguments.selections.end();
+	const int frame_interval = std::atoi(arguments.value("frame-skip", "1").c_str());
+	if(frame_interval <= 0) {
+		std::cerr << "--frame-skip must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// Assemble a list of (name, targets) pairs to benchmark.
+	std::vector<std::pair<std::string, Analyser::Static::TargetList>> runs;
+	const auto short_names = Machine::AllMachines(Machine::Type::DoesntRequireMedia, false);
+	const auto long_names = Machine::AllMachines(Machine::Type::DoesntRequireMedia, true);
+	const auto add_machine = [&](size_t index) {
+		auto targets_by_machine = Machine::TargetsByMachineName(false);
+		Analyser::Static::TargetList targets;
+		targets.push_back(std::move(targets_by_machine[long_names[index]]));
+		runs.emplace_back(short_names[index], std::move(targets));
+	};
+
+	const std::string new_machine = arguments.value("new");
+	if(!new_machine.empty()) {
+		const auto short_name = std::find_if(short_names.begin(), short_names.end(), [&](const std::string &name) {
+			return std::equal(
+				name.begin(), name.end(),
+				new_machine.begin(), new_machine.end(),
+				[](char a, char b) { return tolower(b) == tolower(a); });
+		});
+		if(short_name == short_names.end()) {
+			std::cerr << "Unknown machine: " << new_machine << std::endl;
+			return EXIT_FAILURE;
+		}
+		add_machine(size_t(short_name - short_names.begin()));
+	}
+
+	for(const auto &file_name: arguments.file_names) {
+		auto targets = Analyser::Static::GetTargets(file_name);
+		if(targets.empty()) {
+			std::cerr << "Cannot open " << file_name << "; no target machine found" << std::endl;
+			continue;
+		}
+		runs.emplace_back(file_name, std::move(targets));
+	}
+
+	if(new_machine.empty() && arguments.file_names.empty()) {
+		for(size_t index = 0; index < short_names.size(); ++index) {
+			add_machine(index);
+		}
+	}
+
+	// Run each in turn.
+	std::cout << std::left << std::setw(24) << "Machine" <<
+		std::right <<
+		std::setw(12) << "Emulated" <<
+		std::setw(12) << "Wall" <<
+		std::setw(12) << "Speed" <<
+		std::setw(16) << "MCycles/s" << std::endl;
+
+	int completed = 0;
+	for(auto &run: runs) {
+		for(auto &target: run.second) {
+			auto reflectable_target = dynamic_cast<Reflection::Struct *>(target.get());
+			if(!reflectable_target) continue;
+			arguments.apply(reflectable_target);
+		}
+
+		ROM::Request missing_roms;
+		Machine::Error error;
+		const auto fetcher = rom_fetcher(arguments.value("rompath"), missing_roms);
+		std::unique_ptr<Machine::DynamicMachine> machine(Machine::MachineForTarget(run.second.front().get(), fetcher, error));
+
+		std::cout << std::left << std::setw(24) << run.first << std::right;
+		if(!machine) {
+			switch(error) {
+				case Machine::Error::MissingROM: {
+					std::cout << "skipped; missing ROMs:";
+					for(const auto &description: missing_roms.all_descriptions()) {
+						std::cout << ' ' << description.machine_name << '/' << description.file_names.front();
+					}
+				} break;
+				default:
+					std::cout << "skipped; could not create machine";
+				break;
+			}
+			std::cout << std::endl;
+			continue;
+		}
+
+		// Apply all command-line options to the machine.
+		auto configurable = machine->configurable_device();
+		if(configurable) {
+			const auto options = configurable->get_options();
+			arguments.apply(options.get());
+			configurable->set_options(options);
+		}
+
+		const Result result = benchmark(*machine, duration, slice, render, frame_interval);
+		std::cout <<
+			std::fixed << std::setprecision(2) <<
+			std::setw(11) << result.emulated << 's' <<
+			std::setw(11) << result.wall << 's' <<
+			std::setw(11) << result.emulated / result.wall << 'x' <<
+			std::setw(16) << result.cycles / (result.wall * 1e6) << std::endl;
+		++completed;
+
+		if(!screenshot_file.empty() && !write_ppm(screenshot_file, result.screenshot)) {
+			std::cerr << "Could not write " << screenshot_file << std::endl;
+		}
+	}
+
+	return completed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -126,6 +126,7 @@ typedef NS_ENUM(NSInteger, CSMachineMSXRegion) {
 typedef NS_ENUM(NSInteger, CSPCCompatibleSpeed) {
 	CSPCCompatibleSpeedOriginal,
 	CSPCCompatibleSpeedTurbo,
+	CSPCCompatibleSpeedUnlimited,
 };
 
 typedef NS_ENUM(NSInteger, CSPCCompatibleVideoAdaptor) {
@@ -293,6 +293,7 @@
 		switch(speed) {
 			case CSPCCompatibleSpeedOriginal:	target->speed = Target::Speed::ApproximatelyOriginal;	break;
 			case CSPCCompatibleSpeedTurbo:		target->speed = Target::Speed::Fast;					break;
+			case CSPCCompatibleSpeedUnlimited:	target->speed = Target::Speed::Unlimited;				break;
 		}
 		_targets.push_back(std::move(target));
 	}
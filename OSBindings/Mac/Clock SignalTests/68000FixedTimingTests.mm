@@ -0,0 +1,350 @@
+//
+//  68000FixedTimingTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Processors/68000/68000.hpp"
+#include "../../../Processors/68000/State/State.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// Runs that exceed this many half cycles are abandoned; they're generally stuck in an
+/// address error loop.
+constexpr int64_t MaxTime = 100'000;
+
+/// Addresses with bit 12 set are contended: they are always seen by the bus handler, which
+/// applies a delay that depends on the current time. All others are offered as fixed-timing.
+constexpr bool is_contended(uint32_t address) {
+	return address & 0x1000;
+}
+
+/// Thrown to end a run, whether complete or abandoned.
+struct StopException {};
+
+/// An access as observed by the bus handler, or an instruction boundary.
+struct Access {
+	int64_t time;
+	uint32_t address;
+	int operation;
+	uint16_t value;
+
+	bool operator ==(const Access &rhs) const {
+		return time == rhs.time && address == rhs.address && operation == rhs.operation && value == rhs.value;
+	}
+};
+
+/// Binds a 68000 to 64kb of RAM, mirrored throughout the address space, recording every instruction
+/// boundary and every access to contended memory.
+template <bool use_fixed_timing_memory>
+struct TestMachine: public CPU::MC68000::BusHandler {
+	std::vector<uint16_t> ram = std::vector<uint16_t>(32768);
+	CPU::MC68000::Processor<TestMachine, true, true, true, use_fixed_timing_memory> processor;
+
+	std::vector<Access> accesses;
+	int64_t time = 0;
+	int instructions_remaining = 0;
+	bool abandoned = false;
+
+	/// If non-negative, the time at which a level 4 interrupt will be requested; it is cleared upon acknowledgement.
+	int64_t interrupt_time = -1;
+
+	TestMachine() : processor(*this) {}
+
+	void will_perform(uint32_t address, uint16_t opcode) {
+		accesses.push_back(Access{time, address, -1, opcode});
+		if(!--instructions_remaining) throw StopException();
+	}
+
+	template <typename Microcycle> HalfCycles perform_bus_operation(const Microcycle &cycle, int) {
+		time += cycle.length.template as<int64_t>();
+		if(time > MaxTime) {
+			abandoned = true;
+			throw StopException();
+		}
+		if(interrupt_time >= 0 && time >= interrupt_time) {
+			processor.set_interrupt_level(4);
+		}
+
+		if(!(cycle.operation & (CPU::MC68000::Operation::NewAddress | CPU::MC68000::Operation::SameAddress))) {
+			return HalfCycles(0);
+		}
+
+		const uint32_t address = cycle.host_endian_byte_address();
+		HalfCycles delay;
+		if(is_contended(address)) {
+			if(cycle.operation & CPU::MC68000::Operation::NewAddress) {
+				delay = HalfCycles(int(time % 6));
+				time += delay.as<int64_t>();
+			}
+		}
+
+		// Interrupts are autovectored, so acknowledgement cycles carry no data.
+		const bool is_acknowledge = cycle.operation & CPU::MC68000::Operation::InterruptAcknowledge;
+		const bool has_data = cycle.data_select_active() && !is_acknowledge;
+		if(is_acknowledge) {
+			processor.set_interrupt_level(0);
+			interrupt_time = -1;
+		} else if(has_data) {
+			cycle.apply(memory(address));
+		}
+		if(is_contended(address)) {
+			accesses.push_back(Access{time, address, cycle.operation, has_data ? cycle.value16() : uint16_t(0)});
+		}
+		processor.set_is_peripheral_address(is_acknowledge);
+
+		return delay;
+	}
+
+	template <typename Microcycle> uint8_t *fixed_timing_memory(const Microcycle &cycle, int) {
+		const uint32_t address = cycle.host_endian_byte_address();
+		return is_contended(address) ? nullptr : memory(address);
+	}
+
+	uint8_t *memory(uint32_t address) {
+		return reinterpret_cast<uint8_t *>(ram.data()) + (address & 0xffff);
+	}
+
+	/// Sets up memory and registers, ready to run.
+	void load(const InstructionSet::M68k::RegisterSet &registers, const std::vector<std::pair<uint32_t, uint8_t>> &initial_memory, int64_t interrupt_time = -1) {
+		this->interrupt_time = interrupt_time;
+		for(const auto &pair: initial_memory) {
+			*memory(pair.first ^ 1) = pair.second;	// Effect a short-resolution endianness swap.
+		}
+		processor.decode_from_state(registers);
+	}
+
+	/// Runs for @c instructions instructions, in short slices.
+	void run_for_instructions(int instructions) {
+		instructions_remaining = instructions + 1;	// i.e. run up to the will_perform of the instruction after.
+		try {
+			for(int slice = 0; slice < MaxTime; slice++) {
+				processor.run_for(HalfCycles(2));
+			}
+			abandoned = true;
+		} catch(const StopException &) {}
+	}
+};
+
+using SlowMachine = TestMachine<false>;
+using FastMachine = TestMachine<true>;
+
+/// Runs for @c instructions instructions with fixed-timing memory, swapping between two processors
+/// via a ProcessorState whenever one can be captured.
+std::unique_ptr<FastMachine> run_with_state_transfers(
+	const InstructionSet::M68k::RegisterSet &registers,
+	const std::vector<std::pair<uint32_t, uint8_t>> &initial_memory,
+	int instructions,
+	int64_t interrupt_time
+) {
+	std::array<std::unique_ptr<FastMachine>, 2> machines = {std::make_unique<FastMachine>(), std::make_unique<FastMachine>()};
+	machines[0]->load(registers, initial_memory, interrupt_time);
+	machines[0]->instructions_remaining = instructions + 1;
+
+	size_t active = 0;
+	try {
+		for(int slice = 0; slice < MaxTime; slice++) {
+			machines[active]->processor.run_for(HalfCycles(2));
+
+			const auto state = CPU::MC68000::ProcessorState::capture(machines[active]->processor);
+			if(!state) continue;
+
+			auto &source = *machines[active];
+			auto &destination = *machines[active ^ 1];
+			destination.ram = source.ram;
+			destination.accesses = source.accesses;
+			destination.time = source.time;
+			destination.instructions_remaining = source.instructions_remaining;
+			destination.interrupt_time = source.interrupt_time;
+			state->apply(destination.processor);
+			active ^= 1;
+		}
+		machines[active]->abandoned = true;
+	} catch(const StopException &) {}
+
+	return std::move(machines[active]);
+}
+
+}
+
+@interface M68000FixedTimingTests : XCTestCase
+@end
+
+/// Compares 68000s with and without fixed-timing memory; aside from the reduced number of calls to
+/// the bus handler, results should be identical. That includes interrupts, since time is posted to the bus
+/// handler before each sampling of the interrupt input.
+@implementation M68000FixedTimingTests {
+	int _comparisons;
+	int _abandoned;
+}
+
+- (void)testSingleInstructions {
+	[self compareAllForInstructions:1];
+}
+
+- (void)testInstructionSequences {
+	[self compareAllForInstructions:30];
+}
+
+/// Stops and is then interrupted at a variety of times, capturing state while stopped.
+- (void)testStop {
+	InstructionSet::M68k::RegisterSet registers{};
+	registers.status = 0x2700;
+	registers.supervisor_stack_pointer = 0x0800;
+	registers.program_counter = 0x0400;
+
+	const std::vector<std::pair<uint32_t, uint8_t>> memory = {
+		// Level 4 autovector: 0x1600, which is contended.
+		{0x0070, 0x00},	{0x0071, 0x00},	{0x0072, 0x16},	{0x0073, 0x00},
+
+		// STOP #$2000; then ADDQ.l #1, D0; NOP; BRA.s -6.
+		{0x0400, 0x4e},	{0x0401, 0x72},	{0x0402, 0x20},	{0x0403, 0x00},
+		{0x0404, 0x52},	{0x0405, 0x80},	{0x0406, 0x4e},	{0x0407, 0x71},
+		{0x0408, 0x60},	{0x0409, 0xfa},
+
+		// ADDQ.l #1, D1; RTE.
+		{0x1600, 0x52},	{0x1601, 0x81},	{0x1602, 0x4e},	{0x1603, 0x73},
+	};
+
+	_comparisons = _abandoned = 0;
+	for(int64_t interrupt_time = 40; interrupt_time < 200; interrupt_time++) {
+		[self compareRegisters:registers memory:memory instructions:10 interruptTime:interrupt_time name:[NSString stringWithFormat:@"Interrupt at %lld", interrupt_time]];
+	}
+	XCTAssertEqual(_abandoned, 0);
+}
+
+/// Is interrupted at a variety of times while running from fixed-timing memory only.
+- (void)testInterruptDuringExecution {
+	InstructionSet::M68k::RegisterSet registers{};
+	registers.status = 0x2000;
+	registers.supervisor_stack_pointer = 0x0800;
+	registers.program_counter = 0x0400;
+
+	const std::vector<std::pair<uint32_t, uint8_t>> memory = {
+		// Level 4 autovector: 0x0600.
+		{0x0070, 0x00},	{0x0071, 0x00},	{0x0072, 0x06},	{0x0073, 0x00},
+
+		// ADDQ.l #1, D0; MOVE.w D0, (A0); BRA.s -6.
+		{0x0400, 0x52},	{0x0401, 0x80},	{0x0402, 0x30},	{0x0403, 0x80},
+		{0x0404, 0x60},	{0x0405, 0xfa},
+
+		// ADDQ.l #1, D1; RTE.
+		{0x0600, 0x52},	{0x0601, 0x81},	{0x0602, 0x4e},	{0x0603, 0x73},
+	};
+
+	_comparisons = _abandoned = 0;
+	for(int64_t interrupt_time = 0; interrupt_time < 400; interrupt_time++) {
+		[self compareRegisters:registers memory:memory instructions:30 interruptTime:interrupt_time name:[NSString stringWithFormat:@"Interrupt at %lld", interrupt_time]];
+	}
+	XCTAssertEqual(_abandoned, 0);
+}
+
+- (void)compareAllForInstructions:(int)instructions {
+	NSBundle *const bundle = [NSBundle bundleForClass:[self class]];
+	NSArray<NSURL *> *const tests = [bundle URLsForResourcesWithExtension:@"json" subdirectory:@"68000 Comparative Tests"];
+	XCTAssertGreaterThan(tests.count, 0);
+
+	_comparisons = _abandoned = 0;
+	for(NSURL *url in tests) {
+		NSData *const data = [NSData dataWithContentsOfURL:url];
+		NSArray *const jsonContents = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+		XCTAssert([jsonContents isKindOfClass:[NSArray class]]);
+
+		for(NSDictionary *test in jsonContents) {
+			if(![test isKindOfClass:[NSDictionary class]] || !test[@"name"]) continue;
+			[self compare:test instructions:instructions];
+		}
+	}
+
+	// Only a handful of runs should get stuck.
+	XCTAssertLessThan(_abandoned * 100, _comparisons);
+}
+
+- (void)compare:(NSDictionary *)test instructions:(int)instructions {
+	NSString *const name = test[@"name"];
+
+	// Get initial state.
+	InstructionSet::M68k::RegisterSet registers;
+	NSDictionary *const initialState = test[@"initial state"];
+	for(int c = 0; c < 8; ++c) {
+		registers.data[c] = uint32_t([initialState[[NSString stringWithFormat:@"d%d", c]] integerValue]);
+		if(c < 7) registers.address[c] = uint32_t([initialState[[NSString stringWithFormat:@"a%d", c]] integerValue]);
+	}
+	registers.supervisor_stack_pointer = uint32_t([initialState[@"a7"] integerValue]);
+	registers.user_stack_pointer = uint32_t([initialState[@"usp"] integerValue]);
+	registers.status = [initialState[@"sr"] integerValue];
+	registers.program_counter = uint32_t([initialState[@"pc"] integerValue]);
+
+	std::vector<std::pair<uint32_t, uint8_t>> initial_memory;
+	NSEnumerator<NSNumber *> *enumerator = [test[@"initial memory"] objectEnumerator];
+	while(true) {
+		NSNumber *const address = [enumerator nextObject];
+		NSNumber *const value = [enumerator nextObject];
+		if(!address || !value) break;
+		initial_memory.emplace_back(uint32_t(address.integerValue), uint8_t(value.integerValue));
+	}
+
+	[self compareRegisters:registers memory:initial_memory instructions:instructions interruptTime:-1 name:name];
+}
+
+- (void)compareRegisters:(const InstructionSet::M68k::RegisterSet &)registers
+	memory:(const std::vector<std::pair<uint32_t, uint8_t>> &)initial_memory
+	instructions:(int)instructions
+	interruptTime:(int64_t)interrupt_time
+	name:(NSString *)name {
+	// Run each configuration, plus the fixed-timing configuration with state transfers.
+	auto slow = std::make_unique<SlowMachine>();
+	slow->load(registers, initial_memory, interrupt_time);
+	slow->run_for_instructions(instructions);
+
+	auto fast = std::make_unique<FastMachine>();
+	fast->load(registers, initial_memory, interrupt_time);
+	fast->run_for_instructions(instructions);
+
+	const auto transferred = run_with_state_transfers(registers, initial_memory, instructions, interrupt_time);
+
+	++_comparisons;
+	if(slow->abandoned || fast->abandoned || transferred->abandoned) {
+		++_abandoned;
+		return;
+	}
+
+	// Compare.
+	for(const FastMachine *const machine: {fast.get(), transferred.get()}) {
+		const char *const description = machine == fast.get() ? "fixed-timing" : "transferred";
+
+		XCTAssertEqual(slow->time, machine->time, @"%@: total time differs for %s", name, description);
+		XCTAssert(slow->ram == machine->ram, @"%@: memory differs for %s", name, description);
+
+		const size_t accesses = std::min(slow->accesses.size(), machine->accesses.size());
+		for(size_t c = 0; c < accesses; c++) {
+			if(!(slow->accesses[c] == machine->accesses[c])) {
+				XCTFail(@"%@: access %zu differs for %s, at time %lld versus %lld", name, c, description, slow->accesses[c].time, machine->accesses[c].time);
+				break;
+			}
+		}
+		XCTAssertEqual(slow->accesses.size(), machine->accesses.size(), @"%@: access counts differ for %s", name, description);
+	}
+
+	const auto slow_state = slow->processor.get_state();
+	for(const auto &state: {fast->processor.get_state(), transferred->processor.get_state()}) {
+		for(int c = 0; c < 8; c++) {
+			XCTAssertEqual(slow_state.registers.data[c], state.registers.data[c], @"%@: D%d differs", name, c);
+			if(c < 7) XCTAssertEqual(slow_state.registers.address[c], state.registers.address[c], @"%@: A%d differs", name, c);
+		}
+		XCTAssertEqual(slow_state.registers.user_stack_pointer, state.registers.user_stack_pointer, @"%@: USP differs", name);
+		XCTAssertEqual(slow_state.registers.supervisor_stack_pointer, state.registers.supervisor_stack_pointer, @"%@: SSP differs", name);
+		XCTAssertEqual(slow_state.registers.status, state.registers.status, @"%@: status differs", name);
+		XCTAssertEqual(slow_state.registers.program_counter, state.registers.program_counter, @"%@: PC differs", name);
+	}
+}
+
+@end
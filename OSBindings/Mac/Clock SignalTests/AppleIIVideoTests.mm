@@ -0,0 +1,187 @@
+//
+//  AppleIIVideoTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/Apple/AppleII/Video.hpp"
+
+#include <array>
+#include <random>
+#include <vector>
+
+namespace {
+
+/*!
+	Exposes VideoBase's byte-to-sample conversions, alongside reference implementations
+	that calculate every sample individually.
+*/
+class VideoHarness: public Apple::II::Video::VideoBase {
+	public:
+		VideoHarness(bool is_iie) : VideoBase(is_iie, [](Cycles) {}) {}
+
+		using VideoBase::output_text;
+		using VideoBase::output_double_text;
+		using VideoBase::output_high_resolution;
+		using VideoBase::output_double_high_resolution;
+
+		uint8_t &graphics_carry() {
+			return graphics_carry_;
+		}
+
+		void reference_text(uint8_t *target, const uint8_t *source, size_t length, size_t pixel_row) const {
+			for(size_t c = 0; c < length; ++c) {
+				const uint8_t pattern = character_pattern(source[c], pixel_row);
+				for(int bit = 0; bit < 7; bit++) {
+					target[bit*2] = target[bit*2 + 1] = pattern & (0x40 >> bit);
+				}
+				graphics_carry_ = pattern & 0x01;
+				target += 14;
+			}
+		}
+
+		void reference_double_text(uint8_t *target, const uint8_t *source, const uint8_t *auxiliary_source, size_t length, size_t pixel_row) const {
+			for(size_t c = 0; c < length; ++c) {
+				const uint8_t patterns[2] = {
+					character_pattern(auxiliary_source[c], pixel_row),
+					character_pattern(source[c], pixel_row),
+				};
+				for(int bit = 0; bit < 7; bit++) {
+					target[bit] = patterns[0] & (0x40 >> bit);
+					target[bit + 7] = patterns[1] & (0x40 >> bit);
+				}
+				graphics_carry_ = patterns[1] & 0x01;
+				target += 14;
+			}
+		}
+
+		void reference_high_resolution(uint8_t *target, const uint8_t *source, size_t length) const {
+			for(size_t c = 0; c < length; ++c) {
+				if(source[c] & high_resolution_mask_ & 0x80) {
+					target[0] = graphics_carry_;
+					for(int bit = 0; bit < 13; bit++) {
+						target[bit + 1] = source[c] & (1 << (bit >> 1));
+					}
+				} else {
+					for(int bit = 0; bit < 14; bit++) {
+						target[bit] = source[c] & (1 << (bit >> 1));
+					}
+				}
+				graphics_carry_ = source[c] & 0x40;
+				target += 14;
+			}
+		}
+
+		void reference_double_high_resolution(uint8_t *target, const uint8_t *source, const uint8_t *auxiliary_source, size_t length) const {
+			for(size_t c = 0; c < length; ++c) {
+				for(int bit = 0; bit < 7; bit++) {
+					target[bit] = auxiliary_source[c] & (1 << bit);
+					target[bit + 7] = source[c] & (1 << bit);
+				}
+				graphics_carry_ = auxiliary_source[c] & 0x40;
+				target += 14;
+			}
+		}
+
+	private:
+		uint8_t character_pattern(uint8_t code, size_t pixel_row) const {
+			const auto &zone = character_zones_[code >> 6];
+			return character_rom_[(size_t(code & zone.address_mask) << 3) + pixel_row] ^ zone.xor_mask;
+		}
+};
+
+constexpr size_t Columns = 40;
+using Line = std::array<uint8_t, Columns * 14>;
+
+/// Holds a line of output and the graphics carry that followed it.
+struct Output {
+	Line samples{};
+	uint8_t carry = 0;
+
+	bool operator ==(const Output &rhs) const {
+		return samples == rhs.samples && carry == rhs.carry;
+	}
+};
+
+/*!
+	Runs @c convert and @c reference upon the same @c harness, each starting from @c initial_carry,
+	and @returns @c true if they produce the same output.
+*/
+template <typename ConvertT, typename ReferenceT>
+bool matches(VideoHarness &harness, uint8_t initial_carry, const ConvertT &convert, const ReferenceT &reference) {
+	Output converted, expected;
+
+	harness.graphics_carry() = initial_carry;
+	convert(converted.samples.data());
+	converted.carry = harness.graphics_carry();
+
+	harness.graphics_carry() = initial_carry;
+	reference(expected.samples.data());
+	expected.carry = harness.graphics_carry();
+
+	return converted == expected;
+}
+
+}
+
+@interface AppleIIVideoTests : XCTestCase
+@end
+
+@implementation AppleIIVideoTests
+
+- (void)testConversionsMatchReference {
+	std::mt19937 random(0x2e);
+	std::uniform_int_distribution<int> byte(0, 255);
+
+	std::vector<uint8_t> character_rom(4096);
+	for(auto &value: character_rom) value = uint8_t(byte(random));
+
+	for(const bool is_iie: {false, true}) {
+		VideoHarness harness(is_iie);
+		harness.set_character_rom(character_rom);
+
+		for(const bool alternative_character_set: {false, true}) {
+			for(const bool annunciator_3: {false, true}) {
+				harness.set_alternative_character_set(alternative_character_set);
+				harness.set_annunciator_3(annunciator_3);
+
+				// Run a frame's worth of lines through each conversion, ensuring that every byte value appears.
+				for(int line = 0; line < 192; line++) {
+					std::array<uint8_t, Columns> source, auxiliary_source;
+					for(size_t c = 0; c < Columns; c++) {
+						source[c] = uint8_t(line * Columns + c);
+						auxiliary_source[c] = uint8_t(byte(random));
+					}
+					const size_t pixel_row = size_t(line & 7);
+					const uint8_t carry = (line & 8) ? 0x40 : 0x00;
+
+					XCTAssert(matches(harness, carry,
+						[&](uint8_t *target) { harness.output_text(target, source.data(), Columns, pixel_row); },
+						[&](uint8_t *target) { harness.reference_text(target, source.data(), Columns, pixel_row); }
+					), @"Text differs on line %d", line);
+
+					XCTAssert(matches(harness, carry,
+						[&](uint8_t *target) { harness.output_double_text(target, source.data(), auxiliary_source.data(), Columns, pixel_row); },
+						[&](uint8_t *target) { harness.reference_double_text(target, source.data(), auxiliary_source.data(), Columns, pixel_row); }
+					), @"80-column text differs on line %d", line);
+
+					XCTAssert(matches(harness, carry,
+						[&](uint8_t *target) { harness.output_high_resolution(target, source.data(), Columns); },
+						[&](uint8_t *target) { harness.reference_high_resolution(target, source.data(), Columns); }
+					), @"High resolution differs on line %d", line);
+
+					XCTAssert(matches(harness, carry,
+						[&](uint8_t *target) { harness.output_double_high_resolution(target, source.data(), auxiliary_source.data(), Columns); },
+						[&](uint8_t *target) { harness.reference_double_high_resolution(target, source.data(), auxiliary_source.data(), Columns); }
+					), @"Double high resolution differs on line %d", line);
+				}
+			}
+		}
+	}
+}
+
+@end
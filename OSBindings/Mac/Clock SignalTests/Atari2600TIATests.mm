@@ -0,0 +1,162 @@
+//
+//  Atari2600TIATests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/Atari/2600/TIA.hpp"
+
+#include <vector>
+
+namespace {
+
+/// Records every run of pixel data that reaches it.
+class CapturingScanTarget: public Outputs::Display::ScanTarget {
+	public:
+		std::vector<std::vector<uint8_t>> data;
+
+		void set_modals(Modals) final {}
+		Scan *begin_scan() final {
+			return &scan_;
+		}
+		uint8_t *begin_data(size_t required_length, size_t) final {
+			buffer_.resize(required_length * 2);
+			return buffer_.data();
+		}
+		void end_data(size_t actual_length) final {
+			data.emplace_back(buffer_.begin(), buffer_.begin() + ptrdiff_t(actual_length * 2));
+		}
+
+	private:
+		Scan scan_;
+		std::vector<uint8_t> buffer_;
+};
+
+constexpr int CyclesPerLine = 228;
+
+/// Holds a TIA and the output captured from it.
+struct CapturedTIA {
+	Atari2600::TIA tia;
+	CapturingScanTarget target;
+	std::vector<uint8_t> collisions;
+
+	CapturedTIA() {
+		tia.set_scan_target(&target);
+	}
+};
+
+/*!
+	Runs a frame through @c captured that changes colours and playfield priority between lines but
+	never during one. If @c split_lines is @c true then each line is run in two parts, which
+	prevents the TIA from treating any line as free of register writes.
+*/
+void run_frame(CapturedTIA &captured, bool split_lines) {
+	auto &tia = captured.tia;
+
+	tia.set_playfield(0, 0xa0);
+	tia.set_playfield(1, 0x5a);
+	tia.set_playfield(2, 0xc3);
+	tia.set_player_graphic(0, 0x81);
+	tia.set_player_graphic(1, 0x3c);
+	tia.set_player_number_and_size(0, 0x03);
+	tia.set_player_number_and_size(1, 0x05);
+	tia.set_missile_enable(0, true);
+	tia.set_missile_enable(1, true);
+	tia.set_ball_enable(true);
+
+	for(int line = 0; line < 262; line++) {
+		tia.set_sync(line < 3);
+		tia.set_blank(line < 37 || line >= 229);
+
+		// Move objects horizontally in a selection of lines, so that they overlap differently.
+		if(line >= 40 && line < 200 && !(line % 7)) {
+			tia.set_player_motion(0, 0x70);
+			tia.set_player_motion(1, 0x90);
+			tia.set_missile_motion(0, 0x30);
+			tia.set_missile_motion(1, 0xd0);
+			tia.set_ball_motion(0x50);
+			tia.move();
+		}
+
+		switch(line) {
+			case 0:
+				tia.set_background_colour(0x12);
+				tia.set_playfield_ball_colour(0x46);
+				tia.set_player_missile_colour(0, 0x8a);
+				tia.set_player_missile_colour(1, 0xce);
+				tia.set_playfield_control_and_ball_size(0x00);
+			break;
+			case 60:	tia.set_player_missile_colour(1, 0x3a);			break;
+			case 80:	tia.set_playfield_control_and_ball_size(0x02);	break;	// Score mode.
+			case 100:
+				tia.set_background_colour(0x24);
+				tia.set_player_missile_colour(0, 0x1e);
+			break;
+			case 120:	tia.set_playfield_control_and_ball_size(0x04);	break;	// Playfield above players.
+			case 140:
+				tia.set_playfield_ball_colour(0x9c);
+				tia.set_player_missile_colour(1, 0x62);
+			break;
+			case 160:	tia.set_playfield_control_and_ball_size(0x31);	break;	// Reflected; standard priority.
+			case 180:	tia.set_playfield_control_and_ball_size(0x03);	break;	// Score mode and reflected.
+			case 200:	tia.set_background_colour(0xf8);				break;
+			default: break;
+		}
+
+		if(split_lines) {
+			tia.run_for(Cycles(100));
+			tia.run_for(Cycles(CyclesPerLine - 100));
+		} else {
+			tia.run_for(Cycles(CyclesPerLine));
+		}
+
+		uint8_t collisions = 0;
+		for(int c = 0; c < 8; c++) {
+			collisions |= tia.get_collision_flags(c);
+		}
+		captured.collisions.push_back(collisions);
+		tia.clear_collision_flags();
+	}
+}
+
+}
+
+@interface Atari2600TIATests : XCTestCase
+@end
+
+@implementation Atari2600TIATests
+
+- (void)testVisibleLineMatchesPerPixel {
+	CapturedTIA whole, split;
+
+	// Objects aren't yet in step during the first visible line after power-on, regardless of path; skip that frame.
+	run_frame(whole, false);
+	run_frame(split, true);
+	whole.target.data.clear();
+	split.target.data.clear();
+	whole.collisions.clear();
+	split.collisions.clear();
+
+	for(int frame = 0; frame < 3; frame++) {
+		run_frame(whole, false);
+		run_frame(split, true);
+	}
+
+	XCTAssertGreaterThan(whole.target.data.size(), 500);
+	XCTAssertEqual(whole.target.data.size(), split.target.data.size());
+	XCTAssert(whole.collisions == split.collisions);
+
+	const size_t lines = std::min(whole.target.data.size(), split.target.data.size());
+	for(size_t c = 0; c < lines; c++) {
+		if(whole.target.data[c] != split.target.data[c]) {
+			XCTFail(@"Output differs in run %zu", c);
+			break;
+		}
+	}
+}
+
+@end
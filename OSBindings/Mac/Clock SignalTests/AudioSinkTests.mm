@@ -0,0 +1,192 @@
+//
+//  AudioSinkTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Outputs/Speaker/AudioSink.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+namespace {
+
+/// @returns @c count samples, counting upwards from @c start.
+std::vector<int16_t> ramp(int start, size_t count) {
+	std::vector<int16_t> samples(count);
+	for(size_t c = 0; c < count; c++) {
+		samples[c] = int16_t(start + int(c));
+	}
+	return samples;
+}
+
+void post(Outputs::Speaker::AudioSink &sink, const std::vector<int16_t> &samples) {
+	sink.speaker_did_complete_samples(nullptr, samples);
+}
+
+std::vector<uint8_t> contents(const std::string &file_name) {
+	std::vector<uint8_t> result;
+	FILE *const file = fopen(file_name.c_str(), "rb");
+	if(!file) return result;
+
+	uint8_t byte;
+	while(fread(&byte, 1, 1, file) == 1) result.push_back(byte);
+	fclose(file);
+	return result;
+}
+
+uint32_t le32(const std::vector<uint8_t> &data, size_t offset) {
+	return uint32_t(data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | (data[offset + 3] << 24));
+}
+
+uint16_t le16(const std::vector<uint8_t> &data, size_t offset) {
+	return uint16_t(data[offset] | (data[offset + 1] << 8));
+}
+
+std::string temporary_file(const char *name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}
+
+@interface AudioSinkTests : XCTestCase
+@end
+
+@implementation AudioSinkTests
+
+- (void)testWrapAround {
+	// Post and read in amounts that don't divide the buffer size, so that both sides wrap repeatedly.
+	Outputs::Speaker::AudioSink sink(16);
+	int next_posted = 0, next_read = 0;
+	for(int c = 0; c < 100; c++) {
+		post(sink, ramp(next_posted, 7));
+		next_posted += 7;
+		XCTAssertEqual(sink.available(), 7);
+
+		int16_t target[7];
+		XCTAssertEqual(sink.read(target, 7), 7);
+		for(int s = 0; s < 7; s++) {
+			XCTAssertEqual(target[s], int16_t(next_read + s));
+		}
+		next_read += 7;
+	}
+	XCTAssertEqual(sink.available(), 0);
+	XCTAssertEqual(sink.overflowed(), 0);
+}
+
+- (void)testUnderrun {
+	Outputs::Speaker::AudioSink sink(16);
+	post(sink, ramp(100, 3));
+
+	// A read of more than is available should be padded with silence.
+	int16_t target[6] = {-1, -1, -1, -1, -1, -1};
+	XCTAssertEqual(sink.read(target, 6), 3);
+	XCTAssertEqual(target[0], 100);
+	XCTAssertEqual(target[2], 102);
+	XCTAssertEqual(target[3], 0);
+	XCTAssertEqual(target[5], 0);
+}
+
+- (void)testOverrun {
+	// Once the reader has stalled, the newest samples should be discarded and counted.
+	Outputs::Speaker::AudioSink sink(16);
+	post(sink, ramp(0, 10));
+	post(sink, ramp(10, 10));
+	XCTAssertEqual(sink.available(), 16);
+	XCTAssertEqual(sink.overflowed(), 4);
+
+	int16_t target[16];
+	XCTAssertEqual(sink.read(target, 16), 16);
+	for(int s = 0; s < 16; s++) {
+		XCTAssertEqual(target[s], s);
+	}
+
+	// Having been drained, the buffer should accept further samples, across the wrap.
+	post(sink, ramp(50, 12));
+	XCTAssertEqual(sink.overflowed(), 4);
+	XCTAssertEqual(sink.read(target, 16), 12);
+	XCTAssertEqual(target[0], 50);
+	XCTAssertEqual(target[11], 61);
+}
+
+- (void)testLatencyLimit {
+	Outputs::Speaker::AudioSink sink(64);
+	sink.set_latency_limit(8);
+	post(sink, ramp(0, 20));
+
+	// Only the eight most recent samples should be read.
+	int16_t target[20];
+	XCTAssertEqual(sink.read(target, 20), 8);
+	XCTAssertEqual(target[0], 12);
+	XCTAssertEqual(target[7], 19);
+	XCTAssertEqual(sink.available(), 0);
+}
+
+- (void)testWAVCapture {
+	const auto file_name = temporary_file("AudioSinkTests.wav");
+
+	// Capture enough to cycle through the pool of capture blocks several times, in posts that don't align with blocks.
+	constexpr size_t Samples = 500'000;
+	{
+		Outputs::Speaker::AudioSink sink(1024);
+		sink.start_capture(file_name, Outputs::Speaker::AudioSink::CaptureFormat::WAV, 22050, true);
+
+		int16_t discard[1000];
+		for(size_t c = 0; c < Samples; c += 1000) {
+			post(sink, ramp(int(c), 1000));
+			sink.read(discard, 1000);
+		}
+		sink.stop_capture();
+	}
+
+	const auto wav = contents(file_name);
+	std::filesystem::remove(file_name);
+	XCTAssertEqual(wav.size(), 44 + Samples * 2);
+	if(wav.size() != 44 + Samples * 2) return;
+
+	XCTAssert(std::equal(wav.begin(), wav.begin() + 4, "RIFF"));
+	XCTAssertEqual(le32(wav, 4), wav.size() - 8);
+	XCTAssert(std::equal(wav.begin() + 8, wav.begin() + 16, "WAVEfmt "));
+	XCTAssertEqual(le32(wav, 16), 16);
+	XCTAssertEqual(le16(wav, 20), 1);				// PCM.
+	XCTAssertEqual(le16(wav, 22), 2);				// Channels.
+	XCTAssertEqual(le32(wav, 24), 22050);			// Sample rate.
+	XCTAssertEqual(le32(wav, 28), 22050 * 4);		// Bytes per second.
+	XCTAssertEqual(le16(wav, 32), 4);				// Bytes per frame.
+	XCTAssertEqual(le16(wav, 34), 16);				// Bits per sample.
+	XCTAssert(std::equal(wav.begin() + 36, wav.begin() + 40, "data"));
+	XCTAssertEqual(le32(wav, 40), Samples * 2);
+
+	for(size_t c = 0; c < Samples; c++) {
+		if(int16_t(le16(wav, 44 + c * 2)) != int16_t(c)) {
+			XCTFail(@"Captured sample differs");
+			break;
+		}
+	}
+}
+
+- (void)testRawCapture {
+	const auto file_name = temporary_file("AudioSinkTests.raw");
+	{
+		Outputs::Speaker::AudioSink sink(16);
+		sink.start_capture(file_name, Outputs::Speaker::AudioSink::CaptureFormat::Raw, 44100, false);
+
+		// Capture should include samples that don't fit in the ring buffer.
+		post(sink, ramp(-10, 40));
+	}
+
+	const auto raw = contents(file_name);
+	std::filesystem::remove(file_name);
+	XCTAssertEqual(raw.size(), 80);
+	if(raw.size() != 80) return;
+	for(size_t c = 0; c < 40; c++) {
+		XCTAssertEqual(int16_t(le16(raw, c * 2)), int16_t(int(c) - 10));
+	}
+}
+
+@end
@@ -0,0 +1,275 @@
+//
+//  BandLimitedStepTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Components/AY38910/AY38910.hpp"
+#include "../../../Outputs/Speaker/Implementation/BandLimitedStepBuffer.hpp"
+#include "../../../Outputs/Speaker/Implementation/LowpassSpeaker.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+constexpr float InputRate = 1'000'000.0f;
+constexpr float OutputRate = 44'100.0f;
+
+/// The delay, in output samples, that BandLimitedStepBuffer applies at the rates above with no
+/// additional cut-off: half the width of its step response.
+constexpr double StepDelay = 16.0;
+
+/// The amount, in output samples, by which the polyphase filter's output leads its input: each output
+/// sample is the filtered window that begins at its own time, so is centred half the number of taps later.
+double polyphase_lead() {
+	const double taps = double(size_t(std::ceil((InputRate + OutputRate / 2.0f) / (OutputRate / 2.0f))) * 2 + 1);
+	return (taps - 1.0) * 0.5 * double(OutputRate) / double(InputRate);
+}
+
+/*!
+	A square wave with a half-period of @c half_period input cycles, alternating between
+	zero and half of the volume range.
+*/
+class SquareWave: public Outputs::Speaker::BufferSource<SquareWave, false> {
+	public:
+		SquareWave(int half_period) : half_period_(half_period) {}
+
+		template <Outputs::Speaker::Action action>
+		void apply_samples(std::size_t number_of_samples, Outputs::Speaker::MonoSample *target) {
+			for(std::size_t c = 0; c < number_of_samples; c++) {
+				if constexpr (action != Outputs::Speaker::Action::Ignore) {
+					Outputs::Speaker::apply<action>(target[c], level());
+				}
+				advance();
+			}
+		}
+
+		static constexpr bool has_band_limited_steps = true;
+		template <typename TargetT>
+		void apply_steps(std::size_t number_of_samples, TargetT &target) {
+			for(std::size_t c = 0; c < number_of_samples; c++) {
+				target.add_transition(c, last_level_, level());
+				last_level_ = level();
+				advance();
+			}
+		}
+
+		void set_sample_volume_range(std::int16_t range) {
+			volume_ = range / 2;
+		}
+
+		bool is_zero_level() const {
+			return false;
+		}
+
+	private:
+		const int half_period_;
+		int phase_ = 0;
+		bool high_ = false;
+		Outputs::Speaker::MonoSample volume_ = 0;
+		Outputs::Speaker::MonoSample last_level_ = 0;
+
+		Outputs::Speaker::MonoSample level() const {
+			return high_ ? volume_ : 0;
+		}
+		void advance() {
+			if(++phase_ == half_period_) {
+				phase_ = 0;
+				high_ ^= true;
+			}
+		}
+};
+
+struct Collector: public Outputs::Speaker::Speaker::Delegate {
+	std::vector<int16_t> samples;
+
+	void speaker_did_complete_samples(Outputs::Speaker::Speaker *, const std::vector<int16_t> &buffer) final {
+		samples.insert(samples.end(), buffer.begin(), buffer.end());
+	}
+};
+
+/// @returns Output of a PullLowpass that has been supplied with a second of a square wave.
+std::vector<int16_t> square_wave(int half_period, bool use_steps) {
+	Concurrency::AsyncTaskQueue<false> queue;
+	SquareWave source(half_period);
+	Outputs::Speaker::PullLowpass<SquareWave> speaker(source);
+	Collector collector;
+
+	speaker.set_input_rate(InputRate);
+	speaker.set_output_rate(OutputRate, 512, false);
+	speaker.set_band_limited_steps_enabled(use_steps);
+	speaker.set_delegate(&collector);
+
+	for(int c = 0; c < 100; c++) {
+		speaker.run_for(queue, Cycles(10'000));
+	}
+	queue.flush();
+	return collector.samples;
+}
+
+/// Reconstructs the sample stream described by a series of transitions.
+struct StepRecorder {
+	std::vector<int16_t> samples;
+	int16_t level = 0;
+	size_t time = 0;
+	bool is_continuous = true;
+
+	void add_transition(size_t offset, int16_t from, int16_t to) {
+		is_continuous &= from == level;
+		samples.resize(time + offset, level);
+		level = to;
+	}
+
+	void advance(size_t cycles) {
+		time += cycles;
+		samples.resize(time, level);
+	}
+};
+
+void write(GI::AY38910::AY38910<false> &ay, uint8_t reg, uint8_t value) {
+	GI::AY38910::Utility::select_register(ay, reg);
+	GI::AY38910::Utility::write_data(ay, value);
+}
+
+/// @returns The root-mean-square difference between @c lhs and @c rhs when @c rhs is shifted earlier by @c offset samples.
+double rms_difference(const std::vector<int16_t> &lhs, const std::vector<int16_t> &rhs, size_t offset) {
+	constexpr size_t Start = 200;
+	const size_t end = std::min(lhs.size(), rhs.size() - offset);
+
+	double total = 0.0;
+	for(size_t c = Start; c < end; c++) {
+		const double difference = double(lhs[c]) - double(rhs[c + offset]);
+		total += difference * difference;
+	}
+	return std::sqrt(total / double(end - Start));
+}
+
+}
+
+@interface BandLimitedStepTests : XCTestCase
+@end
+
+@implementation BandLimitedStepTests
+
+- (void)testStepDelay {
+	// A single step should cross its midpoint half the width of the step response after it was posted.
+	Outputs::Speaker::BandLimitedStepBuffer<false> buffer;
+	buffer.set_rates(InputRate, OutputRate, 0.0f);
+
+	constexpr size_t Offset = 2000;
+	std::vector<int16_t> output;
+	size_t time = 0;
+	while(time < 40'000) {
+		const size_t cycles = std::min(buffer.get_input_capacity(), size_t(1000));
+		if(time <= Offset && Offset < time + cycles) {
+			buffer.add_transition(Offset - time, 0, 16384);
+		}
+		buffer.advance(cycles);
+		time += cycles;
+
+		const size_t available = buffer.get_available();
+		output.resize(output.size() + available);
+		buffer.read(available, &output[output.size() - available], 65536);
+	}
+
+	// Find the midpoint crossing, to a fraction of a sample.
+	double crossing = -1.0;
+	for(size_t c = 1; c < output.size(); c++) {
+		if(output[c - 1] < 8192 && output[c] >= 8192) {
+			crossing = double(c - 1) + double(8192 - output[c - 1]) / double(output[c] - output[c - 1]);
+			break;
+		}
+	}
+
+	const double expected = double(Offset) * double(OutputRate) / double(InputRate) + StepDelay;
+	XCTAssertLessThan(std::abs(crossing - expected), 0.5);
+
+	// The step should settle at exactly its full height.
+	XCTAssertEqual(output.back(), 16384);
+}
+
+- (void)testMatchesPolyphase {
+	// Compare a square wave synthesised from steps with the same wave filtered at the input rate,
+	// having compensated for the difference in delay between the two.
+	// Each wave's period exceeds the range of alignments searched, so there's only one good alignment.
+	for(const int half_period: {1103, 800}) {
+		const auto steps = square_wave(half_period, true);
+		const auto filtered = square_wave(half_period, false);
+		XCTAssertGreaterThan(steps.size(), 40'000);
+		XCTAssertGreaterThan(filtered.size(), 40'000);
+
+		// Find the best alignment.
+		size_t best_offset = 0;
+		double best_difference = rms_difference(filtered, steps, 0);
+		for(size_t offset = 1; offset < 64; offset++) {
+			const double difference = rms_difference(filtered, steps, offset);
+			if(difference < best_difference) {
+				best_difference = difference;
+				best_offset = offset;
+			}
+		}
+
+		// That should be the difference in the two delays. At that alignment the two should differ by no
+		// more than a small proportion of the wave's amplitude of 16383; they apply differently-shaped
+		// filters with slightly different cut-offs, so ring a little differently around each edge.
+		XCTAssertLessThanOrEqual(std::abs(double(best_offset) - (StepDelay + polyphase_lead())), 1.0);
+		XCTAssertLessThan(best_difference, 16383.0 * 0.05);
+	}
+}
+
+- (void)testAYStepsMatchSamples {
+	// The AY skips periods in which no audible counter expires; that should have no effect on output.
+	// Test tones alone, then also noise and an envelope.
+	for(const bool noise_and_envelope: {false, true}) {
+		Concurrency::AsyncTaskQueue<false> sample_queue, step_queue;
+		GI::AY38910::AY38910<false> sampled(GI::AY38910::Personality::AY38910, sample_queue);
+		GI::AY38910::AY38910<false> stepped(GI::AY38910::Personality::AY38910, step_queue);
+		sampled.set_sample_volume_range(32767);
+		stepped.set_sample_volume_range(32767);
+
+		std::vector<int16_t> samples;
+		StepRecorder steps;
+		size_t length = 1;
+		for(int frame = 0; frame < 50; frame++) {
+			for(auto ay: {&sampled, &stepped}) {
+				write(*ay, 7, noise_and_envelope ? 0x18 : 0x38);
+				write(*ay, 8, 15);
+				write(*ay, 9, 12);
+				write(*ay, 10, noise_and_envelope ? 0x10 : 10);
+				write(*ay, 6, 8);
+				write(*ay, 11, 0x40);
+				if(!frame) write(*ay, 13, 14);
+				for(uint8_t channel = 0; channel < 3; channel++) {
+					const int period = (0x1dd - ((frame * (channel + 1) * 23) & 0xff)) >> channel;
+					write(*ay, channel * 2, uint8_t(period));
+					write(*ay, channel * 2 + 1, uint8_t(period >> 8));
+				}
+			}
+			sample_queue.flush();
+			step_queue.flush();
+
+			// Use a variety of lengths, to cover partial divider periods.
+			size_t remaining = 20'000;
+			while(remaining) {
+				const size_t cycles = std::min(remaining, length);
+				length = (length * 7) % 1013 + 1;
+				remaining -= cycles;
+
+				samples.resize(samples.size() + cycles);
+				sampled.apply_samples<Outputs::Speaker::Action::Store>(cycles, &samples[samples.size() - cycles]);
+				stepped.apply_steps(cycles, steps);
+				steps.advance(cycles);
+			}
+		}
+
+		XCTAssert(steps.is_continuous);
+		XCTAssert(samples == steps.samples);
+	}
+}
+
+@end
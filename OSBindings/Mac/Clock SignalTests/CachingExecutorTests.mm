@@ -0,0 +1,219 @@
+//
+//  CachingExecutorTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../InstructionSets/CachingExecutor.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace {
+
+/*!
+	A minimal instruction set, sufficient to exercise CachingExecutor:
+
+		00			increment the accumulator;
+		01 ll hh	jump to hhll;
+		02 ll hh vv	write vv to hhll;
+		03			decrement the accumulator;
+
+	with all other opcodes being one-byte NOPs.
+*/
+enum Opcode: uint8_t {
+	Increment = 0x00,
+	Jump = 0x01,
+	Write = 0x02,
+	Decrement = 0x03,
+	NOP = 0x04,
+};
+
+class Executor;
+using CachingExecutor = InstructionSet::CachingExecutor<Executor, 0xfff, NOP, uint8_t, false>;
+
+class Executor: public CachingExecutor {
+	public:
+		Executor() {
+			performers_[Increment] = &Executor::increment;
+			performers_[Jump] = &Executor::jump;
+			performers_[Write] = &Executor::write_memory;
+			performers_[Decrement] = &Executor::decrement;
+			performers_[NOP] = &Executor::nop;
+			memory.fill(NOP);
+		}
+
+		std::array<uint8_t, 4096> memory;
+		int accumulator = 0;
+		int parses = 0;
+
+		void run_for(int instructions) {
+			CachingExecutor::run_for(instructions);
+		}
+		void set_program_counter(uint16_t address) {
+			CachingExecutor::set_program_counter(address);
+		}
+
+		/// Writes to memory from outside of the executor.
+		void write(uint16_t address, uint8_t value) {
+			memory[address & 0xfff] = value;
+			invalidate(address & 0xfff);
+		}
+
+	private:
+		friend CachingExecutor;
+
+		PerformerIndex action_for(uint8_t opcode) {
+			return std::min(opcode, uint8_t(NOP));
+		}
+
+		static int length(uint8_t opcode) {
+			switch(opcode) {
+				case Jump:	return 3;
+				case Write:	return 4;
+				default:	return 1;
+			}
+		}
+
+		void parse(uint16_t start, uint16_t closing_bound) {
+			++parses;
+			uint16_t address = start;
+			while(true) {
+				const uint8_t opcode = memory[address];
+				if(address + length(opcode) - 1 > closing_bound) {
+					announce_overflow(address);
+					return;
+				}
+				announce_instruction(address, opcode);
+				if(opcode == Jump) return;
+				address += length(opcode);
+			}
+		}
+
+		uint16_t operand(int offset) const {
+			return memory[(program_counter_ + offset) & 0xfff];
+		}
+
+		void increment() {
+			++accumulator;
+			++program_counter_;
+			subtract_duration(1);
+		}
+		void decrement() {
+			--accumulator;
+			++program_counter_;
+			subtract_duration(1);
+		}
+		void nop() {
+			++program_counter_;
+			subtract_duration(1);
+		}
+		void jump() {
+			CachingExecutor::set_program_counter(uint16_t(operand(1) | (operand(2) << 8)));
+			subtract_duration(1);
+		}
+		void write_memory() {
+			const auto address = uint16_t(operand(1) | (operand(2) << 8));
+			const auto value = uint8_t(operand(3));
+			program_counter_ += 4;
+			write(address, value);
+			subtract_duration(1);
+		}
+};
+
+}
+
+@interface CachingExecutorTests : XCTestCase
+@end
+
+@implementation CachingExecutorTests
+
+- (void)testLoopIsParsedOnce {
+	auto executor = std::make_unique<Executor>();
+
+	// INC; INC; JMP 0x000.
+	executor->memory[0] = Increment;
+	executor->memory[1] = Increment;
+	executor->memory[2] = Jump;
+	executor->memory[3] = 0x00;
+	executor->memory[4] = 0x00;
+	executor->set_program_counter(0);
+
+	executor->run_for(3000);
+	XCTAssertEqual(executor->accumulator, 2000);
+	XCTAssertEqual(executor->parses, 1);
+}
+
+- (void)testExternalWriteInvalidates {
+	auto executor = std::make_unique<Executor>();
+
+	// INC; JMP 0x000.
+	executor->memory[0] = Increment;
+	executor->memory[1] = Jump;
+	executor->memory[2] = 0x00;
+	executor->memory[3] = 0x00;
+	executor->set_program_counter(0);
+
+	executor->run_for(200);
+	XCTAssertEqual(executor->accumulator, 100);
+
+	// Replace the increment with a decrement; the cached sequence should be discarded.
+	executor->write(0, Decrement);
+	executor->run_for(200);
+	XCTAssertEqual(executor->accumulator, 0);
+	XCTAssertEqual(executor->parses, 2);
+
+	// A write to a different page should have no effect on the cache.
+	executor->write(0x800, Increment);
+	executor->run_for(200);
+	XCTAssertEqual(executor->accumulator, -100);
+	XCTAssertEqual(executor->parses, 2);
+}
+
+- (void)testSelfModificationWithinSequence {
+	auto executor = std::make_unique<Executor>();
+
+	// INC; WRITE 0x000, DEC; INC; JMP 0x000.
+	const uint8_t program[] = {Increment, Write, 0x00, 0x00, Decrement, Increment, Jump, 0x00, 0x00};
+	std::copy(std::begin(program), std::end(program), executor->memory.begin());
+	executor->set_program_counter(0);
+
+	// The first pass should increment twice; thereafter the first instruction is a decrement,
+	// so each subsequent four-instruction pass should have a net effect of zero. The instruction
+	// that follows the write in the first pass must be performed despite the write having
+	// discarded the sequence that contains it.
+	executor->run_for(4 + 4*10);
+	XCTAssertEqual(executor->accumulator, 2);
+}
+
+- (void)testPageStraddling {
+	auto executor = std::make_unique<Executor>();
+
+	// At 0x3fe, i.e. two bytes before the end of the first page: JMP 0x3fe, with the high byte of
+	// its operand in the next page.
+	executor->memory[0x3fe] = Jump;
+	executor->memory[0x3ff] = 0xfe;
+	executor->memory[0x400] = 0x03;
+	executor->set_program_counter(0x3fe);
+
+	executor->run_for(10);
+	XCTAssertEqual(executor->parses, 2);	// One overflowed attempt, then one that crosses into the next page.
+
+	// A write to the second page should invalidate the sequence in the first.
+	executor->write(0x401, NOP);
+	executor->run_for(10);
+	XCTAssertEqual(executor->parses, 4);
+
+	// Rewrite the jump as INC; INC; INC and run into the next page.
+	executor->write(0x3fe, Increment);
+	executor->write(0x3ff, Increment);
+	executor->write(0x400, Increment);
+	executor->run_for(3);
+	XCTAssertEqual(executor->accumulator, 3);
+}
+
+@end
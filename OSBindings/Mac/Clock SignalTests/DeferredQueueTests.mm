@@ -0,0 +1,137 @@
+//
+//  DeferredQueueTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../ClockReceiver/DeferredQueue.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+/// A record of which actions were performed, and when.
+struct Log {
+	struct Event {
+		int id;
+		int time;
+		bool operator ==(const Event &rhs) const {
+			return id == rhs.id && time == rhs.time;
+		}
+	};
+	std::vector<Event> events;
+	int now = 0;
+};
+
+/*!
+	Defers the same sequence of actions to both a DeferredQueue and a FixedDeferredQueue, advancing
+	each by the same varying amounts, and @returns @c true if both performed the same actions at the same times.
+*/
+template <size_t Capacity> bool matches_reference(int count, int max_delay) {
+	DeferredQueue<int> reference;
+	FixedDeferredQueue<int, Capacity> fixed;
+	Log reference_log, fixed_log;
+
+	std::mt19937 random(count);
+	std::uniform_int_distribution<int> delays(0, max_delay);
+	std::uniform_int_distribution<int> steps(0, 5);
+
+	for(int c = 0; c < count; c++) {
+		const int delay = delays(random);
+		reference.defer(delay, [&reference_log, c] {
+			reference_log.events.push_back({c, reference_log.now});
+		});
+		fixed.defer(delay, [log = &fixed_log, c] {
+			log->events.push_back({c, log->now});
+		});
+
+		if(reference.time_until_next_action() != fixed.time_until_next_action()) return false;
+
+		const int step = steps(random);
+		reference_log.now += step;
+		fixed_log.now += step;
+		reference.advance(step);
+		fixed.advance(step);
+	}
+
+	while(!reference.empty()) {
+		if(fixed.empty()) return false;
+		if(reference.time_until_next_action() != fixed.time_until_next_action()) return false;
+
+		reference_log.now += 1;
+		fixed_log.now += 1;
+		reference.advance(1);
+		fixed.advance(1);
+	}
+
+	return fixed.empty() && reference_log.events == fixed_log.events && int(fixed_log.events.size()) == count;
+}
+
+}
+
+@interface DeferredQueueTests : XCTestCase
+@end
+
+@implementation DeferredQueueTests
+
+- (void)testOrdering {
+	FixedDeferredQueue<int> queue;
+	std::vector<int> order;
+
+	queue.defer(10, [&order] { order.push_back(10); });
+	queue.defer(5, [&order] { order.push_back(5); });
+	queue.defer(20, [&order] { order.push_back(20); });
+	queue.defer(5, [&order] { order.push_back(50); });	// Same time as an earlier deferral; should be performed first.
+	queue.defer(0, [&order] { order.push_back(0); });	// No delay; should be performed immediately.
+
+	XCTAssert(order == std::vector<int>({0}));
+	XCTAssertEqual(queue.time_until_next_action(), 5);
+
+	queue.advance(4);
+	XCTAssertEqual(queue.time_until_next_action(), 1);
+	XCTAssert(order == std::vector<int>({0}));
+
+	queue.advance(1);
+	XCTAssert(order == std::vector<int>({0, 50, 5}));
+	XCTAssertEqual(queue.time_until_next_action(), 5);
+
+	// A single advance across several actions should perform all of them, in order.
+	queue.advance(100);
+	XCTAssert(order == std::vector<int>({0, 50, 5, 10, 20}));
+	XCTAssert(queue.empty());
+	XCTAssertEqual(queue.time_until_next_action(), -1);
+}
+
+- (void)testAdvanceAcrossSeveral {
+	XCTAssert(matches_reference<32>(1000, 20));
+}
+
+- (void)testOverflow {
+	// Defer many more actions than there is inline space for; none should be performed early.
+	FixedDeferredQueue<int, 4> queue;
+	std::vector<int> order;
+	for(int c = 0; c < 20; c++) {
+		queue.defer(100 - c, [&order, c] { order.push_back(c); });
+	}
+	XCTAssert(order.empty());
+	XCTAssertEqual(queue.time_until_next_action(), 81);
+
+	queue.advance(90);
+	XCTAssertEqual(order.size(), 10);
+	queue.advance(10);
+	XCTAssertEqual(order.size(), 20);
+	for(int c = 0; c < 20; c++) {
+		XCTAssertEqual(order[size_t(c)], 19 - c);
+	}
+	XCTAssert(queue.empty());
+
+	// Compare longer random sequences that repeatedly exceed the inline space.
+	XCTAssert(matches_reference<4>(1000, 100));
+}
+
+@end
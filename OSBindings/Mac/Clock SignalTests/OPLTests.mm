@@ -9,8 +9,12 @@
 #import <XCTest/XCTest.h>
 
 #include "Tables.hpp"
+#include "PhaseGenerator.hpp"
+#include "../../../Components/OPx/OPLL.hpp"
 
 #include <cmath>
+#include <random>
+#include <vector>
 
 @interface OPLTests: XCTestCase
 @end
@@ -31,6 +35,90 @@
 	}
 }
 
+// MARK: - Operator bank tests
+
+- (void)testPhaseGeneratorBank {
+	constexpr int precision = 9;
+	constexpr int count = 18;
+	std::mt19937 random(2020);
+
+	Yamaha::OPL::PhaseGenerator<precision> generators[count];
+	Yamaha::OPL::PhaseGeneratorBank<precision, count> bank;
+	Yamaha::OPL::LowFrequencyOscillator oscillator;
+
+	for(int step = 0; step < 100'000; ++step) {
+		// Occasionally reprogram a generator.
+		if(!(random() & 63)) {
+			const int index = int(random() % count);
+			const int multiple = int(random() & 15);
+			const int period = int(random() & 511);
+			const int octave = int(random() & 7);
+			const bool vibrato = random() & 1;
+
+			generators[index].set_multiple(multiple);
+			generators[index].set_period(period, octave);
+			generators[index].set_vibrato_enabled(vibrato);
+			bank.set_multiple(index, multiple);
+			bank.set_period(index, period, octave);
+			bank.set_vibrato_enabled(index, vibrato);
+		}
+
+		oscillator.update();
+		bank.update(oscillator);
+		for(int c = 0; c < count; ++c) {
+			generators[c].update(oscillator);
+		}
+
+		// Apply feedback from a random operator output to one generator.
+		const int index = int(random() % count);
+		const auto first = Yamaha::OPL::negative_log_sin(int(random() & 1023));
+		const auto second = Yamaha::OPL::negative_log_sin(int(random() & 1023));
+		const int level = int(random() & 7);
+		generators[index].apply_feedback(first, second, level);
+		bank.apply_feedback(index, first, second, level);
+
+		for(int c = 0; c < count; ++c) {
+			XCTAssertEqual(generators[c].phase(), bank.phase(c), "Phase of generator %d differs at step %d", c, step);
+			XCTAssertEqual(generators[c].scaled_phase(), bank.scaled_phase(c), "Scaled phase of generator %d differs at step %d", c, step);
+		}
+	}
+}
+
+- (void)testOPLLMelodicOutput {
+	Concurrency::AsyncTaskQueue<false> queue;
+	Yamaha::OPL::OPLL opll(queue);
+	opll.set_sample_volume_range(8192);
+	const auto write = [&](uint8_t address, uint8_t value) {
+		opll.write(0, address);
+		opll.write(1, value);
+	};
+
+	// Define a custom instrument with vibrato, tremolo, full feedback and half-sine waves.
+	const uint8_t custom[] = {0xe1, 0xc2, 0x1f, 0x1f, 0xf3, 0xd2, 0x24, 0x35};
+	for(uint8_t c = 0; c < 8; c++) write(c, custom[c]);
+
+	// Key each channel on and off in turn, cycling through instruments, periods and octaves,
+	// and hash the output.
+	std::vector<int16_t> samples(72 * 64);
+	uint32_t hash = 2166136261;
+	for(int step = 0; step < 64; step++) {
+		const int channel = step % 9;
+		write(uint8_t(0x30 + channel), uint8_t(((step * 5) & 0xf0) | (step & 0xf)));
+		write(uint8_t(0x10 + channel), uint8_t(step * 37));
+		write(uint8_t(0x20 + channel), uint8_t(((step & 1) ? 0x10 : 0x00) | ((step & 7) << 1) | ((step >> 3) & 0x21)));
+		queue.flush();
+
+		opll.apply_samples<Outputs::Speaker::Action::Store>(samples.size(), samples.data());
+		for(const auto sample: samples) {
+			hash = (hash ^ uint16_t(sample)) * 16777619;
+		}
+	}
+
+	// This is the hash of output from the per-operator implementation that preceded the
+	// structure-of-arrays one.
+	XCTAssertEqual(hash, 0x0e9b06a5);
+}
+
 // MARK: - Two-operator FM tests
 
 /*- (void)compareFMTo:(NSArray *)knownGood atAttenuation:(int)attenuation {
@@ -0,0 +1,168 @@
+//
+//  PCInstructionCacheTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Numeric/RegisterSizes.hpp"
+#include "../../../InstructionSets/x86/Decoder.hpp"
+#include "../../../InstructionSets/x86/Instruction.hpp"
+#include "../../../Machines/PCCompatible/InstructionCache.hpp"
+#include "../../../Machines/PCCompatible/Memory.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace {
+
+using Instruction = InstructionSet::x86::Instruction<false>;
+using Source = InstructionSet::x86::Source;
+using AccessType = InstructionSet::x86::AccessType;
+
+constexpr uint16_t CodeSegment = 0x0100;
+constexpr uint16_t CodeOffset = 0x0010;
+constexpr uint32_t CodeAddress = (CodeSegment << 4) + CodeOffset;
+
+constexpr uint8_t IncAX = 0x40;
+constexpr uint8_t DecAX = 0x48;
+
+/// A PC's memory, with an instruction cache and decoder, fetching instructions as the PC does.
+struct Fetcher {
+	PCCompatible::Registers registers;
+	PCCompatible::Segments segments;
+	PCCompatible::Memory memory;
+	PCCompatible::InstructionCache<Instruction, PCCompatible::Memory::PageShift> cache;
+	InstructionSet::x86::Decoder<InstructionSet::x86::Model::i8086> decoder;
+
+	Fetcher() : segments(registers), memory(registers, segments) {
+		registers.cs() = CodeSegment;
+		segments.did_update(Source::CS);
+	}
+
+	/// Fetches the instruction at @c ip, setting @c was_cached to indicate whether it came from the cache.
+	Instruction fetch(uint16_t ip, bool &was_cached) {
+		registers.ip() = ip;
+		const uint32_t linear_ip = (segments.cs_base_ + ip) & 0xf'ffff;
+		const uint64_t generation = memory.generation(linear_ip);
+		if(const auto cached = cache.find(linear_ip, generation); cached) {
+			was_cached = true;
+			return cached->second;
+		}
+
+		was_cached = false;
+		const auto remainder = memory.next_code();
+		const auto decoded = decoder.decode(remainder.first, remainder.second);
+		cache.insert(linear_ip, generation, decoded);
+		return decoded.second;
+	}
+};
+
+/// @returns A fetcher with INC AX at CodeAddress, which has been fetched once and is therefore cached.
+std::unique_ptr<Fetcher> cached_inc() {
+	auto fetcher = std::make_unique<Fetcher>();
+	fetcher->memory.write(CodeAddress, IncAX);
+
+	bool was_cached;
+	fetcher->fetch(CodeOffset, was_cached);
+	return fetcher;
+}
+
+}
+
+@interface PCInstructionCacheTests : XCTestCase
+@end
+
+@implementation PCInstructionCacheTests
+
+- (void)testRepeatFetchIsCached {
+	const auto fetcher = cached_inc();
+
+	bool was_cached = false;
+	const auto instruction = fetcher->fetch(CodeOffset, was_cached);
+	XCTAssert(was_cached);
+	XCTAssert(instruction.operation() == InstructionSet::x86::Operation::INC);
+}
+
+- (void)testWriteInvalidates {
+	// Each of the ways that memory can be written should invalidate any cached instruction in the same page.
+	const std::function<void(PCCompatible::Memory &)> writes[] = {
+		[](PCCompatible::Memory &memory) {
+			memory.access<uint8_t, AccessType::Write>(Source::CS, CodeOffset) = DecAX;
+		},
+		[](PCCompatible::Memory &memory) {
+			memory.access<uint8_t, AccessType::ReadModifyWrite>(CodeAddress) = DecAX;
+		},
+		[](PCCompatible::Memory &memory) {
+			memory.access<uint16_t, AccessType::Write>(CodeAddress - 1) = uint16_t(DecAX << 8);
+		},
+		[](PCCompatible::Memory &memory) {
+			memory.preauthorised_write<uint8_t>(Source::CS, CodeOffset, DecAX);
+		},
+		[](PCCompatible::Memory &memory) {
+			memory.write(CodeAddress, DecAX);
+		},
+		[](PCCompatible::Memory &memory) {
+			memory.install(CodeAddress, &DecAX, 1);
+		},
+	};
+
+	int index = 0;
+	for(const auto &write: writes) {
+		const auto fetcher = cached_inc();
+		write(fetcher->memory);
+
+		bool was_cached = true;
+		const auto instruction = fetcher->fetch(CodeOffset, was_cached);
+		XCTAssertFalse(was_cached, @"Write %d didn't invalidate the cache", index);
+		XCTAssert(instruction.operation() == InstructionSet::x86::Operation::DEC, @"Write %d didn't take effect", index);
+		++index;
+	}
+}
+
+- (void)testWriteToUnchangedByteInvalidates {
+	// Even a write that doesn't change the instruction's bytes, but is elsewhere in its page, should invalidate.
+	const auto fetcher = cached_inc();
+	fetcher->memory.write(CodeAddress + 0x40, 0x00);
+
+	bool was_cached = true;
+	fetcher->fetch(CodeOffset, was_cached);
+	XCTAssertFalse(was_cached);
+}
+
+- (void)testWriteToOtherPageRetains {
+	const auto fetcher = cached_inc();
+	fetcher->memory.write(CodeAddress + PCCompatible::Memory::PageSize, DecAX);
+	fetcher->memory.write(CodeAddress - PCCompatible::Memory::PageSize, DecAX);
+
+	bool was_cached = false;
+	const auto instruction = fetcher->fetch(CodeOffset, was_cached);
+	XCTAssert(was_cached);
+	XCTAssert(instruction.operation() == InstructionSet::x86::Operation::INC);
+}
+
+- (void)testPageStraddlingInstructionIsNotCached {
+	// MOV AX, 0x1234 spans three bytes; place it so that it runs into the next page.
+	Fetcher fetcher;
+	const uint16_t ip = uint16_t(PCCompatible::Memory::PageSize - 2 - (CodeSegment << 4) % PCCompatible::Memory::PageSize);
+	const uint32_t address = (CodeSegment << 4) + ip;
+	fetcher.memory.write(address, 0xb8);
+	fetcher.memory.write(address + 1, 0x34);
+	fetcher.memory.write(address + 2, 0x12);
+
+	bool was_cached = true;
+	fetcher.fetch(ip, was_cached);
+	XCTAssertFalse(was_cached);
+	fetcher.fetch(ip, was_cached);
+	XCTAssertFalse(was_cached);
+
+	// A write to the second page must therefore be observed.
+	fetcher.memory.write(address + 2, 0x56);
+	const auto instruction = fetcher.fetch(ip, was_cached);
+	XCTAssertEqual(instruction.operand(), 0x5634);
+}
+
+@end
@@ -0,0 +1,145 @@
+//
+//  PCPITTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../ClockReceiver/ClockReceiver.hpp"
+#include "../../../Machines/PCCompatible/PIT.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace {
+
+/// Records the tick upon which each output change occurs.
+struct RecordingObserver {
+	int tick = 0;
+	std::vector<int> changes[3];
+
+	template <int channel>
+	void update_output(bool) {
+		changes[channel].push_back(tick);
+	}
+};
+
+using PIT = PCCompatible::i8253<false, RecordingObserver>;
+
+/// Programs @c channel with @c mode and a 16-bit reload value of @c reload.
+template <int channel> void program(PIT &pit, int mode, uint16_t reload) {
+	pit.set_mode(uint8_t((channel << 6) | 0x30 | (mode << 1)));
+	pit.write<channel>(uint8_t(reload));
+	pit.write<channel>(uint8_t(reload >> 8));
+}
+
+/// @returns The horizon that the PC's unlimited-speed loop would use.
+int horizon(const PIT &pit) {
+	return std::min(pit.ticks_until_output_change<0>(), pit.ticks_until_output_change<2>());
+}
+
+}
+
+@interface PCPITTests : XCTestCase
+@end
+
+@implementation PCPITTests
+
+- (void)testHorizonPrecedesOutputChanges {
+	// Run a tick at a time, checking that no output change ever occurs before the horizon
+	// reported for it; the PC's unlimited-speed loop depends on this to advance in batches.
+	const struct {
+		int mode0, mode2;
+		uint16_t reload0, reload2;
+	} configurations[] = {
+		{3, 3, 0x1000, 0x0533},		// Square waves, as for the system timer and a speaker tone.
+		{3, 3, 7, 3},				// Odd and very short square waves.
+		{2, 3, 0x0123, 0x0040},		// A rate generator.
+		{2, 2, 2, 5},
+		{0, 3, 0x0800, 0x0100},		// A one-shot interrupt on terminal count.
+		{0, 0, 1, 0x0300},
+	};
+
+	for(const auto &configuration: configurations) {
+		RecordingObserver observer;
+		PIT pit(observer);
+		program<0>(pit, configuration.mode0, configuration.reload0);
+		program<2>(pit, configuration.mode2, configuration.reload2);
+		observer.changes[0].clear();
+		observer.changes[2].clear();
+
+		// Establish the horizon at each tick, then the tick upon which output next changes.
+		constexpr int Ticks = 100'000;
+		std::vector<int> horizons;
+		for(observer.tick = 0; observer.tick < Ticks; observer.tick++) {
+			horizons.push_back(horizon(pit));
+			pit.run_for(Cycles(1));
+		}
+
+		std::vector<int> changes = observer.changes[0];
+		changes.insert(changes.end(), observer.changes[2].begin(), observer.changes[2].end());
+		std::sort(changes.begin(), changes.end());
+		XCTAssertFalse(changes.empty());
+
+		auto next_change = changes.begin();
+		for(int tick = 0; tick < Ticks; tick++) {
+			while(next_change != changes.end() && *next_change < tick) ++next_change;
+			if(next_change == changes.end()) break;
+
+			XCTAssertGreaterThanOrEqual(horizons[size_t(tick)], 1);
+			if(*next_change - tick + 1 < horizons[size_t(tick)]) {
+				XCTFail(@"Output changed at %d, before the horizon of %d at %d (modes %d, %d)",
+					*next_change, horizons[size_t(tick)], tick, configuration.mode0, configuration.mode2);
+				break;
+			}
+		}
+	}
+}
+
+- (void)testBatchedRunMatchesTicks {
+	// Advancing in batches up to the horizon, as the PC's unlimited-speed loop does, should
+	// produce output changes only in the final tick of each batch, and the same changes as
+	// advancing a tick at a time.
+	RecordingObserver batched_observer, ticked_observer;
+	PIT batched(batched_observer), ticked(ticked_observer);
+	for(auto pit: {&batched, &ticked}) {
+		program<0>(*pit, 3, 0x0400);
+		program<2>(*pit, 3, 0x0125);
+	}
+
+	constexpr int MaxBatch = 64;
+	while(batched_observer.tick < 200'000) {
+		const int batch = std::min(horizon(batched), MaxBatch);
+
+		// Attribute all changes within the batch to its final tick.
+		batched_observer.tick += batch - 1;
+		batched.run_for(Cycles(batch));
+		++batched_observer.tick;
+	}
+	for(ticked_observer.tick = 0; ticked_observer.tick < batched_observer.tick; ticked_observer.tick++) {
+		ticked.run_for(Cycles(1));
+	}
+
+	XCTAssertGreaterThan(ticked_observer.changes[0].size(), 100);
+	XCTAssertGreaterThan(ticked_observer.changes[2].size(), 100);
+	XCTAssert(batched_observer.changes[0] == ticked_observer.changes[0]);
+	XCTAssert(batched_observer.changes[2] == ticked_observer.changes[2]);
+}
+
+- (void)testExpiredOneShotHasNoHorizon {
+	RecordingObserver observer;
+	PIT pit(observer);
+	program<0>(pit, 0, 0x0010);
+	XCTAssertEqual(pit.ticks_until_output_change<0>(), 0x10);
+
+	pit.run_for(Cycles(0x10));
+	XCTAssertEqual(observer.changes[0].size(), 1);
+	XCTAssertEqual(pit.ticks_until_output_change<0>(), std::numeric_limits<int>::max());
+}
+
+@end
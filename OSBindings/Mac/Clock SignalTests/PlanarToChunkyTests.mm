@@ -0,0 +1,124 @@
+//
+//  PlanarToChunkyTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Numeric/PlanarToChunky.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <utility>
+
+namespace {
+
+/// Converts sixteen pixels one bit at a time.
+void reference_planar_to_chunky(const uint16_t *planes, int plane_count, uint8_t *target) {
+	for(int pixel = 0; pixel < 16; pixel++) {
+		uint8_t value = 0;
+		for(int plane = 0; plane < plane_count; plane++) {
+			if(planes[plane] & (0x8000 >> pixel)) {
+				value |= 1 << plane;
+			}
+		}
+		target[pixel] = value;
+	}
+}
+
+/// @returns @c true if planar_to_chunky<plane_count> matches the reference for @c planes.
+template <int plane_count> bool matches_reference(const uint16_t *planes) {
+	uint8_t converted[16], expected[16];
+	Numeric::planar_to_chunky<plane_count>(planes, converted);
+	reference_planar_to_chunky(planes, plane_count, expected);
+	return std::equal(std::begin(converted), std::end(converted), std::begin(expected));
+}
+
+template <int... plane_counts> bool all_match_reference(const uint16_t *planes, std::integer_sequence<int, plane_counts...>) {
+	return (matches_reference<plane_counts + 1>(planes) && ...);
+}
+
+}
+
+@interface PlanarToChunkyTests : XCTestCase
+@end
+
+@implementation PlanarToChunkyTests
+
+- (void)testPlanarToChunky {
+	std::mt19937 random(0x16);
+	for(int c = 0; c < 100'000; c++) {
+		uint16_t planes[8];
+		for(auto &plane: planes) plane = uint16_t(random());
+
+		if(!all_match_reference(planes, std::make_integer_sequence<int, 8>())) {
+			XCTFail(@"Conversion differs for planes %04x %04x %04x %04x %04x %04x %04x %04x",
+				planes[0], planes[1], planes[2], planes[3], planes[4], planes[5], planes[6], planes[7]);
+			return;
+		}
+	}
+}
+
+- (void)testSinglePlaneOrdering {
+	// Each bit in isolation should produce exactly one set pixel, counting from the left.
+	for(int bit = 0; bit < 16; bit++) {
+		const uint16_t plane = uint16_t(0x8000 >> bit);
+		uint8_t pixels[16];
+		Numeric::planar_to_chunky<1>(&plane, pixels);
+		for(int pixel = 0; pixel < 16; pixel++) {
+			XCTAssertEqual(pixels[pixel], pixel == bit ? 1 : 0);
+		}
+	}
+}
+
+- (void)testMatchesSTShifter {
+	// Compare against the Atari ST's four-bitplane shifter as it operated prior to use of
+	// planar_to_chunky: one pixel at a time from the top of each 16-bit plane, shifting all
+	// planes left after each.
+	std::mt19937_64 random(0x57);
+	uint16_t palette[16];
+	for(auto &entry: palette) entry = uint16_t(random());
+
+	for(int c = 0; c < 100'000; c++) {
+		const uint64_t shifter = random();
+
+		uint16_t expected[16];
+		uint64_t output_shifter = shifter;
+		for(int pixel = 0; pixel < 16; pixel++) {
+			expected[pixel] = palette[
+				((output_shifter >> 63) & 1) |
+				((output_shifter >> 46) & 2) |
+				((output_shifter >> 29) & 4) |
+				((output_shifter >> 12) & 8)
+			];
+			output_shifter = (output_shifter << 1) & 0xfffe'fffe'fffe'fffe;
+		}
+
+		const uint16_t planes[] = {
+			uint16_t(shifter >> 48),
+			uint16_t(shifter >> 32),
+			uint16_t(shifter >> 16),
+			uint16_t(shifter),
+		};
+		uint8_t indices[16];
+		Numeric::planar_to_chunky<4>(planes, indices);
+
+		uint16_t mapped[16], mapped16[16];
+		Numeric::map_palette(indices, 16, palette, mapped);
+		Numeric::map_palette16(indices, palette, mapped16);
+
+		if(
+			!std::equal(std::begin(mapped), std::end(mapped), std::begin(expected)) ||
+			!std::equal(std::begin(mapped16), std::end(mapped16), std::begin(expected))
+		) {
+			XCTFail(@"Output differs for shifter contents %016llx", (unsigned long long)shifter);
+			return;
+		}
+	}
+}
+
+@end
@@ -0,0 +1,264 @@
+//
+//  RewinderTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Machines/Utility/Rewinder.hpp"
+
+#include "../../../Analyser/Static/ZXSpectrum/Target.hpp"
+#include "CSROMFetcher.hpp"
+#include "MachineForTarget.hpp"
+#include "TimedMachine.hpp"
+
+namespace {
+
+struct TestState: public Reflection::StructImpl<TestState> {
+	int counter = 0;
+	std::vector<uint8_t> log;
+	std::vector<uint8_t> ram;
+
+	TestState() {
+		if(needs_declare()) {
+			DeclareField(counter);
+			DeclareField(log);
+			DeclareField(ram);
+		}
+	}
+};
+
+/// A minimal state producer: a counter, a variable-length log that precedes RAM in
+/// serialised form, and 64kb of RAM.
+struct TestMachine: public MachineTypes::StateProducer {
+	int counter = 0;
+	std::vector<uint8_t> log;
+	std::vector<uint8_t> ram = std::vector<uint8_t>(65536);
+
+	std::unique_ptr<Reflection::Struct> get_state() final {
+		auto state = std::make_unique<TestState>();
+		state->counter = counter;
+		state->log = log;
+		state->ram = ram;
+		return state;
+	}
+
+	bool set_state(const Reflection::Struct &state) final {
+		const auto test_state = dynamic_cast<const TestState *>(&state);
+		if(!test_state) return false;
+		counter = test_state->counter;
+		log = test_state->log;
+		ram = test_state->ram;
+		return true;
+	}
+
+	/// Changes one byte of RAM and grows the log by one byte.
+	void step() {
+		++counter;
+		ram[size_t(counter * 97) % ram.size()] ^= 0xff;
+		log.push_back(uint8_t(counter));
+	}
+};
+
+/// As per TestMachine, but exposing RAM as tracked memory that is marked upon each write
+/// and omitted from serialisation while a rewinder is attached.
+struct TrackedTestMachine: public MachineTypes::StateProducer {
+	int counter = 0;
+	std::vector<uint8_t> ram = std::vector<uint8_t>(65536 + 100);
+	TrackedMemory tracked_ram;
+
+	TrackedTestMachine() {
+		tracked_ram.set_memory(ram.data(), ram.size());
+	}
+
+	std::unique_ptr<Reflection::Struct> get_state() final {
+		auto state = std::make_unique<TestState>();
+		state->counter = counter;
+		if(!tracked_ram.is_external()) {
+			state->ram = ram;
+		}
+		return state;
+	}
+
+	bool set_state(const Reflection::Struct &state) final {
+		const auto test_state = dynamic_cast<const TestState *>(&state);
+		if(!test_state) return false;
+		counter = test_state->counter;
+		if(!tracked_ram.is_external()) {
+			ram = test_state->ram;
+		}
+		return true;
+	}
+
+	TrackedMemory *tracked_memory() final {
+		return &tracked_ram;
+	}
+
+	void step() {
+		++counter;
+		const size_t address = size_t(counter * 97) % ram.size();
+		ram[address] ^= 0xff;
+		tracked_ram.mark(address);
+	}
+};
+
+}
+
+@interface RewinderTests : XCTestCase
+@end
+
+@implementation RewinderTests
+
+- (void)testCapture {
+	TestMachine machine;
+	Utility::Rewinder rewinder(machine, 2, 3);
+
+	XCTAssertEqual(rewinder.size(), 0);
+	XCTAssert(!rewinder.earliest());
+
+	for(int c = 0; c < 10; c++) {
+		machine.step();
+		rewinder.advance();
+	}
+
+	// Snapshots are taken at ticks 2, 4, 6, 8 and 10, of which only the final three are retained.
+	XCTAssertEqual(rewinder.tick(), 10);
+	XCTAssertEqual(rewinder.size(), 3);
+	XCTAssertEqual(*rewinder.earliest(), 6);
+	XCTAssertEqual(*rewinder.latest(), 10);
+}
+
+- (void)testSharing {
+	TestMachine machine;
+	Utility::Rewinder rewinder(machine, 1, 100);
+
+	rewinder.capture();
+	const size_t first = rewinder.retained_bytes();
+	XCTAssertGreaterThan(first, machine.ram.size());
+
+	// Each step changes a single byte of RAM but also shifts it, in serialised form,
+	// by growing the preceding log; only the page containing the changed byte and
+	// the log itself should need to be stored again.
+	for(int c = 0; c < 50; c++) {
+		machine.step();
+		rewinder.advance();
+	}
+	XCTAssertEqual(rewinder.size(), 51);
+
+	const size_t per_snapshot = (rewinder.retained_bytes() - first) / 50;
+	XCTAssertLessThanOrEqual(per_snapshot, Utility::Rewinder::PageSize + 128);
+}
+
+- (void)testRestore {
+	TestMachine machine;
+	Utility::Rewinder rewinder(machine, 1, 100);
+
+	std::vector<std::vector<uint8_t>> ram_history;
+	for(int c = 0; c < 20; c++) {
+		machine.step();
+		ram_history.push_back(machine.ram);
+		rewinder.advance();
+	}
+
+	// Seek back to a retained snapshot and check that all state is as it was.
+	XCTAssertEqual(*rewinder.seek(7), 7);
+	XCTAssertEqual(rewinder.tick(), 7);
+	XCTAssertEqual(machine.counter, 7);
+	XCTAssertEqual(machine.log.size(), 7);
+	XCTAssert(machine.ram == ram_history[6]);
+
+	// Seeking to later than the latest snapshot should restore that.
+	XCTAssertEqual(*rewinder.seek(1000), 20);
+	XCTAssertEqual(machine.counter, 20);
+	XCTAssert(machine.ram == ram_history[19]);
+
+	// Capturing after a seek should discard the abandoned future.
+	XCTAssertEqual(*rewinder.seek(12), 12);
+	machine.step();
+	rewinder.advance();
+	XCTAssertEqual(*rewinder.latest(), 13);
+	XCTAssertEqual(rewinder.size(), 13);
+
+	// There's nothing to seek to before the first snapshot.
+	XCTAssert(!rewinder.seek(0));
+}
+
+- (void)testTrackedMemory {
+	TrackedTestMachine machine;
+	std::vector<std::vector<uint8_t>> ram_history;
+	{
+		Utility::Rewinder rewinder(machine, 1, 100);
+		XCTAssert(machine.tracked_ram.is_external());
+
+		rewinder.capture();
+		const size_t first = rewinder.retained_bytes();
+		XCTAssertGreaterThanOrEqual(first, machine.ram.size());
+
+		// Each step dirties a single page, which should be all that is copied.
+		for(int c = 0; c < 50; c++) {
+			machine.step();
+			ram_history.push_back(machine.ram);
+			rewinder.advance();
+		}
+		const size_t per_snapshot = (rewinder.retained_bytes() - first) / 50;
+		XCTAssertLessThanOrEqual(per_snapshot, Utility::Rewinder::PageSize + 64);
+
+		// Restoring should reproduce RAM exactly, including the short final page.
+		XCTAssertEqual(*rewinder.seek(17), 17);
+		XCTAssertEqual(machine.counter, 17);
+		XCTAssert(machine.ram == ram_history[16]);
+
+		// ... and a capture after a restore should start from the restored contents.
+		machine.step();
+		rewinder.advance();
+		machine.step();
+		rewinder.advance();
+		XCTAssertEqual(*rewinder.seek(18), 18);
+		XCTAssert(machine.ram == ram_history[17]);
+		XCTAssertEqual(*rewinder.seek(10), 10);
+		XCTAssert(machine.ram == ram_history[9]);
+	}
+
+	// With the rewinder gone, RAM is serialised as normal again.
+	XCTAssert(!machine.tracked_ram.is_external());
+	XCTAssertEqual(dynamic_cast<TestState *>(machine.get_state().get())->ram.size(), machine.ram.size());
+}
+
+- (void)testMachineRoundTrip {
+	// Run a ZX Spectrum for fifty frames, recording its full state after each. Rewinding to
+	// a snapshot and then running forward again should reproduce exactly the same states.
+	Analyser::Static::ZXSpectrum::Target target;
+	target.model = Analyser::Static::ZXSpectrum::Target::Model::FortyEightK;
+
+	Machine::Error error;
+	const auto machine = Machine::MachineForTarget(&target, CSROMFetcher(), error);
+	XCTAssert(machine);
+	if(!machine) return;
+
+	auto &producer = *machine->state_producer();
+	Utility::Rewinder rewinder(producer, 10, 10);
+
+	// 20ms is a whole number of cycles, so there's no fractional remainder to carry between frames.
+	std::vector<std::vector<uint8_t>> history;
+	for(int c = 0; c < 50; c++) {
+		machine->timed_machine()->run_for(0.02);
+		rewinder.advance();
+		history.push_back(producer.get_state()->serialise());
+	}
+	XCTAssertEqual(rewinder.size(), 5);
+
+	XCTAssertEqual(*rewinder.seek(23), 20);
+	XCTAssert(producer.get_state()->serialise() == history[19]);
+
+	for(int c = 20; c < 50; c++) {
+		machine->timed_machine()->run_for(0.02);
+		rewinder.advance();
+		XCTAssert(producer.get_state()->serialise() == history[size_t(c)]);
+	}
+	XCTAssertEqual(*rewinder.latest(), 50);
+}
+
+@end
@@ -0,0 +1,296 @@
+//
+//  ScanTargetTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Outputs/CRT/CRT.hpp"
+#include "../../../Outputs/ScanTargets/BufferingScanTarget.hpp"
+#include "../../../Outputs/ScanTargets/FrameSkippingScanTarget.hpp"
+#include "../../../Outputs/Software/ScanTarget.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr int CyclesPerLine = 256;
+constexpr int LinesPerFrame = 262;
+constexpr int PixelsPerLine = 160;
+
+using PixelFunction = std::function<uint8_t(int line, int x)>;
+
+std::unique_ptr<Outputs::CRT::CRT> make_crt() {
+	return std::make_unique<Outputs::CRT::CRT>(CyclesPerLine, 1, LinesPerFrame, 6, Outputs::Display::InputDataType::Luminance8);
+}
+
+/// Outputs a single frame of video, with three lines of vertical sync and pixel content as supplied by @c pixel.
+void run_frame(Outputs::CRT::CRT &crt, const PixelFunction &pixel) {
+	for(int line = 0; line < LinesPerFrame; line++) {
+		if(line < 3) {
+			crt.output_sync(CyclesPerLine);
+			continue;
+		}
+
+		crt.output_sync(20);
+		crt.output_blank(28);
+		if(uint8_t *const data = crt.begin_data(PixelsPerLine)) {
+			for(int x = 0; x < PixelsPerLine; x++) {
+				data[x] = pixel(line, x);
+			}
+		}
+		crt.output_data(PixelsPerLine, PixelsPerLine);
+		crt.output_blank(CyclesPerLine - 20 - 28 - PixelsPerLine);
+	}
+}
+
+uint8_t pattern(int line, int x) {
+	return uint8_t((line * 7) ^ (x * 3));
+}
+
+/// A BufferingScanTarget with line hashing enabled, which collects the metadata of all completed lines.
+class HashingScanTarget: public Outputs::Display::BufferingScanTarget {
+	public:
+		HashingScanTarget() : write_area_(size_t(WriteAreaWidth * WriteAreaHeight * 4)) {
+			set_scan_buffer(scans_.data(), scans_.size());
+			set_line_buffer(lines_.data(), metadata_.data(), lines_.size());
+			set_write_area(write_area_.data());
+			set_line_hashing_enabled(true);
+		}
+
+		/// @returns Metadata for all lines completed since the last call.
+		std::vector<LineMetadata> collect() {
+			std::vector<LineMetadata> result;
+			perform([&] {
+				new_modals();
+
+				const auto area = get_output_area();
+				for(auto line = area.start.line; line != area.end.line; line = (line + 1) % lines_.size()) {
+					result.push_back(metadata_[line]);
+				}
+				complete_output_area(area);
+			});
+			return result;
+		}
+
+	private:
+		std::array<Scan, 8192> scans_;
+		std::array<Line, 2048> lines_;
+		std::array<LineMetadata, 2048> metadata_;
+		std::vector<uint8_t> write_area_;
+};
+
+/// Counts the calls that reach a ScanTarget.
+struct CountingScanTarget: public Outputs::Display::ScanTarget {
+	int frames = 0;
+	int scans = 0;
+	int data_allocations = 0;
+	int modal_changes = 0;
+
+	void set_modals(Modals) final {
+		++modal_changes;
+	}
+	Scan *begin_scan() final {
+		++scans;
+		return &scan_;
+	}
+	uint8_t *begin_data(size_t required_length, size_t) final {
+		++data_allocations;
+		data_.resize(std::max(data_.size(), required_length));
+		return data_.data();
+	}
+	void announce(Event event, bool, const Scan::EndPoint &, uint8_t) final {
+		frames += event == Event::EndVerticalRetrace;
+	}
+
+	private:
+		Scan scan_;
+		std::vector<uint8_t> data_;
+};
+
+/// Runs @c frames frames into @c target and then updates it at the given size.
+void run_frames(Outputs::CRT::CRT &crt, Outputs::Display::Software::ScanTarget &target, int frames, int width, int height) {
+	for(int c = 0; c < frames; c++) {
+		run_frame(crt, pattern);
+		target.update(width, height);
+	}
+}
+
+/// @returns The mean absolute difference between corresponding bytes of @c lhs and @c rhs.
+double mean_difference(const std::vector<uint8_t> &lhs, const std::vector<uint8_t> &rhs) {
+	if(lhs.size() != rhs.size() || lhs.empty()) return 255.0;
+
+	double total = 0.0;
+	for(size_t c = 0; c < lhs.size(); c++) {
+		total += std::abs(int(lhs[c]) - int(rhs[c]));
+	}
+	return total / double(lhs.size());
+}
+
+}
+
+@interface ScanTargetTests : XCTestCase
+@end
+
+@implementation ScanTargetTests
+
+- (void)testUnchangedLinesAreCounted {
+	HashingScanTarget target;
+	const auto crt = make_crt();
+	crt->set_scan_target(&target);
+
+	// Allow the CRT some time to synchronise.
+	for(int c = 0; c < 40; c++) {
+		run_frame(*crt, pattern);
+		target.collect();
+	}
+
+	// Every line should now keep its hash, and its count of unchanged frames should rise by one per frame.
+	run_frame(*crt, pattern);
+	const auto previous = target.collect();
+	XCTAssertGreaterThan(previous.size(), 200);
+
+	run_frame(*crt, pattern);
+	const auto current = target.collect();
+	XCTAssertEqual(current.size(), previous.size());
+	if(current.size() != previous.size()) return;
+
+	for(size_t c = 0; c < current.size(); c++) {
+		XCTAssertNotEqual(current[c].hash, 0);
+		XCTAssertEqual(current[c].hash, previous[c].hash);
+		XCTAssertEqual(current[c].frames_unchanged, std::min(previous[c].frames_unchanged + 1, 255));
+		XCTAssertGreaterThan(current[c].frames_unchanged, 8);
+	}
+}
+
+- (void)testChangedPixelInvalidatesLine {
+	HashingScanTarget target;
+	const auto crt = make_crt();
+	crt->set_scan_target(&target);
+
+	for(int c = 0; c < 40; c++) {
+		run_frame(*crt, pattern);
+		target.collect();
+	}
+	run_frame(*crt, pattern);
+	const auto previous = target.collect();
+
+	// Change a single pixel on line 100 of the frame.
+	const auto altered = [](int line, int x) {
+		return uint8_t(pattern(line, x) ^ ((line == 100 && x == 80) ? 0x01 : 0x00));
+	};
+	run_frame(*crt, altered);
+	const auto current = target.collect();
+	XCTAssertEqual(current.size(), previous.size());
+	if(current.size() != previous.size()) return;
+
+	// Exactly one line should have changed.
+	size_t changed = 0;
+	size_t changed_index = 0;
+	for(size_t c = 0; c < current.size(); c++) {
+		if(current[c].hash != previous[c].hash) {
+			++changed;
+			changed_index = c;
+			XCTAssertEqual(current[c].frames_unchanged, 0);
+		} else {
+			XCTAssertGreaterThan(current[c].frames_unchanged, previous[c].frames_unchanged);
+		}
+	}
+	XCTAssertEqual(changed, 1);
+
+	// If the alteration persists, the new version of that line should begin to accumulate unchanged frames.
+	run_frame(*crt, altered);
+	const auto next = target.collect();
+	XCTAssertEqual(next[changed_index].hash, current[changed_index].hash);
+	XCTAssertEqual(next[changed_index].frames_unchanged, 1);
+}
+
+- (void)testFullRepaintAfterResize {
+	// Establish a steady state at one size, then resize. The framebuffer is cleared by the resize,
+	// so every line must then be repainted even though none has changed. Painting isn't entirely
+	// independent of history, so allow for small rounding differences from a target that has only
+	// ever been at the final size; an unpainted line would leave a large difference.
+	Outputs::Display::Software::ScanTarget resized;
+	const auto resized_crt = make_crt();
+	resized_crt->set_scan_target(&resized);
+	run_frames(*resized_crt, resized, 30, 320, 240);
+	run_frames(*resized_crt, resized, 30, 400, 300);
+
+	Outputs::Display::Software::ScanTarget fresh;
+	const auto fresh_crt = make_crt();
+	fresh_crt->set_scan_target(&fresh);
+	run_frames(*fresh_crt, fresh, 60, 400, 300);
+
+	const auto resized_pixels = resized.screenshot();
+	const auto fresh_pixels = fresh.screenshot();
+	XCTAssertEqual(resized_pixels.width, 400);
+	XCTAssertEqual(resized_pixels.height, 300);
+	XCTAssertLessThan(mean_difference(resized_pixels.pixel_data, fresh_pixels.pixel_data), 5.0);
+	XCTAssert(std::any_of(fresh_pixels.pixel_data.begin(), fresh_pixels.pixel_data.end(), [](uint8_t value) { return value != 0; }));
+}
+
+- (void)testFullRepaintAfterModalChange {
+	// Establish a steady state, then change brightness. No line's content changes, but all must be repainted;
+	// the result should be close to a target that has only ever had the new brightness and far from one that
+	// has kept the old.
+	Outputs::Display::Software::ScanTarget changed;
+	const auto changed_crt = make_crt();
+	changed_crt->set_scan_target(&changed);
+	run_frames(*changed_crt, changed, 30, 320, 240);
+	changed_crt->set_brightness(0.5f);
+	run_frames(*changed_crt, changed, 30, 320, 240);
+
+	Outputs::Display::Software::ScanTarget fresh;
+	const auto fresh_crt = make_crt();
+	fresh_crt->set_scan_target(&fresh);
+	fresh_crt->set_brightness(0.5f);
+	run_frames(*fresh_crt, fresh, 60, 320, 240);
+
+	Outputs::Display::Software::ScanTarget unchanged;
+	const auto unchanged_crt = make_crt();
+	unchanged_crt->set_scan_target(&unchanged);
+	run_frames(*unchanged_crt, unchanged, 60, 320, 240);
+
+	const auto changed_pixels = changed.screenshot().pixel_data;
+	XCTAssertLessThan(mean_difference(changed_pixels, fresh.screenshot().pixel_data), 5.0);
+	XCTAssertGreaterThan(mean_difference(changed_pixels, unchanged.screenshot().pixel_data), 10.0);
+}
+
+- (void)testFrameSkipping {
+	CountingScanTarget counter;
+	Outputs::Display::FrameSkippingScanTarget skipper(&counter, 3);
+	const auto crt = make_crt();
+	crt->set_scan_target(&skipper);
+	XCTAssertEqual(counter.modal_changes, 1);
+
+	for(int c = 0; c < 30; c++) {
+		run_frame(*crt, pattern);
+	}
+
+	// Every frame should be announced, but only a third of them should contain any content.
+	// Since frames aren't aligned with retrace, allow for an extra partial frame either way.
+	XCTAssertGreaterThanOrEqual(counter.frames, 29);
+	XCTAssertLessThanOrEqual(counter.frames, 30);
+	XCTAssertGreaterThanOrEqual(counter.data_allocations, 9 * (LinesPerFrame - 3));
+	XCTAssertLessThanOrEqual(counter.data_allocations, 11 * (LinesPerFrame - 3));
+
+	// With an interval of 1, every frame should be passed on.
+	skipper.set_interval(1);
+	const int allocations = counter.data_allocations;
+	const int scans = counter.scans;
+	for(int c = 0; c < 3; c++) {
+		run_frame(*crt, pattern);
+	}
+	XCTAssertGreaterThanOrEqual(counter.data_allocations - allocations, 3 * (LinesPerFrame - 3) - 1);
+	XCTAssertGreaterThan(counter.scans, scans);
+}
+
+@end
@@ -0,0 +1,125 @@
+//
+//  StateProducerTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Analyser/Static/Acorn/Target.hpp"
+#include "../../../Analyser/Static/Macintosh/Target.hpp"
+#include "../../../Analyser/Static/ZXSpectrum/Target.hpp"
+#include "CSROMFetcher.hpp"
+#include "MachineForTarget.hpp"
+#include "StateProducer.hpp"
+#include "TimedMachine.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+/*!
+	Serialised states of two machines that should be identical: one that has run uninterrupted, and
+	one that was restored from a snapshot of the first and then run for the same amount of time.
+*/
+struct RoundTrip {
+	bool captured = false;
+	std::vector<uint8_t> snapshot;
+	std::vector<uint8_t> original;
+	std::vector<uint8_t> restored;
+};
+
+std::vector<uint8_t> serialise(Machine::DynamicMachine &machine) {
+	const auto state = machine.state_producer()->get_state();
+	return state ? state->serialise() : std::vector<uint8_t>();
+}
+
+/*!
+	Runs a machine built for @c target for a second, takes a snapshot via BSON, then runs it for
+	a further half a second. Builds a second machine, restores the snapshot to it and also runs that
+	for half a second.
+
+	All durations are whole numbers of cycles for the machines tested, so that each machine's
+	conversion from seconds to cycles carries no fractional remainder.
+*/
+RoundTrip round_trip(const Analyser::Static::Target &target) {
+	RoundTrip result;
+	Machine::Error error;
+
+	const auto original = Machine::MachineForTarget(&target, CSROMFetcher(), error);
+	const auto restored = Machine::MachineForTarget(&target, CSROMFetcher(), error);
+	if(!original || !restored) return result;
+
+	original->timed_machine()->run_for(1.0);
+	result.snapshot = serialise(*original);
+	if(result.snapshot.empty()) return result;
+	result.captured = true;
+
+	auto state = restored->state_producer()->get_state();
+	if(!state || !state->deserialise(result.snapshot) || !restored->state_producer()->set_state(*state)) {
+		return result;
+	}
+
+	original->timed_machine()->run_for(0.5);
+	restored->timed_machine()->run_for(0.5);
+	result.original = serialise(*original);
+	result.restored = serialise(*restored);
+	return result;
+}
+
+}
+
+@interface StateProducerTests : XCTestCase
+@end
+
+@implementation StateProducerTests
+
+- (void)testZXSpectrum48k {
+	Analyser::Static::ZXSpectrum::Target target;
+	target.model = Analyser::Static::ZXSpectrum::Target::Model::FortyEightK;
+
+	const auto result = round_trip(target);
+	XCTAssert(result.captured);
+	XCTAssertFalse(result.original.empty());
+	XCTAssert(result.original == result.restored);
+	XCTAssert(result.original != result.snapshot);
+}
+
+- (void)testZXSpectrum128k {
+	Analyser::Static::ZXSpectrum::Target target;
+	target.model = Analyser::Static::ZXSpectrum::Target::Model::OneTwoEightK;
+
+	const auto result = round_trip(target);
+	XCTAssert(result.captured);
+	XCTAssertFalse(result.original.empty());
+	XCTAssert(result.original == result.restored);
+	XCTAssert(result.original != result.snapshot);
+}
+
+- (void)testElectron {
+	Analyser::Static::Acorn::ElectronTarget target;
+
+	const auto result = round_trip(target);
+	XCTAssert(result.captured);
+	XCTAssertFalse(result.original.empty());
+	XCTAssert(result.original == result.restored);
+	XCTAssert(result.original != result.snapshot);
+}
+
+- (void)testMacintosh {
+	// The 68000 may decline to be captured mid-instruction, but the Macintosh permits overrun
+	// so a run_for will always end between instructions.
+	Analyser::Static::Macintosh::Target target;
+	target.model = Analyser::Static::Macintosh::Target::Model::Mac512ke;
+
+	const auto result = round_trip(target);
+	XCTAssert(result.captured);
+	XCTAssertFalse(result.original.empty());
+	XCTAssert(result.original == result.restored);
+	XCTAssert(result.original != result.snapshot);
+}
+
+@end
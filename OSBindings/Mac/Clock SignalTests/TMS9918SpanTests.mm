@@ -0,0 +1,207 @@
+//
+//  TMS9918SpanTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "9918.hpp"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+using VDP = TI::TMS::TMS9918<TI::TMS::Personality::TMS9918A>;
+constexpr auto &Palette = TI::TMS::Base<TI::TMS::Personality::TMS9918A>::default_palette;
+
+// Table addresses are arbitrary; since VRAM is random, it doesn't matter that they overlap.
+constexpr uint8_t NameTable = 0x0e;				// i.e. 0x3800.
+constexpr uint8_t SpriteAttributeTable = 0x76;	// i.e. 0x3b00.
+constexpr uint8_t SpriteGeneratorTable = 0x07;	// i.e. 0x3800.
+
+/// Retains the data output for each line of pixels.
+struct CaptureScanTarget: public Outputs::Display::ScanTarget {
+	std::vector<std::vector<uint32_t>> lines;
+
+	void set_modals(Modals) final {}
+	Scan *begin_scan() final {
+		return &scan_;
+	}
+
+	uint8_t *begin_data(size_t required_length, size_t) final {
+		buffer_.resize(required_length);
+		return reinterpret_cast<uint8_t *>(buffer_.data());
+	}
+	void end_data(size_t actual_length) final {
+		// Ignore single-sample runs, which are borders.
+		if(actual_length == 256) {
+			lines.emplace_back(buffer_.begin(), buffer_.begin() + ptrdiff_t(actual_length));
+		}
+	}
+
+	private:
+		Scan scan_;
+		std::vector<uint32_t> buffer_;
+};
+
+/// Produces a line of Graphics I or Graphics II output pixel by pixel, directly from VRAM and registers.
+std::vector<uint32_t> reference_line(const std::vector<uint8_t> &vram, const uint8_t *registers, int line) {
+	std::vector<uint32_t> result(256);
+	const int backdrop = registers[7] & 15;
+
+	// Background.
+	const bool graphics2 = registers[0] & 0x02;
+	for(int x = 0; x < 256; x++) {
+		const int name = vram[size_t((registers[2] & 0x0f) << 10) + size_t((line >> 3) * 32 + (x >> 3))];
+
+		uint8_t pattern, colour;
+		if(graphics2) {
+			// Registers 3 and 4 are set so as to apply no masking.
+			const int offset = ((line >> 6) << 11) + name*8 + (line & 7);
+			pattern = vram[size_t(((registers[4] & 0x04) << 11) + offset)];
+			colour = vram[size_t(((registers[3] & 0x80) << 6) + offset)];
+		} else {
+			pattern = vram[size_t(((registers[4] & 0x07) << 11) + name*8 + (line & 7))];
+			colour = vram[size_t((registers[3] << 6) + (name >> 3))];
+		}
+
+		int index = (pattern >> (7 - (x & 7))) & 1 ? colour >> 4 : colour & 15;
+		result[size_t(x)] = Palette[size_t(index ? index : backdrop)];
+	}
+
+	// Sprites: up to four per line, the lowest-numbered having priority.
+	const bool sprites_16x16 = registers[1] & 0x02;
+	const bool magnified = registers[1] & 0x01;
+	const int height = (sprites_16x16 ? 16 : 8) << (magnified ? 1 : 0);
+	const size_t attributes = size_t((registers[5] & 0x7f) << 7);
+	const size_t generator = size_t((registers[6] & 0x07) << 11);
+
+	std::vector<bool> claimed(256);
+	int visible = 0;
+	for(size_t sprite = 0; sprite < 32; sprite++) {
+		const uint8_t *const attribute = &vram[attributes + sprite*4];
+		if(attribute[0] == 0xd0) break;
+
+		const int row = (line - attribute[0] - 1) & 0xff;
+		if(row >= height) continue;
+		if(++visible > 4) break;
+
+		const int pattern_row = magnified ? row >> 1 : row;
+		const size_t name = sprites_16x16 ? attribute[2] & 0xfc : attribute[2];
+		const uint8_t left = vram[generator + name*8 + size_t(pattern_row)];
+		const uint8_t right = sprites_16x16 ? vram[generator + name*8 + 16 + size_t(pattern_row)] : 0;
+		const int colour = attribute[3] & 15;
+		const int origin = attribute[1] - ((attribute[3] & 0x80) ? 32 : 0);
+
+		for(int pixel = 0; pixel < height; pixel++) {
+			const int x = origin + pixel;
+			if(x < 0 || x >= 256) continue;
+
+			const int column = magnified ? pixel >> 1 : pixel;
+			const int bit = column < 8 ? (left >> (7 - column)) & 1 : (right >> (15 - column)) & 1;
+			if(!bit || !colour || claimed[size_t(x)]) continue;
+
+			claimed[size_t(x)] = true;
+			result[size_t(x)] = Palette[size_t(colour)];
+		}
+	}
+
+	return result;
+}
+
+}
+
+@interface TMS9918SpanTests : XCTestCase
+@end
+
+@implementation TMS9918SpanTests
+
+/// Fills VRAM with random content, sets up a mode and compares a frame of output against the per-pixel reference.
+- (void)compareGraphicsMode:(bool)graphics2 spriteSize:(uint8_t)sprite_size seed:(unsigned)seed {
+	std::mt19937 generator(seed);
+	std::vector<uint8_t> vram(16384);
+	for(auto &byte: vram) {
+		byte = uint8_t(generator());
+	}
+
+	const uint8_t registers[8] = {
+		uint8_t(graphics2 ? 0x02 : 0x00),
+		uint8_t(0x60 | sprite_size),	// Display and interrupts enabled.
+		NameTable,
+		uint8_t(graphics2 ? 0xff : generator() & 0xff),
+		uint8_t(graphics2 ? 0x03 : generator() & 0x07),
+		SpriteAttributeTable,
+		SpriteGeneratorTable,
+		uint8_t(generator() & 0x0f),
+	};
+
+	VDP vdp;
+	CaptureScanTarget target;
+	vdp.set_scan_target(&target);
+
+	// Blank the display, load VRAM, then set the mode.
+	vdp.write(1, 0x00);
+	vdp.write(1, 0x81);
+	vdp.write(1, 0x00);
+	vdp.write(1, 0x40);
+	for(const auto byte: vram) {
+		vdp.write(0, byte);
+		vdp.run_for(HalfCycles(32));
+	}
+	for(uint8_t c = 0; c < 8; c++) {
+		vdp.write(1, registers[c]);
+		vdp.write(1, 0x80 | c);
+	}
+
+	// Capture exactly one frame, from the end of one vertical interrupt to the end of the next, allowing
+	// a few lines after each for pixel output to catch up.
+	constexpr HalfCycles SettleTime(456 * 16);
+	vdp.read(1);
+	vdp.run_for(vdp.next_sequence_point());
+	XCTAssert(vdp.get_interrupt_line());
+	vdp.read(1);
+	vdp.run_for(SettleTime);
+	target.lines.clear();
+
+	// Run in short, irregular steps so that lines are drawn in several parts, exercising the partial spans at either end.
+	while(!vdp.get_interrupt_line()) {
+		vdp.run_for(HalfCycles(1 + int(generator() % 40)));
+	}
+	vdp.run_for(SettleTime);
+
+	XCTAssertEqual(target.lines.size(), 192);
+	if(target.lines.size() != 192) return;
+
+	for(int line = 0; line < 192; line++) {
+		const auto expected = reference_line(vram, registers, line);
+		const auto &actual = target.lines[size_t(line)];
+		for(size_t x = 0; x < 256; x++) {
+			if(expected[x] != actual[x]) {
+				XCTFail(@"Seed %u, mode %d, sprites %d: line %d differs at pixel %zu", seed, graphics2 ? 2 : 1, sprite_size, line, x);
+				return;
+			}
+		}
+	}
+}
+
+- (void)testGraphicsI {
+	for(uint8_t sprite_size = 0; sprite_size < 4; sprite_size++) {
+		for(unsigned seed = 0; seed < 8; seed++) {
+			[self compareGraphicsMode:false spriteSize:sprite_size seed:seed];
+		}
+	}
+}
+
+- (void)testGraphicsII {
+	for(uint8_t sprite_size = 0; sprite_size < 4; sprite_size++) {
+		for(unsigned seed = 0; seed < 8; seed++) {
+			[self compareGraphicsMode:true spriteSize:sprite_size seed:seed];
+		}
+	}
+}
+
+@end
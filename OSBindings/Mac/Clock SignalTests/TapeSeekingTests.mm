@@ -0,0 +1,220 @@
+//
+//  TapeSeekingTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Storage/Tape/Tape.hpp"
+#include "../../../Storage/Tape/Formats/CSW.hpp"
+
+#include <vector>
+
+namespace {
+
+constexpr size_t PulseCount = 20000;
+constexpr unsigned int ClockRate = 100;
+
+unsigned int length_of(size_t index) {
+	return unsigned(1 + (index * 37) % 11);
+}
+
+/*!
+	A tape of PulseCount pulses of assorted lengths and alternating polarity; if @c use_cursors
+	is true then it also supplies cursors, making it eligible for checkpointing.
+
+	Counts the number of pulses it is asked to generate.
+*/
+template <bool use_cursors> class CountingTape: public Storage::Tape::Tape {
+	public:
+		bool is_at_end() final {
+			return index_ >= PulseCount;
+		}
+
+		size_t generated = 0;
+
+	private:
+		size_t index_ = 0;
+
+		Pulse virtual_get_next_pulse() final {
+			++generated;
+			if(index_ >= PulseCount) {
+				return Pulse(Pulse::Zero, Storage::Time(1u, ClockRate));
+			}
+			const auto pulse = Pulse((index_ & 1) ? Pulse::Low : Pulse::High, Storage::Time(length_of(index_), ClockRate));
+			++index_;
+			return pulse;
+		}
+
+		void virtual_reset() final {
+			index_ = 0;
+		}
+
+		std::unique_ptr<Cursor> get_cursor() final {
+			if constexpr (use_cursors) {
+				return std::make_unique<StateCursor<size_t>>(index_);
+			} else {
+				return nullptr;
+			}
+		}
+
+		void set_cursor(const Cursor &cursor) final {
+			index_ = static_cast<const StateCursor<size_t> &>(cursor).state;
+		}
+};
+
+/// @returns The total length of the first @c count pulses.
+Storage::Time time_of(size_t count) {
+	unsigned int length = 0;
+	for(size_t c = 0; c < count; c++) {
+		length += length_of(c);
+	}
+	return Storage::Time(length, ClockRate);
+}
+
+}
+
+@interface TapeSeekingTests : XCTestCase
+@end
+
+@implementation TapeSeekingTests
+
+- (void)testCurrentTime {
+	CountingTape<true> tape;
+
+	for(size_t c = 0; c < 10000; c++) {
+		tape.get_next_pulse();
+	}
+	XCTAssert(tape.get_current_time() == time_of(10000));
+	XCTAssertEqual(tape.get_offset(), 10000);
+
+	// Getting the current time should neither move the tape nor cause any pulses to be regenerated.
+	const size_t generated = tape.generated;
+	XCTAssert(tape.get_current_time() == time_of(10000));
+	XCTAssertEqual(tape.generated, generated);
+}
+
+- (void)testSeekMatchesReplay {
+	// Seek both with and without cursors to a sequence of targets in both directions,
+	// including targets that fall on either side of checkpoints.
+	CountingTape<true> indexed;
+	CountingTape<false> replayed;
+
+	const unsigned int targets[] = {
+		50000, 200, 119000, 0, 60000, 59999, 60001, 24576, 1, 100000, 99999, 10000,
+	};
+	for(const auto target: targets) {
+		Storage::Time indexed_target(target, ClockRate);
+		Storage::Time replayed_target(target, ClockRate);
+		indexed.seek(indexed_target);
+		replayed.seek(replayed_target);
+
+		XCTAssertEqual(indexed.get_offset(), replayed.get_offset());
+		XCTAssert(indexed.get_current_time() == replayed.get_current_time());
+
+		// The seek should have stopped at the first pulse that ends after the target.
+		XCTAssert(indexed.get_current_time() > Storage::Time(target, ClockRate));
+		XCTAssert(time_of(size_t(indexed.get_offset() - 1)) <= Storage::Time(target, ClockRate));
+
+		// Both should continue identically.
+		for(int c = 0; c < 100; c++) {
+			const auto indexed_pulse = indexed.get_next_pulse();
+			const auto replayed_pulse = replayed.get_next_pulse();
+			XCTAssertEqual(indexed_pulse.type, replayed_pulse.type);
+			XCTAssert(indexed_pulse.length == replayed_pulse.length);
+		}
+	}
+}
+
+- (void)testSetOffsetMatchesReplay {
+	CountingTape<true> indexed;
+	CountingTape<false> replayed;
+
+	const uint64_t targets[] = {
+		15000, 4095, 4096, 4097, 19999, 0, 8192, 8191, 12345, 12345, 100,
+	};
+	for(const auto target: targets) {
+		indexed.set_offset(target);
+		replayed.set_offset(target);
+
+		XCTAssertEqual(indexed.get_offset(), target);
+		XCTAssertEqual(replayed.get_offset(), target);
+		XCTAssert(indexed.get_current_time() == time_of(size_t(target)));
+		XCTAssert(replayed.get_current_time() == time_of(size_t(target)));
+
+		const auto indexed_pulse = indexed.get_next_pulse();
+		const auto replayed_pulse = replayed.get_next_pulse();
+		XCTAssertEqual(indexed_pulse.type, replayed_pulse.type);
+		XCTAssert(indexed_pulse.length == replayed_pulse.length);
+	}
+}
+
+- (void)testCheckpointsAvoidReplay {
+	CountingTape<true> indexed;
+	CountingTape<false> replayed;
+
+	// Play both to the end once, so that checkpoints are recorded.
+	indexed.set_offset(PulseCount);
+	replayed.set_offset(PulseCount);
+
+	// A backward seek of a short distance should regenerate at most one checkpoint
+	// interval of pulses with cursors, but the whole prefix of the tape without.
+	indexed.generated = replayed.generated = 0;
+	indexed.set_offset(PulseCount - 10);
+	replayed.set_offset(PulseCount - 10);
+
+	XCTAssertLessThanOrEqual(indexed.generated, 4096);
+	XCTAssertEqual(replayed.generated, PulseCount - 10);
+
+	// Similarly for seeks by time.
+	indexed.generated = replayed.generated = 0;
+	Storage::Time indexed_target = time_of(PulseCount / 2);
+	Storage::Time replayed_target = time_of(PulseCount / 2);
+	indexed.seek(indexed_target);
+	replayed.seek(replayed_target);
+	XCTAssertLessThanOrEqual(indexed.generated, 4097);
+	XCTAssertGreaterThan(replayed.generated, PulseCount / 2);
+	XCTAssertEqual(indexed.get_offset(), replayed.get_offset());
+}
+
+- (void)testCSW {
+	// Build an RLE CSW of assorted run lengths, including some that need the four-byte form.
+	std::vector<uint8_t> data;
+	std::vector<uint32_t> lengths;
+	for(size_t c = 0; c < PulseCount; c++) {
+		const uint32_t length = (c % 1000) == 999 ? uint32_t(300 + c) : uint32_t(1 + (c * 13) % 255);
+		lengths.push_back(length);
+		if(length < 256) {
+			data.push_back(uint8_t(length));
+		} else {
+			data.push_back(0);
+			for(int b = 0; b < 4; b++) data.push_back(uint8_t(length >> (b * 8)));
+		}
+	}
+
+	const auto time_at = [&](size_t count) {
+		uint32_t total = 0;
+		for(size_t c = 0; c < count; c++) total += lengths[c];
+		return Storage::Time(total, 44100u);
+	};
+
+	Storage::Tape::CSW tape(std::move(data), Storage::Tape::CSW::CompressionType::RLE, true, 44100);
+	tape.set_offset(PulseCount - 1);
+
+	const uint64_t targets[] = {5000, 19000, 4096, 0, 12288, 12287, 1};
+	for(const auto target: targets) {
+		tape.set_offset(target);
+		XCTAssertEqual(tape.get_offset(), target);
+		XCTAssert(tape.get_current_time() == time_at(size_t(target)));
+
+		// Pulses alternate, beginning with the inverse of the initial level.
+		const auto pulse = tape.get_next_pulse();
+		XCTAssertEqual(pulse.length.length, lengths[size_t(target)]);
+		XCTAssertEqual(pulse.type, (target & 1) ? Storage::Tape::Tape::Pulse::High : Storage::Tape::Tape::Pulse::Low);
+	}
+}
+
+@end
@@ -0,0 +1,211 @@
+//
+//  Z80InstructionSetCopyTests.mm
+//  Clock SignalTests
+//
+//  Created by Thomas Harte on 17/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../../../Processors/Z80/Z80.hpp"
+
+#include <array>
+#include <memory>
+
+namespace {
+
+constexpr uint16_t SeedAddress = 0x8fff;
+
+/*!
+	Exercises every instruction page, the untaken conditional call, the reset program, all
+	three interrupt modes and the NMI, recording results to memory from 0x9000.
+*/
+constexpr uint8_t program[] = {
+	0x31, 0x00, 0x80,			// LD SP, 0x8000
+	0x3a, 0xff, 0x8f,			// LD A, (0x8fff)
+	0x06, 0x34,					// LD B, 0x34
+	0x80,						// ADD A, B
+	0x32, 0x00, 0x90,			// LD (0x9000), A
+	0xcc, 0x00, 0x20,			// CALL Z, 0x2000 [untaken]
+	0x47,						// LD B, A
+	0xcb, 0x00,					// RLC B
+	0x78,						// LD A, B
+	0x32, 0x01, 0x90,			// LD (0x9001), A
+	0xdd, 0x21, 0x00, 0x91,		// LD IX, 0x9100
+	0xdd, 0x77, 0x02,			// LD (IX+2), A
+	0xdd, 0xcb, 0x02, 0xc6,		// SET 0, (IX+2)
+	0xfd, 0x21, 0x00, 0x92,		// LD IY, 0x9200
+	0xfd, 0x77, 0x03,			// LD (IY+3), A
+	0xfd, 0xcb, 0x03, 0xbe,		// RES 7, (IY+3)
+	0x21, 0x00, 0x90,			// LD HL, 0x9000
+	0x11, 0x00, 0x93,			// LD DE, 0x9300
+	0x01, 0x02, 0x00,			// LD BC, 2
+	0xed, 0xb0,					// LDIR
+	0xed, 0x44,					// NEG
+	0x32, 0x04, 0x90,			// LD (0x9004), A
+	0xed, 0x46,					// IM 0
+	0xfb,						// EI
+	0x76,						// HALT [IRQ: RST 38h]
+	0xed, 0x56,					// IM 1
+	0xfb,						// EI
+	0x76,						// HALT [IRQ: RST 38h]
+	0x3e, 0x04,					// LD A, 0x04
+	0xed, 0x47,					// LD I, A
+	0xed, 0x5e,					// IM 2
+	0xfb,						// EI
+	0x76,						// HALT [IRQ: via 0x04ff]
+	0xf3,						// DI
+	0x76,						// HALT [NMI]
+	0x76,						// HALT
+};
+
+constexpr uint8_t rst38_handler[] = {
+	0x21, 0x06, 0x90,			// LD HL, 0x9006
+	0x34,						// INC (HL)
+	0xfb,						// EI
+	0xed, 0x4d,					// RETI
+};
+
+constexpr uint8_t nmi_handler[] = {
+	0x3e, 0x88,					// LD A, 0x88
+	0x32, 0x07, 0x90,			// LD (0x9007), A
+	0xed, 0x45,					// RETN
+};
+
+constexpr uint8_t im2_handler[] = {
+	0x3e, 0x99,					// LD A, 0x99
+	0x32, 0x08, 0x90,			// LD (0x9008), A
+	0xfb,						// EI
+	0xed, 0x4d,					// RETI
+};
+
+/// A Z80 with 64kb of RAM that raises an interrupt upon each HALT until it has seen them all.
+template <bool uses_wait_line> struct ProgramRunner: public CPU::Z80::BusHandler {
+	ProgramRunner(uint8_t seed) : z80(*this) {
+		ram[0x0000] = 0xc3;	ram[0x0001] = 0x00;	ram[0x0002] = 0x01;	// JP 0x0100
+		std::copy(std::begin(program), std::end(program), &ram[0x0100]);
+		std::copy(std::begin(rst38_handler), std::end(rst38_handler), &ram[0x0038]);
+		std::copy(std::begin(nmi_handler), std::end(nmi_handler), &ram[0x0066]);
+		std::copy(std::begin(im2_handler), std::end(im2_handler), &ram[0x0300]);
+		ram[0x04ff] = 0x00;	ram[0x0500] = 0x03;
+		ram[SeedAddress] = seed;
+	}
+
+	/// Runs for @c cycles, signalling the next interrupt upon arrival at each HALT.
+	/// @returns @c true if the final HALT has been reached.
+	bool run_for(int cycles) {
+		z80.run_for(HalfCycles(cycles));
+
+		const bool is_halted = z80.get_halt_line();
+		const bool did_halt = is_halted && !was_halted_;
+		was_halted_ = is_halted;
+		if(!did_halt) return false;
+
+		switch(halts_++) {
+			case 0: case 1: case 2:
+				z80.set_interrupt_line(true);
+			break;
+			case 3:
+				z80.set_non_maskable_interrupt_line(true);
+				z80.set_non_maskable_interrupt_line(false);
+			break;
+			default: return true;
+		}
+		return false;
+	}
+
+	HalfCycles perform_machine_cycle(const CPU::Z80::PartialMachineCycle &cycle) {
+		using PartialMachineCycle = CPU::Z80::PartialMachineCycle;
+		switch(cycle.operation) {
+			case PartialMachineCycle::ReadOpcode:
+			case PartialMachineCycle::Read:
+				*cycle.value = ram[*cycle.address];
+			break;
+			case PartialMachineCycle::Write:
+				ram[*cycle.address] = *cycle.value;
+			break;
+			case PartialMachineCycle::Input:
+				*cycle.value = 0xff;
+			break;
+			case PartialMachineCycle::Interrupt:
+				// Supply RST 38h in mode 0 and 0xff as the low byte of the vector address in mode 2.
+				*cycle.value = 0xff;
+				z80.set_interrupt_line(false);
+			break;
+			default: break;
+		}
+		return HalfCycles(0);
+	}
+
+	CPU::Z80::Processor<ProgramRunner, false, uses_wait_line> z80;
+	std::array<uint8_t, 65536> ram{};
+
+	private:
+		bool was_halted_ = false;
+		int halts_ = 0;
+};
+
+/// Checks that @c runner completed the program correctly given its seed.
+template <typename RunnerT> void check(const RunnerT &runner, uint8_t seed) {
+	using Register = CPU::Z80::Register;
+	const uint8_t sum = uint8_t(seed + 0x34);
+	const uint8_t rotated = uint8_t((sum << 1) | (sum >> 7));
+
+	XCTAssertEqual(runner.ram[0x9000], sum);
+	XCTAssertEqual(runner.ram[0x9001], rotated);
+	XCTAssertEqual(runner.ram[0x9102], rotated | 0x01);
+	XCTAssertEqual(runner.ram[0x9203], rotated & 0x7f);
+	XCTAssertEqual(runner.ram[0x9300], sum);
+	XCTAssertEqual(runner.ram[0x9301], rotated);
+	XCTAssertEqual(runner.ram[0x9004], uint8_t(-rotated));
+	XCTAssertEqual(runner.ram[0x9006], 2);
+	XCTAssertEqual(runner.ram[0x9007], 0x88);
+	XCTAssertEqual(runner.ram[0x9008], 0x99);
+
+	XCTAssertEqual(runner.z80.value_of(Register::A), 0x88);
+	XCTAssertEqual(runner.z80.value_of(Register::BC), 0x0000);
+	XCTAssertEqual(runner.z80.value_of(Register::DE), 0x9302);
+	XCTAssertEqual(runner.z80.value_of(Register::HL), 0x9006);
+	XCTAssertEqual(runner.z80.value_of(Register::IX), 0x9100);
+	XCTAssertEqual(runner.z80.value_of(Register::IY), 0x9200);
+	XCTAssertEqual(runner.z80.value_of(Register::StackPointer), 0x8000);
+	XCTAssertEqual(runner.z80.value_of(Register::I), 0x04);
+	XCTAssertEqual(runner.z80.value_of(Register::ProgramCounter), 0x0100 + sizeof(program));
+}
+
+/// Runs the program on two processors at once, each with its own copy of the instruction set, alternating
+/// between them in small steps; any micro-op still referring to another processor's state would be caught.
+template <bool uses_wait_line> void test_interleaved() {
+	constexpr uint8_t seeds[] = {0x11, 0x52};
+	auto first = std::make_unique<ProgramRunner<uses_wait_line>>(seeds[0]);
+	auto second = std::make_unique<ProgramRunner<uses_wait_line>>(seeds[1]);
+
+	bool first_complete = false, second_complete = false;
+	for(int step = 0; step < 10'000 && !(first_complete && second_complete); step++) {
+		if(!first_complete) first_complete = first->run_for(7);
+		if(!second_complete) second_complete = second->run_for(5);
+	}
+	XCTAssert(first_complete);
+	XCTAssert(second_complete);
+
+	check(*first, seeds[0]);
+	check(*second, seeds[1]);
+}
+
+}
+
+@interface Z80InstructionSetCopyTests : XCTestCase
+@end
+
+@implementation Z80InstructionSetCopyTests
+
+- (void)testInterleavedCopies {
+	test_interleaved<false>();
+}
+
+- (void)testInterleavedCopiesWithWaitLine {
+	test_interleaved<true>();
+}
+
+@end
@@ -115,9 +115,12 @@ SOURCES += \
 	$$SRC/Outputs/ScanTargets/*.cpp \
 	$$SRC/Outputs/OpenGL/*.cpp \
 	$$SRC/Outputs/OpenGL/Primitives/*.cpp \
+	$$SRC/Outputs/Software/*.cpp \
+	$$SRC/Outputs/Speaker/*.cpp \
 \
 	$$SRC/Processors/6502/Implementation/*.cpp \
 	$$SRC/Processors/6502/State/*.cpp \
+	$$SRC/Processors/68000/State/*.cpp \
 	$$SRC/Processors/65816/Implementation/*.cpp \
 	$$SRC/Processors/Z80/Implementation/*.cpp \
 	$$SRC/Processors/Z80/State/*.cpp \
@@ -255,6 +258,7 @@ HEADERS += \
 	$$SRC/Outputs/ScanTargets/*.hpp \
 	$$SRC/Outputs/OpenGL/*.hpp \
 	$$SRC/Outputs/OpenGL/Primitives/*.hpp \
+	$$SRC/Outputs/Software/*.hpp \
 	$$SRC/Outputs/Speaker/*.hpp \
 	$$SRC/Outputs/Speaker/Implementation/*.hpp \
 \
@@ -267,6 +271,7 @@ HEADERS += \
 	$$SRC/Processors/65816/Implementation/*.hpp \
 	$$SRC/Processors/68000/*.hpp \
 	$$SRC/Processors/68000/Implementation/*.hpp \
+	$$SRC/Processors/68000/State/*.hpp \
 	$$SRC/Processors/Z80/*.hpp \
 	$$SRC/Processors/Z80/Implementation/*.hpp \
 	$$SRC/Processors/Z80/State/*.hpp \
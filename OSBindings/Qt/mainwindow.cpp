@@ -1235,6 +1235,7 @@ void MainWindow::start_pc() {
 	switch(ui->pcSpeedComboBox->currentIndex()) {
 			default:	target->speed = Target::Speed::ApproximatelyOriginal;	break;
 			case 1:		target->speed = Target::Speed::Fast;						break;
+			case 2:		target->speed = Target::Speed::Unlimited;					break;
 	}
 
 	switch(ui->pcVideoAdaptorComboBox->currentIndex()) {
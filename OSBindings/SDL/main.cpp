@@ -33,6 +33,7 @@
 #include "../../Outputs/OpenGL/Primitives/Rectangle.hpp"
 #include "../../Outputs/OpenGL/ScanTarget.hpp"
 #include "../../Outputs/OpenGL/Screenshot.hpp"
+#include "../../Outputs/Speaker/AudioSink.hpp"
 
 #include "../../Reflection/Enum.hpp"
 #include "../../Reflection/Struct.hpp"
@@ -174,33 +175,18 @@ struct MachineRunner {
 		}
 };
 
-struct SpeakerDelegate: public Outputs::Speaker::Speaker::Delegate {
+struct SpeakerDelegate {
 	// This is empirically the best that I can seem to do with SDL's timer precision.
 	static constexpr size_t buffered_samples = 1024;
-	bool is_stereo = false;
 
-	void speaker_did_complete_samples(Outputs::Speaker::Speaker *, const std::vector<int16_t> &buffer) final {
-		std::lock_guard lock_guard(audio_buffer_mutex_);
-		const size_t buffer_size = buffered_samples * (is_stereo ? 2 : 1);
-		if(audio_buffer_.size() > buffer_size) {
-			audio_buffer_.erase(audio_buffer_.begin(), audio_buffer_.end() - buffer_size);
-		}
-		audio_buffer_.insert(audio_buffer_.end(), buffer.begin(), buffer.end());
+	void set_is_stereo(bool is_stereo) {
+		// Permit at most one packet to be waiting beyond the one currently being collected.
+		sink.set_latency_limit(2 * buffered_samples * (is_stereo ? 2 : 1));
 	}
 
 	void audio_callback(Uint8 *stream, int len) {
-		std::lock_guard lock_guard(audio_buffer_mutex_);
-
 		// SDL buffer length is in bytes, so there's no need to adjust for stereo/mono in here.
-		const std::size_t sample_length = size_t(len) / sizeof(int16_t);
-		const std::size_t copy_length = std::min(sample_length, audio_buffer_.size());
-		int16_t *const target = static_cast<int16_t *>(static_cast<void *>(stream));
-
-		std::memcpy(stream, audio_buffer_.data(), copy_length * sizeof(int16_t));
-		if(copy_length < sample_length) {
-			std::memset(&target[copy_length], 0, (sample_length - copy_length) * sizeof(int16_t));
-		}
-		audio_buffer_.erase(audio_buffer_.begin(), audio_buffer_.begin() + copy_length);
+		sink.read(static_cast<int16_t *>(static_cast<void *>(stream)), size_t(len) / sizeof(int16_t));
 	}
 
 	static void SDL_audio_callback(void *userdata, Uint8 *stream, int len) {
@@ -208,9 +194,7 @@ struct SpeakerDelegate: public Outputs::Speaker::Speaker::Delegate {
 	}
 
 	SDL_AudioDeviceID audio_device;
-
-	std::mutex audio_buffer_mutex_;
-	std::vector<int16_t> audio_buffer_;
+	Outputs::Speaker::AudioSink sink;
 };
 
 class ActivityObserver: public Activity::Observer {
@@ -534,7 +518,7 @@ int main(int argc, char *argv[]) {
 	const ParsedArguments arguments = parse_arguments(argc, argv);
 
 	// This may be printed either as
-	const std::string usage_suffix = " [file or --new={machine}] [OPTIONS] [--rompath={path to ROMs}] [--speed={speed multiplier, e.g. 1.5}] [--logical-keyboard] [--volume={0.0 to 1.0}]";
+	const std::string usage_suffix = " [file or --new={machine}] [OPTIONS] [--rompath={path to ROMs}] [--speed={speed multiplier, e.g. 1.5}] [--logical-keyboard] [--volume={0.0 to 1.0}] [--record-audio={file.wav or file.raw}]";
 
 	// Print a help message if requested.
 	if(arguments.selections.find("help") != arguments.selections.end() || arguments.selections.find("h") != arguments.selections.end()) {
@@ -906,7 +890,17 @@ int main(int argc, char *argv[]) {
 	std::vector<SDLJoystick> joysticks;
 
 	machine_runner.machine_mutex = &machine_mutex;
-	const auto setup_machine_input_output = [&scan_target, &machine, &speaker_delegate, &activity_observer, &joysticks, &uses_mouse, &machine_runner] {
+
+	// Note whether audio is to be recorded.
+	std::string audio_recording_name;
+	{
+		const auto record_argument = arguments.selections.find("record-audio");
+		if(record_argument != arguments.selections.end()) {
+			audio_recording_name = record_argument->second;
+		}
+	}
+
+	const auto setup_machine_input_output = [&scan_target, &machine, &speaker_delegate, &audio_recording_name, &activity_observer, &joysticks, &uses_mouse, &machine_runner] {
 		// Wire up the best-effort updater, its delegate, and the speaker delegate.
 		machine_runner.machine = machine.get();
 
@@ -932,8 +926,31 @@ int main(int argc, char *argv[]) {
 				speaker_delegate.audio_device = SDL_OpenAudioDevice(nullptr, 0, &desired_audio_spec, &obtained_audio_spec, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
 
 				speaker->set_output_rate(obtained_audio_spec.freq, desired_audio_spec.samples, obtained_audio_spec.channels == 2);
-				speaker_delegate.is_stereo = obtained_audio_spec.channels == 2;
-				speaker->set_delegate(&speaker_delegate);
+				speaker_delegate.set_is_stereo(obtained_audio_spec.channels == 2);
+
+				// Begin recording, if requested; this happens only once, as a recording spans
+				// any subsequent changes of machine.
+				if(!audio_recording_name.empty()) {
+					const std::string wav_suffix = ".wav";
+					const bool is_wav =
+						audio_recording_name.size() >= wav_suffix.size() &&
+						std::equal(
+							wav_suffix.begin(), wav_suffix.end(),
+							audio_recording_name.end() - ptrdiff_t(wav_suffix.size()), audio_recording_name.end(),
+							[](char a, char b) { return tolower(b) == tolower(a); });
+					try {
+						speaker_delegate.sink.start_capture(
+							audio_recording_name,
+							is_wav ? Outputs::Speaker::AudioSink::CaptureFormat::WAV : Outputs::Speaker::AudioSink::CaptureFormat::Raw,
+							obtained_audio_spec.freq,
+							obtained_audio_spec.channels == 2);
+					} catch(...) {
+						std::cerr << "Unable to record audio to " << audio_recording_name << std::endl;
+					}
+					audio_recording_name.clear();
+				}
+
+				speaker->set_delegate(&speaker_delegate.sink);
 				SDL_PauseAudioDevice(speaker_delegate.audio_device, 0);
 			}
 		}
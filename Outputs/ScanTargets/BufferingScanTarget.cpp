@@ -9,6 +9,7 @@
 #include "BufferingScanTarget.hpp"
 
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
 
 #define TextureAddressGetY(v)	uint16_t((v) >> 11)
@@ -18,6 +19,17 @@
 
 using namespace Outputs::Display;
 
+namespace {
+
+constexpr uint64_t HashSeed = 0xcbf29ce484222325;
+constexpr uint64_t HashPrime = 0x100000001b3;
+
+// The distance, in the 16-bit range used for vertical positions, within which a line is
+// considered not to have moved.
+constexpr int VerticalTolerance = 64;
+
+}
+
 BufferingScanTarget::BufferingScanTarget() {
 	// Ensure proper initialisation of the two atomic pointer sets.
 	read_pointers_.store(write_pointers_, std::memory_order_relaxed);
@@ -107,6 +119,10 @@ void BufferingScanTarget::end_data(size_t actual_length) {
 	// Check for other allocation failures.
 	if(allocation_has_failed_) return;
 
+	if(line_hashing_enabled_) {
+		hash(&write_area_[size_t(write_pointers_.write_area) * data_type_size_], actual_length * data_type_size_);
+	}
+
 	// Apply necessary bookends.
 	switch(data_type_size_) {
 		default: assert(false);
@@ -178,6 +194,13 @@ void BufferingScanTarget::end_scan() {
 
 	// Complete the scan only if one is afoot.
 	if(vended_scan_) {
+		if(line_hashing_enabled_) {
+			// Data offsets are hashed before being made relative to the write area.
+			hash(vended_scan_->scan.end_points[0]);
+			hash(vended_scan_->scan.end_points[1]);
+			hash(&vended_scan_->scan.composite_amplitude, sizeof(vended_scan_->scan.composite_amplitude));
+		}
+
 		vended_scan_->data_y = TextureAddressGetY(vended_write_area_pointer_);
 		vended_scan_->line = write_pointers_.line;
 		vended_scan_->scan.end_points[0].data_offset += TextureAddressGetX(vended_write_area_pointer_);
@@ -202,6 +225,7 @@ void BufferingScanTarget::announce(Event event, bool is_visible, const Outputs::
 		is_first_in_frame_ = true;
 		previous_frame_was_complete_ = frame_is_complete_;
 		frame_is_complete_ = true;
+		line_in_frame_ = 0;
 	}
 
 	// Proceed from here only if a change in visibility has occurred.
@@ -229,6 +253,12 @@ void BufferingScanTarget::announce(Event event, bool is_visible, const Outputs::
 			active_line.composite_amplitude = composite_amplitude;
 
 			provided_scans_ = 0;
+
+			if(line_hashing_enabled_) {
+				line_hash_ = HashSeed;
+				hash(location);
+				hash(&composite_amplitude, sizeof(composite_amplitude));
+			}
 		}
 	} else {
 		// Commit the most recent line only if any scans fell on it and all allocation was successful.
@@ -252,6 +282,35 @@ void BufferingScanTarget::announce(Event event, bool is_visible, const Outputs::
 			active_line.end_points[1].cycles_since_end_of_horizontal_retrace = location.cycles_since_end_of_horizontal_retrace;
 			active_line.end_points[1].composite_angle = location.composite_angle;
 
+			// Compare against whatever was at this position in the previous frame.
+			metadata.hash = 0;
+			metadata.frames_unchanged = 0;
+			if(line_hashing_enabled_) {
+				hash(location);
+				if(line_in_frame_ >= line_history_.size()) {
+					line_history_.resize(line_in_frame_ + 1);
+				}
+
+				// Vertical positions are compared separately, with a tolerance, since they're subject to
+				// small amounts of jitter as the vertical flywheel tracks its input.
+				LineHistory &history = line_history_[line_in_frame_];
+				if(
+					history.hash == line_hash_ &&
+					std::abs(int(history.y[0]) - int(active_line.end_points[0].y)) <= VerticalTolerance &&
+					std::abs(int(history.y[1]) - int(active_line.end_points[1].y)) <= VerticalTolerance
+				) {
+					history.frames_unchanged += history.frames_unchanged != 255;
+				} else {
+					history.hash = line_hash_;
+					history.y[0] = active_line.end_points[0].y;
+					history.y[1] = active_line.end_points[1].y;
+					history.frames_unchanged = 0;
+				}
+				metadata.hash = history.hash;
+				metadata.frames_unchanged = history.frames_unchanged;
+			}
+			++line_in_frame_;
+
 			// Advance the line pointer.
 			write_pointers_.line = uint16_t((write_pointers_.line + 1) % line_buffer_size_);
 
@@ -267,6 +326,37 @@ void BufferingScanTarget::announce(Event event, bool is_visible, const Outputs::
 	}
 }
 
+// MARK: - Producer; line hashing.
+
+void BufferingScanTarget::hash(const void *data, size_t length) {
+	// FNV-1a, taken a word at a time where possible, with a rotation so that the upper bits
+	// of each word also affect the lower bits of the hash.
+	const auto bytes = static_cast<const uint8_t *>(data);
+	size_t c = 0;
+	for(; c + 8 <= length; c += 8) {
+		uint64_t word;
+		std::memcpy(&word, &bytes[c], sizeof(word));
+		line_hash_ = (line_hash_ ^ word) * HashPrime;
+		line_hash_ = (line_hash_ << 23) | (line_hash_ >> 41);
+	}
+	for(; c < length; c++) {
+		line_hash_ = (line_hash_ ^ bytes[c]) * HashPrime;
+	}
+}
+
+void BufferingScanTarget::hash(const Outputs::Display::ScanTarget::Scan::EndPoint &end_point) {
+	hash(&end_point.x, sizeof(end_point.x));
+	hash(&end_point.data_offset, sizeof(end_point.data_offset));
+	hash(&end_point.composite_angle, sizeof(end_point.composite_angle));
+	hash(&end_point.cycles_since_end_of_horizontal_retrace, sizeof(end_point.cycles_since_end_of_horizontal_retrace));
+}
+
+void BufferingScanTarget::set_line_hashing_enabled(bool enabled) {
+	std::lock_guard lock_guard(producer_mutex_);
+	line_hashing_enabled_ = enabled;
+	line_history_.clear();
+}
+
 // MARK: - Producer; other state.
 
 void BufferingScanTarget::will_change_owner() {
@@ -301,6 +391,10 @@ void BufferingScanTarget::set_modals(Modals modals) {
 		modals_ = modals;
 		modals_are_dirty_.store(true, std::memory_order_relaxed);
 	});
+
+	// Lines hashed under the old modals may be interpreted differently under the new.
+	std::lock_guard lock_guard(producer_mutex_);
+	line_history_.clear();
 }
 
 // MARK: - Consumer.
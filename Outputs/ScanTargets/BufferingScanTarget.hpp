@@ -88,6 +88,15 @@ class BufferingScanTarget: public Outputs::Display::ScanTarget {
 			bool previous_frame_was_complete;
 			/// The index of the first scan that will appear on this line.
 			size_t first_scan;
+
+			/// If line hashing is enabled, a hash of everything that contributed to this line other than vertical
+			/// position: its end points, colour burst, scans and pixel data. Otherwise @c 0.
+			uint64_t hash;
+			/// If line hashing is enabled, the number of consecutive preceding frames in which the line at this
+			/// position had the same hash and a vertical position within a small fraction of a line of where it
+			/// was when that hash first appeared, saturating at 255; a consumer that has already drawn such a line
+			/// may choose not to redraw it. Otherwise @c 0.
+			uint8_t frames_unchanged;
 		};
 
 		/// Sets the area of memory to use as a scan buffer.
@@ -96,6 +105,10 @@ class BufferingScanTarget: public Outputs::Display::ScanTarget {
 		/// Sets the area of memory to use as line and line metadata buffers.
 		void set_line_buffer(Line *line_buffer, LineMetadata *metadata_buffer, size_t size);
 
+		/// Enables or disables the calculation of @c LineMetadata::hash and @c LineMetadata::frames_unchanged;
+		/// this is disabled by default as it adds some cost to the producer.
+		void set_line_hashing_enabled(bool);
+
 		/// Sets a new base address for the texture.
 		/// When called this will flush all existing data and load up the
 		/// new data size.
@@ -196,6 +209,20 @@ class BufferingScanTarget: public Outputs::Display::ScanTarget {
 		bool frame_is_complete_ = true;
 		bool previous_frame_was_complete_ = true;
 
+		// Line hashing state; line_history_ holds the hash, vertical position and unchanged-frame
+		// count of each line of the most recent frame, indexed by position within the frame.
+		struct LineHistory {
+			uint64_t hash = 0;
+			uint16_t y[2]{};
+			uint8_t frames_unchanged = 0;
+		};
+		bool line_hashing_enabled_ = false;
+		uint64_t line_hash_ = 0;
+		size_t line_in_frame_ = 0;
+		std::vector<LineHistory> line_history_;
+		void hash(const void *data, size_t length);
+		void hash(const Outputs::Display::ScanTarget::Scan::EndPoint &);
+
 		// By convention everything in the PointerSet points to the next instance
 		// of whatever it is that will be used. So a client should start with whatever
 		// is pointed to by the read pointers and carry until it gets to a value that
@@ -0,0 +1,92 @@
+//
+//  FrameSkippingScanTarget.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "../ScanTarget.hpp"
+
+namespace Outputs::Display {
+
+/*!
+	Sits between a video producer and another ScanTarget, passing on only one frame in every @c interval.
+
+	Other frames are reduced to sync only: all events are still announced, so the eventual target retains
+	an accurate picture of display timing, but no scans are passed on and all requests for data are
+	refused. Producers already treat a refusal of data as a request to skip pixel generation, so skipped
+	frames are also cheaper to produce.
+*/
+class FrameSkippingScanTarget: public ScanTarget {
+	public:
+		FrameSkippingScanTarget(ScanTarget *target = &NullScanTarget::singleton, int interval = 1) :
+			target_(target), interval_(interval) {}
+
+		/// Sets the target to which non-skipped output is passed.
+		void set_target(ScanTarget *target) {
+			target_ = target;
+		}
+
+		/// Sets the frame interval; 1 passes on every frame, 2 every other frame, etc.
+		void set_interval(int interval) {
+			interval_ = interval > 0 ? interval : 1;
+		}
+
+		int interval() const {
+			return interval_;
+		}
+
+		// ScanTarget overrides.
+		void set_modals(Modals modals) final {
+			target_->set_modals(modals);
+		}
+
+		Scan *begin_scan() final {
+			is_forwarding_scan_ = !is_skipping_;
+			return is_forwarding_scan_ ? target_->begin_scan() : nullptr;
+		}
+
+		void end_scan() final {
+			if(is_forwarding_scan_) target_->end_scan();
+		}
+
+		uint8_t *begin_data(size_t required_length, size_t required_alignment) final {
+			is_forwarding_data_ = !is_skipping_;
+			return is_forwarding_data_ ? target_->begin_data(required_length, required_alignment) : nullptr;
+		}
+
+		void end_data(size_t actual_length) final {
+			if(is_forwarding_data_) target_->end_data(actual_length);
+		}
+
+		void will_change_owner() final {
+			target_->will_change_owner();
+		}
+
+		void submit() final {
+			target_->submit();
+		}
+
+		void announce(Event event, bool is_visible, const Scan::EndPoint &location, uint8_t composite_amplitude) final {
+			// Decide upon each new frame at the end of retrace, i.e. as it becomes visible.
+			if(event == Event::EndVerticalRetrace) {
+				frame_ = (frame_ + 1) % interval_;
+				is_skipping_ = frame_ != 0;
+			}
+			target_->announce(event, is_visible, location, composite_amplitude);
+		}
+
+	private:
+		ScanTarget *target_;
+		int interval_;
+
+		int frame_ = 0;
+		bool is_skipping_ = false;
+		bool is_forwarding_scan_ = false;
+		bool is_forwarding_data_ = false;
+};
+
+}
@@ -0,0 +1,789 @@
+//
+//  ScanTarget.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#include "ScanTarget.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+using namespace Outputs::Display::Software;
+
+namespace {
+
+constexpr float Pi = 3.141592654f;
+
+// MARK: - Vector primitives.
+
+/*!
+	Four lanes of float, implemented with whichever of SSE2 or NEON is available, or as
+	plain C++ otherwise. @c bytes<shift> unpacks byte @c shift/8 of each of four packed
+	RGBA texels.
+*/
+#if defined(__SSE2__) || defined(_M_X64)
+
+struct Float4 {
+	__m128 v;
+
+	static Float4 load(const float *source)	{	return {_mm_loadu_ps(source)};	}
+	static Float4 splat(float value)		{	return {_mm_set1_ps(value)};	}
+	static Float4 gather(const float *source, const int *indices) {
+		return {_mm_setr_ps(source[indices[0]], source[indices[1]], source[indices[2]], source[indices[3]])};
+	}
+	template <int shift> static Float4 bytes(const uint32_t *source) {
+		const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+		return {_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(texels, shift), _mm_set1_epi32(0xff)))};
+	}
+
+	void store(float *target) const	{	_mm_storeu_ps(target, v);	}
+
+	Float4 operator +(Float4 rhs) const	{	return {_mm_add_ps(v, rhs.v)};	}
+	Float4 operator -(Float4 rhs) const	{	return {_mm_sub_ps(v, rhs.v)};	}
+	Float4 operator *(Float4 rhs) const	{	return {_mm_mul_ps(v, rhs.v)};	}
+};
+
+#elif defined(__ARM_NEON)
+
+struct Float4 {
+	float32x4_t v;
+
+	static Float4 load(const float *source)	{	return {vld1q_f32(source)};	}
+	static Float4 splat(float value)		{	return {vdupq_n_f32(value)};	}
+	static Float4 gather(const float *source, const int *indices) {
+		const float values[4] = {source[indices[0]], source[indices[1]], source[indices[2]], source[indices[3]]};
+		return {vld1q_f32(values)};
+	}
+	template <int shift> static Float4 bytes(const uint32_t *source) {
+		uint32x4_t texels = vld1q_u32(source);
+		if constexpr (shift) texels = vshrq_n_u32(texels, shift);
+		return {vcvtq_f32_u32(vandq_u32(texels, vdupq_n_u32(0xff)))};
+	}
+
+	void store(float *target) const	{	vst1q_f32(target, v);	}
+
+	Float4 operator +(Float4 rhs) const	{	return {vaddq_f32(v, rhs.v)};	}
+	Float4 operator -(Float4 rhs) const	{	return {vsubq_f32(v, rhs.v)};	}
+	Float4 operator *(Float4 rhs) const	{	return {vmulq_f32(v, rhs.v)};	}
+};
+
+#else
+
+struct Float4 {
+	float v[4];
+
+	static Float4 load(const float *source)	{	return {{source[0], source[1], source[2], source[3]}};	}
+	static Float4 splat(float value)		{	return {{value, value, value, value}};	}
+	static Float4 gather(const float *source, const int *indices) {
+		return {{source[indices[0]], source[indices[1]], source[indices[2]], source[indices[3]]}};
+	}
+	template <int shift> static Float4 bytes(const uint32_t *source) {
+		return {{
+			float((source[0] >> shift) & 0xff), float((source[1] >> shift) & 0xff),
+			float((source[2] >> shift) & 0xff), float((source[3] >> shift) & 0xff),
+		}};
+	}
+
+	void store(float *target) const	{	std::copy(v, v + 4, target);	}
+
+	Float4 operator +(Float4 rhs) const	{	return {{v[0] + rhs.v[0], v[1] + rhs.v[1], v[2] + rhs.v[2], v[3] + rhs.v[3]}};	}
+	Float4 operator -(Float4 rhs) const	{	return {{v[0] - rhs.v[0], v[1] - rhs.v[1], v[2] - rhs.v[2], v[3] - rhs.v[3]}};	}
+	Float4 operator *(Float4 rhs) const	{	return {{v[0] * rhs.v[0], v[1] * rhs.v[1], v[2] * rhs.v[2], v[3] * rhs.v[3]}};	}
+};
+
+#endif
+
+/*!
+	The type used to decode whole lines: eight lanes with AVX2, otherwise the same as Float4.
+*/
+#if defined(__AVX2__)
+
+struct RowVector {
+	static constexpr int Width = 8;
+	__m256 v;
+
+	static RowVector splat(float value)	{	return {_mm256_set1_ps(value)};	}
+	template <int shift> static RowVector bytes(const uint32_t *source) {
+		const __m256i texels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+		return {_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(texels, shift), _mm256_set1_epi32(0xff)))};
+	}
+
+	void store(float *target) const	{	_mm256_storeu_ps(target, v);	}
+
+	RowVector operator +(RowVector rhs) const	{	return {_mm256_add_ps(v, rhs.v)};	}
+	RowVector operator *(RowVector rhs) const	{	return {_mm256_mul_ps(v, rhs.v)};	}
+};
+
+#else
+
+struct RowVector: public Float4 {
+	static constexpr int Width = 4;
+
+	RowVector(Float4 source) : Float4(source) {}
+	static RowVector splat(float value)	{	return Float4::splat(value);	}
+	template <int shift> static RowVector bytes(const uint32_t *source) {	return Float4::bytes<shift>(source);	}
+
+	RowVector operator +(RowVector rhs) const	{	return Float4::operator +(rhs);	}
+	RowVector operator *(RowVector rhs) const	{	return Float4::operator *(rhs);	}
+};
+
+#endif
+
+constexpr uint32_t pack(uint32_t red, uint32_t green, uint32_t blue, uint32_t alpha) {
+	return red | (green << 8) | (blue << 16) | (alpha << 24);
+}
+
+/// Maps a single input sample to the normalised RGBA8 form used by the line buffer, which is
+/// the same as that produced by the OpenGL composition shader.
+template <Outputs::Display::InputDataType type> uint32_t normalise(const uint8_t *source, size_t index) {
+	using InputDataType = Outputs::Display::InputDataType;
+
+	switch(type) {
+		case InputDataType::Luminance1: {
+			const uint32_t level = source[index] ? 255 : 0;
+			return pack(level, level, level, level);
+		}
+
+		case InputDataType::Luminance8: {
+			const uint32_t level = source[index];
+			return pack(level, level, level, level);
+		}
+
+		case InputDataType::Luminance8Phase8:
+			return pack(source[index*2], source[index*2 + 1], 0, 255);
+
+		case InputDataType::PhaseLinkedLuminance8:
+		case InputDataType::Red8Green8Blue8:
+			return pack(source[index*4], source[index*4 + 1], source[index*4 + 2], source[index*4 + 3]);
+
+		case InputDataType::Red1Green1Blue1: {
+			const uint8_t value = source[index];
+			return pack((value & 4) ? 255 : 0, (value & 2) ? 255 : 0, (value & 1) ? 255 : 0, 255);
+		}
+
+		case InputDataType::Red2Green2Blue2: {
+			const uint8_t value = source[index];
+			return pack(((value >> 4) & 3) * 85, ((value >> 2) & 3) * 85, (value & 3) * 85, 255);
+		}
+
+		case InputDataType::Red4Green4Blue4: {
+			const uint8_t red = source[index*2], green_blue = source[index*2 + 1];
+			return pack(std::min(red, uint8_t(15)) * 17, (green_blue >> 4) * 17, (green_blue & 15) * 17, 255);
+		}
+	}
+
+	return 0;
+}
+
+/// Composes the scan @c scan into @c line, sampling from the write area @c source.
+template <Outputs::Display::InputDataType type> void compose(
+	uint32_t *line,
+	const uint8_t *source,
+	const Outputs::Display::BufferingScanTarget::Scan &scan
+) {
+	const float start_clock = scan.scan.end_points[0].cycles_since_end_of_horizontal_retrace;
+	const float end_clock = scan.scan.end_points[1].cycles_since_end_of_horizontal_retrace;
+	if(end_clock <= start_clock) return;
+
+	const float start_x = scan.scan.end_points[0].data_offset;
+	const float end_x = scan.scan.end_points[1].data_offset;
+	const float data_per_clock = (end_x - start_x) / (end_clock - start_clock);
+
+	// Fill exactly those texels whose centres lie within [start_clock, end_clock), mapping
+	// from each texel centre to the nearest source sample.
+	const int begin = std::max(0, int(std::ceil(start_clock - 0.5f)));
+	const int end = std::min(Outputs::Display::BufferingScanTarget::WriteAreaWidth, int(std::ceil(end_clock - 0.5f)));
+	const size_t row = size_t(scan.data_y) * Outputs::Display::BufferingScanTarget::WriteAreaWidth;
+	for(int x = begin; x < end; x++) {
+		const int data_x = std::clamp(
+			int(start_x + (float(x) + 0.5f - start_clock) * data_per_clock),
+			0, Outputs::Display::BufferingScanTarget::WriteAreaWidth - 1);
+		line[x] = normalise<type>(source, row + size_t(data_x));
+	}
+}
+
+float dot(const float *samples, const float *weights) {
+	return
+		samples[0] * weights[0] + samples[1] * weights[1] +
+		samples[2] * weights[2] + samples[3] * weights[3];
+}
+
+/*!
+	Provides the cosine and sine of an angle that advances by a fixed step, without
+	evaluating either function per step.
+*/
+class Rotation {
+	public:
+		Rotation(float angle, float step) :
+			cos_(std::cos(double(angle))), sin_(std::sin(double(angle))),
+			cos_step_(std::cos(double(step))), sin_step_(std::sin(double(step))) {}
+
+		float cos() const	{	return float(cos_);	}
+		float sin() const	{	return float(sin_);	}
+
+		void advance() {
+			const double cos = cos_ * cos_step_ - sin_ * sin_step_;
+			sin_ = sin_ * cos_step_ + cos_ * sin_step_;
+			cos_ = cos;
+		}
+
+	private:
+		double cos_, sin_;
+		const double cos_step_, sin_step_;
+};
+
+constexpr float SoftWeights[] = {0.15f, 0.35f, 0.35f, 0.15f};
+constexpr float LuminanceWeights[] = {0.15f, 0.35f, 0.35f, 0.25f};
+constexpr float MeanWeights[] = {0.25f, 0.25f, 0.25f, 0.25f};
+
+}
+
+// MARK: - Lifecycle.
+
+ScanTarget::ScanTarget(float output_gamma) :
+	output_gamma_(output_gamma),
+	unprocessed_lines_(size_t(LineBufferWidth * LineBufferHeight)),
+	qam_(size_t(LineBufferWidth * 2)) {
+
+	set_scan_buffer(scan_buffer_.data(), scan_buffer_.size());
+	set_line_buffer(line_buffer_.data(), line_metadata_buffer_.data(), line_buffer_.size());
+	set_line_hashing_enabled(true);
+
+	is_drawing_to_framebuffer_.clear();
+}
+
+void ScanTarget::SamplingWindow::set(int index, float offset, float angle) {
+	offsets[size_t(index)] = offset;
+	angles[size_t(index)] = angle;
+	cos_angles[size_t(index)] = std::cos(angle);
+	sin_angles[size_t(index)] = std::sin(angle);
+}
+
+void ScanTarget::setup_pipeline() {
+	const auto modals = BufferingScanTarget::modals();
+	const auto data_type_size = Outputs::Display::size_for_data_type(modals.input_data_type);
+
+	// Resize the write area only if required.
+	const size_t required_size = WriteAreaWidth*WriteAreaHeight*data_type_size;
+	if(required_size != write_area_data_size()) {
+		write_area_texture_.resize(required_size);
+		set_write_area(write_area_texture_.data());
+	}
+
+	// Pick a line decoding.
+	if(modals.display_type == DisplayType::RGB) {
+		source_ = Source::RGB;
+	} else {
+		switch(modals.input_data_type) {
+			case InputDataType::Luminance1:
+			case InputDataType::Luminance8:
+				source_ = Source::Luminance;
+			break;
+
+			case InputDataType::PhaseLinkedLuminance8:
+				source_ = Source::PhaseLinkedLuminance;
+			break;
+
+			default:
+				source_ = Source::LuminanceChrominance;
+			break;
+		}
+	}
+
+	// Determine the proper clear colour; this needs to be anything that describes black
+	// in the input colour encoding at use.
+	clear_colour_ = modals.input_data_type == InputDataType::Luminance8Phase8 ? pack(0, 255, 0, 0) : 0;
+
+	// Colour space conversions; these are column-major.
+	rgb_to_luma_chroma_ = from_rgb_matrix(modals.composite_colour_space);
+	luma_chroma_to_rgb_ = to_rgb_matrix(modals.composite_colour_space);
+
+	// Luminance8Phase8 chrominance for each possible phase byte, expressed so that
+	// cos(angle + phase) = cos(angle)*[0] + sin(angle)*[1].
+	for(size_t phase = 0; phase < 256; phase++) {
+		const float normalised = float(phase) / 255.0f;
+		const float offset = Pi * 2.0f * 2.0f * normalised;
+		const float enable = normalised <= 0.75f ? 1.0f : 0.0f;
+		phase_quadrature_[phase] = {enable * std::cos(offset), -enable * std::sin(offset)};
+	}
+
+	// Composite sampling is at four points across a colour cycle.
+	const float clocks_per_angle = float(modals.cycles_per_line) * float(modals.colour_cycle_denominator) / float(modals.colour_cycle_numerator);
+	for(int c = 0; c < 4; ++c) {
+		const float angle = (float(c) - 1.5f) / 4.0f;
+		composite_window_.set(c, angle * clocks_per_angle, angle * 2.0f * Pi);
+	}
+
+	// Brightness and gamma are applied by lookup.
+	brightness_ = std::fabs(modals.brightness - 1.0f) > 0.05f ? modals.brightness : 1.0f;
+	const float gamma_ratio = std::fabs(output_gamma_ - modals.intended_gamma) > 0.05f ? output_gamma_ / modals.intended_gamma : 1.0f;
+	for(size_t c = 0; c < gamma_table_.size(); c++) {
+		gamma_table_[c] = std::pow(float(c) / float(gamma_table_.size() - 1), gamma_ratio);
+	}
+
+	if(output_width_) {
+		set_sampling_window(output_width_);
+	}
+	full_repaint_frames_ = SteadyStateFrames;
+}
+
+void ScanTarget::set_sampling_window(int output_width) {
+	const auto &modals = BufferingScanTarget::modals();
+
+	if(modals.display_type == DisplayType::CompositeColour) {
+		sampling_window_ = composite_window_;
+	} else {
+		const float one_pixel_width = float(modals.cycles_per_line) * modals.visible_area.size.width / float(output_width);
+		const float clocks_per_angle = float(modals.cycles_per_line) * float(modals.colour_cycle_denominator) / float(modals.colour_cycle_numerator);
+		for(int c = 0; c < 4; ++c) {
+			const float offset = ((one_pixel_width * float(c)) / 3.0f) - (one_pixel_width * 0.5f);
+			sampling_window_.set(c, offset, (offset / clocks_per_angle) * 2.0f * Pi);
+		}
+	}
+
+	// Note the furthest any sample might be taken from the centre of a pixel.
+	float reach = 0.0f;
+	for(int c = 0; c < 4; ++c) {
+		reach = std::max(reach, std::fabs(composite_window_.offsets[size_t(c)]));
+		reach = std::max(reach, std::fabs(sampling_window_.offsets[size_t(c)]));
+	}
+	sample_reach_ = int(std::ceil(reach)) + 2;
+}
+
+// MARK: - Output.
+
+ScanTarget::Screenshot ScanTarget::screenshot() {
+	while(is_drawing_to_framebuffer_.test_and_set(std::memory_order_acquire));
+
+	Screenshot screenshot;
+	screenshot.pixel_data = framebuffer_;
+	screenshot.width = output_width_;
+	screenshot.height = output_height_;
+
+	is_drawing_to_framebuffer_.clear(std::memory_order_release);
+	return screenshot;
+}
+
+void ScanTarget::update(int output_width, int output_height) {
+	perform([=] {
+		const OutputArea area = get_output_area();
+
+		// Establish the pipeline if necessary.
+		if(new_modals()) {
+			setup_pipeline();
+		}
+
+		// Determine the start time of this submission group and the number of lines it will contain.
+		line_submission_begin_time_ = std::chrono::high_resolution_clock::now();
+		lines_submitted_ = (area.end.line - area.start.line + line_buffer_.size()) % line_buffer_.size();
+
+		// A resize will clear the framebuffer, after which all lines must be repainted.
+		if(output_width != output_width_ || output_height != output_height_) {
+			full_repaint_frames_ = SteadyStateFrames;
+		}
+
+		// Compose new scans into the unprocessed line buffer, having first cleared
+		// all lines that are about to be drawn to. Lines that won't be repainted are skipped.
+		const size_t data_type_size = write_area_data_size();
+		if(data_type_size) {
+			for(auto line = area.start.line; line != area.end.line; line = (line + 1) % line_buffer_.size()) {
+				if(is_unchanged(line_metadata_buffer_[line])) continue;
+				std::fill_n(&unprocessed_lines_[line * LineBufferWidth], LineBufferWidth, clear_colour_);
+			}
+
+			for(auto scan = area.start.scan; scan != area.end.scan; scan = (scan + 1) % scan_buffer_.size()) {
+				const Scan &source = scan_buffer_[scan];
+				if(is_unchanged(line_metadata_buffer_[source.line])) continue;
+				uint32_t *const line = &unprocessed_lines_[source.line * LineBufferWidth];
+
+#define Compose(x)	case InputDataType::x: compose<InputDataType::x>(line, write_area_texture_.data(), source); break;
+				switch(modals().input_data_type) {
+					Compose(Luminance1);
+					Compose(Luminance8);
+					Compose(PhaseLinkedLuminance8);
+					Compose(Luminance8Phase8);
+					Compose(Red1Green1Blue1);
+					Compose(Red2Green2Blue2);
+					Compose(Red4Green4Blue4);
+					Compose(Red8Green8Blue8);
+				}
+#undef Compose
+			}
+		}
+
+		// Work with the framebuffer starts from here onwards; set its flag.
+		while(is_drawing_to_framebuffer_.test_and_set(std::memory_order_acquire));
+
+		// Ensure the framebuffer is properly sized.
+		if(output_width != output_width_ || output_height != output_height_) {
+			output_width_ = output_width;
+			output_height_ = output_height;
+			framebuffer_.assign(size_t(output_width * output_height * 4), 0);
+			stencil_.assign(size_t(output_width * output_height), 0);
+			stencil_is_valid_ = false;
+			line_colours_.resize(size_t(output_width * 3));
+
+			set_sampling_window(output_width);
+			display_metrics_.announce_did_resize();
+		}
+
+		// Paint all new lines.
+		if(data_type_size && !framebuffer_.empty()) {
+			for(auto line = area.start.line; line != area.end.line; line = (line + 1) % line_buffer_.size()) {
+				// If this is start-of-frame, decay any untouched pixels and reset the stencil.
+				const LineMetadata &metadata = line_metadata_buffer_[line];
+				if(metadata.is_first_in_frame) {
+					full_repaint_frames_ = std::max(0, full_repaint_frames_ - 1);
+					if(stencil_is_valid_ && metadata.previous_frame_was_complete) {
+						for(size_t pixel = 0; pixel < stencil_.size(); pixel++) {
+							if(stencil_[pixel]) continue;
+							for(size_t channel = 0; channel < 3; channel++) {
+								auto &target = framebuffer_[pixel*4 + channel];
+								target = uint8_t((target * 2) / 5);
+							}
+						}
+					}
+					stencil_is_valid_ = true;
+					std::fill(stencil_.begin(), stencil_.end(), 0);
+				}
+
+				convert_line(line_buffer_[line], is_unchanged(metadata));
+			}
+		}
+
+		is_drawing_to_framebuffer_.clear(std::memory_order_release);
+
+		display_metrics_.announce_draw_status(
+			lines_submitted_,
+			std::chrono::high_resolution_clock::now() - line_submission_begin_time_,
+			true);
+		complete_output_area(area);
+	});
+}
+
+// MARK: - Line decoding.
+
+void ScanTarget::decode_line(uint16_t line, int begin, int end) {
+	// Round outward to whole vectors.
+	begin &= ~(RowVector::Width - 1);
+	end = std::min(LineBufferWidth, (end + RowVector::Width - 1) & ~(RowVector::Width - 1));
+
+	const uint32_t *const source = &unprocessed_lines_[size_t(line) * LineBufferWidth];
+	const auto scale = RowVector::splat(1.0f / 255.0f);
+
+	switch(source_) {
+		case Source::RGB:
+			for(int x = begin; x < end; x += RowVector::Width) {
+				(RowVector::bytes<0>(&source[x]) * scale).store(&planes_[0][size_t(x)]);
+				(RowVector::bytes<8>(&source[x]) * scale).store(&planes_[1][size_t(x)]);
+				(RowVector::bytes<16>(&source[x]) * scale).store(&planes_[2][size_t(x)]);
+			}
+		break;
+
+		case Source::Luminance:
+			for(int x = begin; x < end; x += RowVector::Width) {
+				(RowVector::bytes<0>(&source[x]) * scale).store(&planes_[0][size_t(x)]);
+			}
+		break;
+
+		case Source::PhaseLinkedLuminance:
+			for(int x = begin; x < end; x += RowVector::Width) {
+				(RowVector::bytes<0>(&source[x]) * scale).store(&planes_[0][size_t(x)]);
+				(RowVector::bytes<8>(&source[x]) * scale).store(&planes_[1][size_t(x)]);
+				(RowVector::bytes<16>(&source[x]) * scale).store(&planes_[2][size_t(x)]);
+				(RowVector::bytes<24>(&source[x]) * scale).store(&planes_[3][size_t(x)]);
+			}
+		break;
+
+		case Source::LuminanceChrominance:
+			if(modals().input_data_type == InputDataType::Luminance8Phase8) {
+				for(int x = begin; x < end; x += RowVector::Width) {
+					(RowVector::bytes<0>(&source[x]) * scale).store(&planes_[0][size_t(x)]);
+				}
+				for(int x = begin; x < end; x++) {
+					const auto &quadrature = phase_quadrature_[(source[x] >> 8) & 0xff];
+					planes_[1][size_t(x)] = quadrature[0];
+					planes_[2][size_t(x)] = quadrature[1];
+				}
+			} else {
+				// Apply the colour space conversion once per texel, so that each sample
+				// is then just a mix of luminance and the quadrature-weighted chrominance.
+				RowVector matrix[9] = {
+					RowVector::splat(rgb_to_luma_chroma_[0] / 255.0f), RowVector::splat(rgb_to_luma_chroma_[1] / 255.0f),
+					RowVector::splat(rgb_to_luma_chroma_[2] / 255.0f), RowVector::splat(rgb_to_luma_chroma_[3] / 255.0f),
+					RowVector::splat(rgb_to_luma_chroma_[4] / 255.0f), RowVector::splat(rgb_to_luma_chroma_[5] / 255.0f),
+					RowVector::splat(rgb_to_luma_chroma_[6] / 255.0f), RowVector::splat(rgb_to_luma_chroma_[7] / 255.0f),
+					RowVector::splat(rgb_to_luma_chroma_[8] / 255.0f),
+				};
+				for(int x = begin; x < end; x += RowVector::Width) {
+					const auto red = RowVector::bytes<0>(&source[x]);
+					const auto green = RowVector::bytes<8>(&source[x]);
+					const auto blue = RowVector::bytes<16>(&source[x]);
+
+					(red * matrix[0] + green * matrix[3] + blue * matrix[6]).store(&planes_[0][size_t(x)]);
+					(red * matrix[1] + green * matrix[4] + blue * matrix[7]).store(&planes_[1][size_t(x)]);
+					(red * matrix[2] + green * matrix[5] + blue * matrix[8]).store(&planes_[2][size_t(x)]);
+				}
+			}
+		break;
+	}
+}
+
+ScanTarget::Samples ScanTarget::sample(float clock, float angle, float cos_angle, float sin_angle, float amplitude, const SamplingWindow &window) const {
+	int texels[4];
+	for(size_t c = 0; c < 4; c++) {
+		texels[c] = std::clamp(int(std::floor(clock + window.offsets[c])), 0, LineBufferWidth - 1);
+	}
+
+	Samples samples;
+	switch(source_) {
+		default:
+			Float4::gather(planes_[0].data(), texels).store(samples.values);
+		break;
+
+		case Source::LuminanceChrominance: {
+			const auto luminance = Float4::gather(planes_[0].data(), texels);
+			if(amplitude == 0.0f) {
+				luminance.store(samples.values);
+				break;
+			}
+
+			// Rotate the window's angles by the current angle.
+			const auto cosine = Float4::splat(cos_angle);
+			const auto sine = Float4::splat(sin_angle);
+			const auto cos_offsets = Float4::load(window.cos_angles.data());
+			const auto sin_offsets = Float4::load(window.sin_angles.data());
+			const auto cosines = cosine * cos_offsets - sine * sin_offsets;
+			const auto sines = sine * cos_offsets + cosine * sin_offsets;
+
+			const auto chrominance =
+				cosines * Float4::gather(planes_[1].data(), texels) +
+				sines * Float4::gather(planes_[2].data(), texels);
+			(luminance + (chrominance - luminance) * Float4::splat(amplitude)).store(samples.values);
+		} break;
+
+		case Source::PhaseLinkedLuminance:
+			for(size_t c = 0; c < 4; c++) {
+				const float sample_angle = angle + window.angles[c];
+				const int phase = (sample_angle <= 0.0f ? 3 : 0) ^ (int(std::fabs(sample_angle * 2.0f / Pi)) & 3);
+				samples.values[c] = planes_[size_t(phase)][size_t(texels[c])];
+			}
+		break;
+	}
+
+	return samples;
+}
+
+void ScanTarget::separate_chrominance(const Line &line) {
+	// Chrominance is separated at four samples per colour cycle, indexed by the absolute
+	// composite angle. Anything not written is neutral.
+	std::fill(qam_.begin(), qam_.end(), 0.0f);
+
+	const float start_position = std::floor(std::fabs(float(line.end_points[0].composite_angle)) / 16.0f);
+	const float end_position = std::floor(std::fabs(float(line.end_points[1].composite_angle)) / 16.0f);
+	if(start_position == end_position) return;
+
+	const int begin = std::max(0, int(std::ceil(std::min(start_position, end_position) - 0.5f)));
+	const int end = std::min(LineBufferWidth, int(std::ceil(std::max(start_position, end_position) - 0.5f)));
+
+	const bool is_svideo = modals().display_type == DisplayType::SVideo;
+	const float amplitude = float(line.composite_amplitude) / 255.0f;
+	const float one_over_amplitude = line.composite_amplitude ? 255.0f / float(line.composite_amplitude) : 0.0f;
+
+	const float start_clock = float(line.end_points[0].cycles_since_end_of_horizontal_retrace);
+	const float clock_range = float(line.end_points[1].cycles_since_end_of_horizontal_retrace) - start_clock;
+	const float start_angle = float(line.end_points[0].composite_angle) * (Pi / 32.0f);
+	const float angle_range = float(line.end_points[1].composite_angle - line.end_points[0].composite_angle) * (Pi / 32.0f);
+
+	const auto lateral = [&](int x) {
+		return (float(x) + 0.5f - start_position) / (end_position - start_position);
+	};
+	Rotation rotation(start_angle + lateral(begin) * angle_range, angle_range / (end_position - start_position));
+	for(int x = begin; x < end; x++, rotation.advance()) {
+		const float clock = start_clock + lateral(x) * clock_range;
+		const float angle = start_angle + lateral(x) * angle_range;
+
+		float chrominance = 0.0f;
+		if(is_svideo) {
+			if(source_ == Source::LuminanceChrominance) {
+				const auto texel = size_t(std::clamp(int(std::floor(clock)), 0, LineBufferWidth - 1));
+				chrominance = rotation.cos() * planes_[1][texel] + rotation.sin() * planes_[2][texel];
+			}
+		} else {
+			// Take the average to calculate luminance, then subtract that from the
+			// central two samples to give chrominance.
+			const auto samples = sample(clock, angle, rotation.cos(), rotation.sin(), amplitude, composite_window_);
+			const float luminance = dot(samples.values, MeanWeights);
+			chrominance = ((samples.values[1] + samples.values[2]) * 0.5f - luminance) * one_over_amplitude;
+		}
+
+		qam_[size_t(x) * 2] = chrominance * rotation.cos();
+		qam_[size_t(x) * 2 + 1] = chrominance * rotation.sin();
+	}
+}
+
+void ScanTarget::convert_line(const Line &line, bool is_unchanged) {
+	const auto &modals = BufferingScanTarget::modals();
+
+	// Determine the horizontal extent of this line in the framebuffer; lines are painted
+	// horizontally at the height of their start point.
+	const float scale_x = float(modals.output_scale.x);
+	const float scale_y = float(modals.output_scale.y) * modals.aspect_ratio * (3.0f / 4.0f);
+	const float start_x =
+		((float(line.end_points[0].x) / scale_x - modals.visible_area.origin.x) / modals.visible_area.size.width) * float(output_width_);
+	const float end_x =
+		((float(line.end_points[1].x) / scale_x - modals.visible_area.origin.x) / modals.visible_area.size.width) * float(output_width_);
+	if(start_x == end_x) return;
+
+	const int begin_x = std::max(0, int(std::ceil(std::min(start_x, end_x) - 0.5f)));
+	const int end_x_limit = std::min(output_width_, int(std::ceil(std::max(start_x, end_x) - 0.5f)));
+	if(begin_x >= end_x_limit) return;
+
+	// Slightly over-amping row height here is a cheap way to make sure that lines converge
+	// even allowing for the fact that they may not be spaced by exactly the expected distance.
+	const float row_height = 1.05f / float(modals.expected_vertical_lines);
+	const float centre_y = float(line.end_points[0].y) / scale_y;
+	const float top_y = ((centre_y - row_height * 0.5f - modals.visible_area.origin.y) / modals.visible_area.size.height) * float(output_height_);
+	const float bottom_y = ((centre_y + row_height * 0.5f - modals.visible_area.origin.y) / modals.visible_area.size.height) * float(output_height_);
+	const int begin_y = std::max(0, int(std::ceil(top_y - 0.5f)));
+	const int end_y = std::min(output_height_, int(std::ceil(bottom_y - 0.5f)));
+	if(begin_y >= end_y) return;
+
+	// An unchanged line would paint exactly what is already present.
+	if(is_unchanged) {
+		for(int y = begin_y; y < end_y; y++) {
+			const size_t row = size_t(y) * size_t(output_width_);
+			std::fill(&stencil_[row + size_t(begin_x)], &stencil_[row + size_t(end_x_limit)], 1);
+		}
+		return;
+	}
+
+	// Decode as much of the unprocessed line as might be sampled.
+	const float start_clock = float(line.end_points[0].cycles_since_end_of_horizontal_retrace);
+	const float end_clock = float(line.end_points[1].cycles_since_end_of_horizontal_retrace);
+	decode_line(
+		line.line,
+		std::max(0, int(std::min(start_clock, end_clock)) - sample_reach_),
+		std::min(LineBufferWidth, int(std::max(start_clock, end_clock)) + sample_reach_));
+
+	const float start_angle = float(line.end_points[0].composite_angle);
+	const float end_angle = float(line.end_points[1].composite_angle);
+	const float amplitude = float(line.composite_amplitude) / 255.0f;
+
+	const bool uses_qam =
+		(modals.display_type == DisplayType::SVideo) ||
+		(modals.display_type == DisplayType::CompositeColour && amplitude >= 0.01f);
+	if(uses_qam) {
+		separate_chrominance(line);
+	}
+	const float start_qam = std::floor(std::fabs(start_angle) / 16.0f);
+	const float end_qam = std::floor(std::fabs(end_angle) / 16.0f);
+
+	// Calculate a colour for each pixel along the line.
+	const auto lateral_for = [&](int x) {
+		return (float(x) + 0.5f - start_x) / (end_x - start_x);
+	};
+	Rotation rotation(
+		(start_angle + lateral_for(begin_x) * (end_angle - start_angle)) * (Pi / 32.0f),
+		(end_angle - start_angle) * (Pi / 32.0f) / (end_x - start_x));
+
+	float *colour = line_colours_.data();
+	for(int x = begin_x; x < end_x_limit; x++, colour += 3, rotation.advance()) {
+		const float lateral = lateral_for(x);
+		const float clock = start_clock + lateral * (end_clock - start_clock);
+		const float angle = (start_angle + lateral * (end_angle - start_angle)) * (Pi / 32.0f);
+
+		float luminance;
+		float chrominance[2] = {0.0f, 0.0f};
+		switch(modals.display_type) {
+			case DisplayType::RGB: {
+				int texels[4];
+				for(size_t c = 0; c < 4; c++) {
+					texels[c] = std::clamp(int(std::floor(clock + sampling_window_.offsets[c])), 0, LineBufferWidth - 1);
+				}
+				for(size_t c = 0; c < 3; c++) {
+					Samples samples;
+					Float4::gather(planes_[c].data(), texels).store(samples.values);
+					colour[c] = dot(samples.values, SoftWeights);
+				}
+			} continue;
+
+			case DisplayType::CompositeMonochrome:
+				luminance = dot(sample(clock, angle, rotation.cos(), rotation.sin(), amplitude, sampling_window_).values, LuminanceWeights);
+			break;
+
+			case DisplayType::CompositeColour: {
+				const auto samples = sample(clock, angle, rotation.cos(), rotation.sin(), amplitude, sampling_window_);
+				if(!uses_qam) {
+					// Compute only a luminance if there's no colour information.
+					luminance = dot(samples.values, SoftWeights);
+				} else {
+					luminance = dot(samples.values, MeanWeights) / std::max(1.0f - amplitude, 0.01f);
+				}
+			} break;
+
+			default:
+			case DisplayType::SVideo:
+				luminance = dot(sample(clock, angle, rotation.cos(), rotation.sin(), 0.0f, sampling_window_).values, LuminanceWeights);
+			break;
+		}
+
+		if(uses_qam) {
+			// Average chrominance across four points centred on this one.
+			const float position = start_qam + lateral * (end_qam - start_qam);
+			for(int c = 0; c < 4; c++) {
+				const auto index = size_t(std::clamp(int(std::floor(position + float(c) - 1.5f)), 0, LineBufferWidth - 1));
+				chrominance[0] += qam_[index * 2];
+				chrominance[1] += qam_[index * 2 + 1];
+			}
+			chrominance[0] *= 0.25f;
+			chrominance[1] *= 0.25f;
+
+			for(size_t c = 0; c < 3; c++) {
+				colour[c] =
+					luma_chroma_to_rgb_[c] * luminance +
+					luma_chroma_to_rgb_[c + 3] * chrominance[0] +
+					luma_chroma_to_rgb_[c + 6] * chrominance[1];
+			}
+		} else {
+			colour[0] = colour[1] = colour[2] = luminance;
+		}
+	}
+
+	// Paint to all covered rows, skipping pixels already painted this field and
+	// blending with what was there previously.
+	const auto gamma_limit = float(gamma_table_.size() - 1);
+	for(int y = begin_y; y < end_y; y++) {
+		const size_t row = size_t(y) * size_t(output_width_);
+		colour = line_colours_.data();
+		for(int x = begin_x; x < end_x_limit; x++, colour += 3) {
+			auto &stencil = stencil_[row + size_t(x)];
+			if(stencil) continue;
+			stencil = 1;
+
+			uint8_t *const target = &framebuffer_[(row + size_t(x)) * 4];
+			for(size_t c = 0; c < 3; c++) {
+				const float level = std::clamp(colour[c] * brightness_, 0.0f, 1.0f);
+				const float output = gamma_table_[size_t(level * gamma_limit + 0.5f)] * 0.64f + float(target[c]) * (0.4f / 255.0f);
+				target[c] = uint8_t(std::min(output, 1.0f) * 255.0f + 0.5f);
+			}
+			target[3] = 0xff;
+		}
+	}
+}
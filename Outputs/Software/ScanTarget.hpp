@@ -0,0 +1,140 @@
+//
+//  ScanTarget.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "../ScanTargets/BufferingScanTarget.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Outputs::Display::Software {
+
+/*!
+	Provides a ScanTarget that renders entirely on the CPU, to an RGBA framebuffer in main memory.
+
+	It follows the same pipeline as the OpenGL scan target: scans are first composed into a
+	buffer of whole lines, in a normalised form of the input data; QAM chrominance is separated
+	line by line if required; and then lines are decoded to RGB and painted to the framebuffer,
+	with each pixel being painted at most once per field and untouched pixels decaying at
+	the start of each frame.
+*/
+class ScanTarget: public Outputs::Display::BufferingScanTarget {
+	public:
+		ScanTarget(float output_gamma = 2.2f);
+
+		/*! Processes all the latest input, painting it to a framebuffer of the specified size. */
+		void update(int output_width, int output_height);
+
+		/*!
+			Holds a copy of the framebuffer as RGBA data, in raster order.
+		*/
+		struct Screenshot {
+			std::vector<uint8_t> pixel_data;
+			int width = 0, height = 0;
+		};
+
+		/*! @returns A copy of the current contents of the framebuffer. Safe to call from any thread. */
+		Screenshot screenshot();
+
+	private:
+		static constexpr int LineBufferWidth = 2048;
+		static constexpr int LineBufferHeight = 2048;
+
+		const float output_gamma_;
+
+		size_t lines_submitted_ = 0;
+		std::chrono::high_resolution_clock::time_point line_submission_begin_time_;
+
+		// Storage for the various buffers.
+		std::vector<uint8_t> write_area_texture_;
+		std::array<Scan, LineBufferHeight*5> scan_buffer_;
+		std::array<Line, LineBufferHeight> line_buffer_;
+		std::array<LineMetadata, LineBufferHeight> line_metadata_buffer_;
+
+		// Contains the first composition of scans into lines, as RGBA8; lines are
+		// accumulated prior to output to allow for continuous application of any
+		// necessary conversions — e.g. composite processing.
+		std::vector<uint32_t> unprocessed_lines_;
+		uint32_t clear_colour_ = 0;
+
+		// Receives scan target modals.
+		void setup_pipeline();
+
+		/// Describes how each unprocessed line will be decoded.
+		enum class Source {
+			/// Planes are red, green and blue.
+			RGB,
+			/// Plane 0 is luminance; there is no chrominance.
+			Luminance,
+			/// Plane 0 is luminance; chrominance is cos(angle)*plane 1 + sin(angle)*plane 2.
+			LuminanceChrominance,
+			/// Planes 0–3 are each the luminance for a quarter of the colour cycle.
+			PhaseLinkedLuminance,
+		} source_ = Source::Luminance;
+
+		// Pipeline constants, as derived from the modals.
+		std::array<float, 9> rgb_to_luma_chroma_{}, luma_chroma_to_rgb_{};
+		std::array<std::array<float, 2>, 256> phase_quadrature_{};
+		struct SamplingWindow {
+			std::array<float, 4> offsets{};
+			std::array<float, 4> cos_angles{}, sin_angles{};
+			std::array<float, 4> angles{};
+			void set(int index, float offset, float angle);
+		} composite_window_, sampling_window_;
+		std::array<float, 1024> gamma_table_{};
+		float brightness_ = 1.0f;
+		int sample_reach_ = 1;
+
+		/// Decodes the texels [begin, end) of unprocessed line @c line into planar form.
+		void decode_line(uint16_t line, int begin, int end);
+		alignas(32) std::array<std::array<float, LineBufferWidth>, 4> planes_;
+
+		/// @returns Four composite samples from the decoded line, at the positions and angles specified
+		/// by @c window relative to @c clock and @c angle. These are also the S-Video luminances if
+		/// @c amplitude is zero.
+		struct Samples {
+			alignas(16) float values[4];
+		};
+		Samples sample(float clock, float angle, float cos_angle, float sin_angle, float amplitude, const SamplingWindow &window) const;
+
+		/// Fills qam_ with the separated chrominance of @c line.
+		void separate_chrominance(const Line &line);
+		std::vector<float> qam_;
+
+		/// Paints @c line to the framebuffer or, if @c is_unchanged is @c true, merely marks the pixels that it
+		/// would have painted as painted, leaving the framebuffer as it is.
+		void convert_line(const Line &line, bool is_unchanged);
+		std::vector<float> line_colours_;
+
+		// The framebuffer and a stencil recording which pixels have been painted
+		// during the current field.
+		std::vector<uint8_t> framebuffer_;
+		std::vector<uint8_t> stencil_;
+		int output_width_ = 0, output_height_ = 0;
+		bool stencil_is_valid_ = false;
+		std::atomic_flag is_drawing_to_framebuffer_;
+
+		// Lines that are unchanged from the previous frame need not be repainted once
+		// repeated blending has brought the framebuffer to a steady state; that takes
+		// SteadyStateFrames. Any change to the framebuffer or pipeline forces at least
+		// that many frames to be painted in full.
+		static constexpr int SteadyStateFrames = 8;
+		int full_repaint_frames_ = SteadyStateFrames;
+		bool is_unchanged(const LineMetadata &metadata) const {
+			return !full_repaint_frames_ && metadata.frames_unchanged >= SteadyStateFrames;
+		}
+
+		/// Updates sampling_window_ and sample_reach_ for the current output width.
+		void set_sampling_window(int output_width);
+};
+
+}
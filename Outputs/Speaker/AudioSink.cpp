@@ -0,0 +1,184 @@
+//
+//  AudioSink.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#include "AudioSink.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+using namespace Outputs::Speaker;
+
+namespace {
+
+/// The size of a canonical WAV header, which is all that this sink writes.
+constexpr std::size_t WAVHeaderSize = 44;
+
+}
+
+AudioSink::AudioSink(std::size_t capacity) {
+	std::size_t size = 1;
+	while(size < capacity) size <<= 1;
+	buffer_.resize(size);
+	mask_ = size - 1;
+}
+
+AudioSink::~AudioSink() {
+	stop_capture();
+}
+
+// MARK: - Ring buffer.
+
+void AudioSink::set_latency_limit(std::size_t samples) {
+	latency_limit_ = samples;
+}
+
+std::size_t AudioSink::available() const {
+	return write_pointer_.load(std::memory_order_acquire) - read_pointer_.load(std::memory_order_relaxed);
+}
+
+std::size_t AudioSink::overflowed() const {
+	return overflowed_.load(std::memory_order_relaxed);
+}
+
+void AudioSink::speaker_did_complete_samples(Speaker *, const std::vector<int16_t> &buffer) {
+	if(capture_file_) {
+		capture(buffer);
+	}
+
+	// Post as much as will fit; the reader is responsible for discarding anything stale
+	// so a shortage of space implies that the reader has stalled altogether.
+	const std::size_t write_pointer = write_pointer_.load(std::memory_order_relaxed);
+	const std::size_t space = buffer_.size() - (write_pointer - read_pointer_.load(std::memory_order_acquire));
+	const std::size_t length = std::min(space, buffer.size());
+	if(length < buffer.size()) {
+		overflowed_.fetch_add(buffer.size() - length, std::memory_order_relaxed);
+	}
+
+	const std::size_t start = write_pointer & mask_;
+	const std::size_t first_length = std::min(length, buffer_.size() - start);
+	std::copy(buffer.begin(), buffer.begin() + ptrdiff_t(first_length), buffer_.begin() + ptrdiff_t(start));
+	std::copy(buffer.begin() + ptrdiff_t(first_length), buffer.begin() + ptrdiff_t(length), buffer_.begin());
+
+	write_pointer_.store(write_pointer + length, std::memory_order_release);
+}
+
+std::size_t AudioSink::read(int16_t *target, std::size_t count) {
+	const std::size_t write_pointer = write_pointer_.load(std::memory_order_acquire);
+	std::size_t read_pointer = read_pointer_.load(std::memory_order_relaxed);
+
+	// Skip anything that has become too old.
+	if(latency_limit_ && write_pointer - read_pointer > latency_limit_) {
+		read_pointer = write_pointer - latency_limit_;
+	}
+
+	const std::size_t length = std::min(count, write_pointer - read_pointer);
+	const std::size_t start = read_pointer & mask_;
+	const std::size_t first_length = std::min(length, buffer_.size() - start);
+	std::copy(buffer_.begin() + ptrdiff_t(start), buffer_.begin() + ptrdiff_t(start + first_length), target);
+	std::copy(buffer_.begin(), buffer_.begin() + ptrdiff_t(length - first_length), target + first_length);
+	std::fill(target + length, target + count, 0);
+
+	read_pointer_.store(read_pointer + length, std::memory_order_release);
+	return length;
+}
+
+// MARK: - Capture.
+
+void AudioSink::start_capture(const std::string &file_name, CaptureFormat format, int sample_rate, bool is_stereo) {
+	stop_capture();
+
+	capture_file_ = std::make_unique<Storage::FileHolder>(file_name, Storage::FileHolder::FileMode::Rewrite);
+	if(!capture_queue_) capture_queue_ = std::make_unique<Concurrency::AsyncTaskQueue<true, true, void, true>>();
+
+	// All blocks start out free; any previous capture has been flushed so none is in use.
+	capture_pool_.resize(CaptureBlockSize * CaptureBlockCount);
+	for(std::size_t index = 0; index < CaptureBlockCount; index++) {
+		free_blocks_[index] = index;
+	}
+	freed_.store(CaptureBlockCount, std::memory_order_relaxed);
+	taken_ = 0;
+	take_capture_block();
+	captured_bytes_ = 0;
+	capture_format_ = format;
+
+	if(format == CaptureFormat::WAV) {
+		const uint16_t channels = is_stereo ? 2 : 1;
+
+		// Lengths are unknown until the capture ends, so are written as zero for now.
+		capture_file_->write(reinterpret_cast<const uint8_t *>("RIFF"), 4);
+		capture_file_->put_le<uint32_t>(0);
+		capture_file_->write(reinterpret_cast<const uint8_t *>("WAVEfmt "), 8);
+		capture_file_->put_le<uint32_t>(16);
+		capture_file_->put_le<uint16_t>(1);								// i.e. PCM.
+		capture_file_->put_le<uint16_t>(channels);
+		capture_file_->put_le<uint32_t>(uint32_t(sample_rate));
+		capture_file_->put_le<uint32_t>(uint32_t(sample_rate) * channels * 2);	// Bytes per second.
+		capture_file_->put_le<uint16_t>(channels * 2);					// Bytes per frame.
+		capture_file_->put_le<uint16_t>(16);							// Bits per sample.
+		capture_file_->write(reinterpret_cast<const uint8_t *>("data"), 4);
+		capture_file_->put_le<uint32_t>(0);
+	}
+}
+
+void AudioSink::stop_capture() {
+	if(!capture_file_) return;
+
+	// Wait for all blocks to be written before completing the header.
+	flush_capture_block();
+	capture_queue_->flush();
+
+	if(capture_format_ == CaptureFormat::WAV) {
+		capture_file_->seek(4, SEEK_SET);
+		capture_file_->put_le<uint32_t>(uint32_t(captured_bytes_ + WAVHeaderSize - 8));
+		capture_file_->seek(long(WAVHeaderSize - 4), SEEK_SET);
+		capture_file_->put_le<uint32_t>(uint32_t(captured_bytes_));
+	}
+	capture_file_.reset();
+}
+
+void AudioSink::capture(const std::vector<int16_t> &buffer) {
+	for(const auto sample: buffer) {
+		if(capture_block_pointer_ == CaptureBlockSize) {
+			flush_capture_block();
+		}
+
+		// Files are always little endian.
+		capture_block_[capture_block_pointer_ + 0] = uint8_t(sample);
+		capture_block_[capture_block_pointer_ + 1] = uint8_t(uint16_t(sample) >> 8);
+		capture_block_pointer_ += 2;
+	}
+}
+
+void AudioSink::flush_capture_block() {
+	if(!capture_block_pointer_) return;
+
+	// Hand the filled part of the block to the capture queue, which will return the block to
+	// the free list once it has been written, and start a new one.
+	capture_queue_->enqueue([this, block = capture_block_, size = capture_block_pointer_] {
+		capture_file_->write(block, size);
+
+		const std::size_t freed = freed_.load(std::memory_order_relaxed);
+		free_blocks_[freed % CaptureBlockCount] = std::size_t(block - capture_pool_.data()) / CaptureBlockSize;
+		freed_.store(freed + 1, std::memory_order_release);
+	});
+	captured_bytes_ += capture_block_pointer_;
+
+	take_capture_block();
+}
+
+void AudioSink::take_capture_block() {
+	// Wait for the writing thread to return a block if none is free.
+	while(freed_.load(std::memory_order_acquire) == taken_) {
+		std::this_thread::yield();
+	}
+
+	capture_block_ = &capture_pool_[free_blocks_[taken_ % CaptureBlockCount] * CaptureBlockSize];
+	capture_block_pointer_ = 0;
+	++taken_;
+}
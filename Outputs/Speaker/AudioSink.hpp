@@ -0,0 +1,130 @@
+//
+//  AudioSink.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Speaker.hpp"
+#include "../../Concurrency/AsyncTaskQueue.hpp"
+#include "../../Storage/FileHolder.hpp"
+
+namespace Outputs::Speaker {
+
+/*!
+	Receives audio from a @c Speaker and holds it in a lock-free ring buffer until collected by
+	an audio output, e.g. a host's audio callback. Optionally also streams everything received
+	to a file, as raw PCM or as a WAV.
+
+	Samples are posted by the speaker's thread and collected by exactly one other; neither side
+	takes a lock or allocates. While capturing, the posting thread also hands each full block of
+	capture output to a separate thread for writing, so that it never waits for file I/O. Blocks
+	come from a fixed pool allocated when capture starts, and are returned by the writing thread
+	once written; the posting thread waits only if every block is still awaiting the disk.
+*/
+class AudioSink: public Speaker::Delegate {
+	public:
+		/// Creates an @c AudioSink with room for at least @c capacity samples, mono or interleaved stereo.
+		AudioSink(std::size_t capacity = 8192);
+		~AudioSink();
+
+		/*!
+			Sets the maximum number of samples that may be waiting when @c read is called; any older
+			samples are discarded so that output latency remains bounded. A limit of zero imposes no bound
+			other than the buffer's capacity.
+
+			Should be called only from the reading thread.
+		*/
+		void set_latency_limit(std::size_t samples);
+
+		/*!
+			Copies up to @c count of the oldest waiting samples to @c target and fills any shortfall
+			with silence.
+
+			@returns The number of samples that were copied, as opposed to filled.
+		*/
+		std::size_t read(int16_t *target, std::size_t count);
+
+		/// @returns The number of samples currently waiting to be read.
+		std::size_t available() const;
+
+		/// @returns The number of samples that have been discarded because the buffer was full when they arrived.
+		std::size_t overflowed() const;
+
+		enum class CaptureFormat {
+			/// Headerless signed 16-bit little-endian samples.
+			Raw,
+			/// A RIFF WAVE file containing 16-bit PCM.
+			WAV,
+		};
+
+		/*!
+			Begins writing all subsequently-posted samples to @c file_name, replacing any capture already
+			in progress. @c sample_rate and @c is_stereo are used only to complete a WAV header.
+
+			Captures must be started and stopped only while no samples are being posted, e.g. before
+			this sink becomes a speaker's delegate or after it has ceased to be.
+
+			@throws Storage::FileHolder::Error::CantOpen if the file cannot be opened.
+		*/
+		void start_capture(const std::string &file_name, CaptureFormat format, int sample_rate, bool is_stereo);
+
+		/*!
+			Writes any buffered capture output and closes the capture file, completing its header if required.
+			This is also performed upon destruction.
+		*/
+		void stop_capture();
+
+		// Speaker::Delegate.
+		void speaker_did_complete_samples(Speaker *, const std::vector<int16_t> &buffer) final;
+
+	private:
+		// The ring buffer; read_pointer_ and write_pointer_ count samples in total,
+		// and are mapped into buffer_ via mask_.
+		std::vector<int16_t> buffer_;
+		std::size_t mask_;
+		std::size_t latency_limit_ = 0;
+
+		alignas(64) std::atomic<std::size_t> write_pointer_ = 0;
+		alignas(64) std::atomic<std::size_t> read_pointer_ = 0;
+		std::atomic<std::size_t> overflowed_ = 0;
+
+		// Capture state; output is collected in one of the blocks of capture_pool_ and, once
+		// that block is full, passed to capture_queue_ to be written to capture_file_. The
+		// writing thread then returns the block via free_blocks_.
+		//
+		// Only the posting thread enqueues capture work, other than while starting or stopping
+		// a capture, when no samples are being posted; so the queue can be single-producer.
+		static constexpr std::size_t CaptureBlockSize = 64 * 1024;
+		static constexpr std::size_t CaptureBlockCount = 4;
+		std::unique_ptr<Storage::FileHolder> capture_file_;
+		std::unique_ptr<Concurrency::AsyncTaskQueue<true, true, void, true>> capture_queue_;
+		std::vector<uint8_t> capture_pool_;
+		uint8_t *capture_block_ = nullptr;
+		std::size_t capture_block_pointer_ = 0;
+
+		// A single-producer, single-consumer list of block indices: freed_ is advanced
+		// by the writing thread as it returns blocks; taken_ by the posting thread.
+		std::array<std::size_t, CaptureBlockCount> free_blocks_{};
+		alignas(64) std::atomic<std::size_t> freed_ = 0;
+		alignas(64) std::size_t taken_ = 0;
+		std::size_t captured_bytes_ = 0;
+		CaptureFormat capture_format_ = CaptureFormat::Raw;
+
+		void capture(const std::vector<int16_t> &buffer);
+		void flush_capture_block();
+		void take_capture_block();
+};
+
+}
@@ -0,0 +1,230 @@
+//
+//  BandLimitedStepBuffer.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "../Speaker.hpp"
+
+namespace Outputs::Speaker {
+
+/*!
+	Accumulates changes in level, timed in input cycles, as band-limited steps at the output rate.
+
+	Sources that output a piecewise-constant signal — e.g. square waves — can describe it purely by
+	its transitions. Each transition is deposited as the difference of a windowed-sinc step response,
+	resolved to one of @c Phases fractional positions between output samples, and output samples
+	are the running total of those differences. The cost of synthesis is therefore proportional to
+	the number of transitions and the output rate, not to the input rate.
+
+	Output is delayed relative to input by half of the step response's width.
+*/
+template <bool is_stereo> class BandLimitedStepBuffer {
+	public:
+		static constexpr size_t Channels = is_stereo + 1;
+
+		/*!
+			Sets the relationship between input cycles and output samples, and the highest frequency
+			that steps should retain; a @c high_frequency_cutoff of zero or less selects a cut-off
+			just below the output Nyquist frequency.
+
+			Any transitions already recorded are retained.
+		*/
+		void set_rates(float input_cycles_per_second, float output_cycles_per_second, float high_frequency_cutoff) {
+			ratio_ = uint64_t(double(output_cycles_per_second) / double(input_cycles_per_second) * double(1ull << TimeShift));
+
+			// Pick a cut-off as a proportion of the output rate, and a window long enough to be
+			// able to achieve it.
+			double cutoff = 0.45;
+			if(high_frequency_cutoff > 0.0f) {
+				cutoff = std::min(cutoff, double(high_frequency_cutoff) / double(output_cycles_per_second));
+			}
+			const size_t width = std::clamp(size_t(std::ceil(14.4 / cutoff)) + 3, size_t(4), MaximumWidth) & ~size_t(3);
+
+			// Retain anything not yet output; the buffer never shrinks so that no part of
+			// any earlier step can be lost.
+			width_ = width;
+			buffer_.resize(std::max(buffer_.size(), (Capacity + width_ + 1) * Channels));
+
+			// Tabulate the integral of a Blackman-windowed sinc, from one sample before the window to its
+			// end at a resolution of Phases points per sample.
+			const auto impulse = [&](double x) {
+				const double window = 0.42 + 0.5 * std::cos(2.0 * Pi * x / double(width_)) + 0.08 * std::cos(4.0 * Pi * x / double(width_));
+				const double argument = 2.0 * cutoff * x;
+				const double sinc = argument == 0.0 ? 1.0 : std::sin(Pi * argument) / (Pi * argument);
+				return 2.0 * cutoff * sinc * window;
+			};
+
+			const double half_width = double(width_) * 0.5;
+			std::vector<double> integral((width_ + 1) * Phases + 1);
+			for(size_t c = Phases + 1; c < integral.size(); c++) {
+				const double end = double(c) / double(Phases) - half_width - 1.0;
+				const double start = end - 1.0 / double(Phases);
+				integral[c] =
+					integral[c - 1] +
+					(impulse(start) + 4.0 * impulse((start + end) * 0.5) + impulse(end)) / double(6 * Phases);
+			}
+
+			// Divide each phase into per-sample differences, normalised so that every complete step
+			// sums exactly to unity.
+			kernel_.resize(width_ * Phases);
+			for(size_t phase = 0; phase < Phases; phase++) {
+				int32_t *const target = &kernel_[phase * width_];
+				const double total = integral[(width_ + 1) * Phases - phase];
+
+				int32_t sum = 0;
+				size_t largest = 0;
+				for(size_t c = 0; c < width_; c++) {
+					const size_t start = (c + 1) * Phases - phase;
+					target[c] = int32_t(std::round(
+						(integral[start + Phases] - integral[start]) * double(1 << FixedShift) / total
+					));
+					sum += target[c];
+					if(std::abs(target[c]) > std::abs(target[largest])) largest = c;
+				}
+				target[largest] += (1 << FixedShift) - sum;
+			}
+		}
+
+		/*!
+			@returns The maximum number of input cycles that can be described before further output
+				must be collected via @c read.
+		*/
+		size_t get_input_capacity() {
+			if(read_pointer_ >= Capacity / 2) {
+				compact();
+			}
+			return std::max(size_t(1), size_t((uint64_t(Capacity - 1) << TimeShift) - now_) / ratio_);
+		}
+
+		/*!
+			Records a change in level from @c from to @c to, @c offset cycles after the current input time.
+			Changes should be posted in time order.
+		*/
+		void add_transition(size_t offset, MonoSample from, MonoSample to) {
+			const int delta = int(to) - int(from);
+			if(!delta) return;
+
+			const auto [target, kernel] = locate(offset);
+			if constexpr (is_stereo) {
+				for(size_t c = 0; c < width_; c++) {
+					target[c * 2 + 0] += delta * kernel[c];
+					target[c * 2 + 1] += delta * kernel[c];
+				}
+			} else {
+				for(size_t c = 0; c < width_; c++) {
+					target[c] += delta * kernel[c];
+				}
+			}
+		}
+
+		/*!
+			Records a change in level from @c from to @c to, @c offset cycles after the current input time.
+			Changes should be posted in time order.
+		*/
+		template <bool stereo = is_stereo>
+		std::enable_if_t<stereo> add_transition(size_t offset, StereoSample from, StereoSample to) {
+			const int left = int(to.left) - int(from.left);
+			const int right = int(to.right) - int(from.right);
+			if(!left && !right) return;
+
+			const auto [target, kernel] = locate(offset);
+			for(size_t c = 0; c < width_; c++) {
+				target[c * 2 + 0] += left * kernel[c];
+				target[c * 2 + 1] += right * kernel[c];
+			}
+		}
+
+		/*!
+			Advances the current input time by @c cycles, which should be no greater than the number most
+			recently returned by @c get_input_capacity.
+		*/
+		void advance(size_t cycles) {
+			now_ += cycles * ratio_;
+		}
+
+		/*! @returns The number of samples per channel that are complete and ready to @c read. */
+		size_t get_available() const {
+			return size_t(now_ >> TimeShift) + 1 - read_pointer_;
+		}
+
+		/*!
+			Writes the next @c count samples per channel to @c target, multiplying each by @c scale / 65536
+			and clamping to the 16-bit range.
+		*/
+		void read(size_t count, int16_t *target, int scale) {
+			int32_t *const source = &buffer_[read_pointer_ * Channels];
+			for(size_t c = 0; c < count * Channels; c += Channels) {
+				for(size_t channel = 0; channel < Channels; channel++) {
+					accumulator_[channel] += source[c + channel];
+					source[c + channel] = 0;
+					target[c + channel] = int16_t(std::clamp(
+						int((int64_t(accumulator_[channel]) * scale) >> (FixedShift + 16)),
+						-32768, 32767));
+				}
+			}
+			read_pointer_ += count;
+		}
+
+	private:
+		static constexpr double Pi = 3.14159265358979323846;
+
+		// Transitions are placed to within 1/Phases of an output sample.
+		static constexpr size_t Phases = 64;
+
+		// Steps are integers that sum to 1 << FixedShift; leave sufficient headroom that
+		// deltas of the full 16-bit range can be multiplied in.
+		static constexpr int FixedShift = 14;
+
+		static constexpr size_t Capacity = 2048;
+		static constexpr size_t MaximumWidth = 256;
+
+		// Time is measured in output samples, in fixed point.
+		static constexpr int TimeShift = 32;
+		uint64_t ratio_ = 1ull << TimeShift;
+		uint64_t now_ = 0;
+		size_t read_pointer_ = 0;
+		size_t width_ = 0;
+
+		std::vector<int32_t> kernel_;
+		std::vector<int32_t> buffer_;
+		int32_t accumulator_[Channels]{};
+
+		/// Moves all unread output to the start of the buffer. The most-recently read sample is also
+		/// retained, as the current time may lie anywhere after it.
+		void compact() {
+			const size_t discard = read_pointer_ - 1;
+			const auto start = buffer_.begin() + ptrdiff_t(discard * Channels);
+			std::fill(std::copy(start, buffer_.end(), buffer_.begin()), buffer_.end(), 0);
+			now_ -= uint64_t(discard) << TimeShift;
+			read_pointer_ = 1;
+		}
+
+		// A transition at output time t affects output samples floor(t) + 1 onwards;
+		// this leaves all samples up to and including floor(t) complete. Rounding to the
+		// nearest phase may carry into the next sample.
+		std::pair<int32_t *, const int32_t *> locate(size_t offset) {
+			static constexpr int PhaseShift = TimeShift - 6;
+			static_assert(Phases == 1 << 6);
+
+			const uint64_t time = now_ + offset * ratio_ + (1ull << (PhaseShift - 1));
+			return std::make_pair(
+				&buffer_[((time >> TimeShift) + 1) * Channels],
+				&kernel_[((time >> PhaseShift) & (Phases - 1)) * width_]
+			);
+		}
+};
+
+}
@@ -71,6 +71,17 @@ class BufferSource {
 		template <Action action>
 		void apply_samples(std::size_t number_of_samples, typename SampleT<stereo>::type *target);
 
+		/*!
+			Indicates whether this component can describe its output as a series of transitions. Sources that
+			set this to @c true must also implement @c apply_steps(number_of_samples, target), which should advance
+			by @c number_of_samples, posting every change in output level to @c target via its
+			@c add_transition(offset, from, to) within that period.
+
+			The initial @c from should be the final @c to of the previous call, regardless of any intervening calls
+			to @c apply_samples — sources will usually just keep a record of the most recent level posted.
+		*/
+		static constexpr bool has_band_limited_steps = false;
+
 		/*!
 			@returns @c true if it is trivially true that a call to get_samples would just
 				fill the target with zeroes; @c false if a call might return all zeroes or
@@ -101,6 +112,18 @@ class BufferSource {
 template <typename SourceT, bool stereo, int divider = 1>
 struct SampleSource: public BufferSource<SourceT, stereo> {
 	public:
+		/*!
+			Sources that set this to @c true must also implement:
+
+				int advances_until_transition() const;
+				void skip_advances(int count);
+
+			The former should return a number of calls to @c advance that definitely won't change @c level;
+			the latter should have the same effect as @c count calls to @c advance, for a @c count no greater
+			than that. @c apply_steps then skips directly over such periods.
+		*/
+		static constexpr bool can_skip_advances = false;
+
 		template <Action action>
 		void apply_samples(std::size_t number_of_samples, typename SampleT<stereo>::type *target) {
 			auto &source = *static_cast<SourceT *>(this);
@@ -138,6 +161,67 @@ struct SampleSource: public BufferSource<SourceT, stereo> {
 			}
 		}
 
+		/// Provides an implementation of @c apply_steps in terms of @c level and @c advance; a source
+		/// that wishes to use it must still opt in by declaring @c has_band_limited_steps.
+		template <typename TargetT>
+		void apply_steps(std::size_t number_of_samples, TargetT &target) {
+			auto &source = *static_cast<SourceT *>(this);
+			const auto post = [&](std::size_t offset) {
+				const auto level = source.level();
+				target.add_transition(offset, last_level_, level);
+				last_level_ = level;
+			};
+
+			// Skips up to @c limit advances if the source permits, returning the number skipped.
+			const auto skip = [&](std::size_t limit) -> std::size_t {
+				if constexpr (SourceT::can_skip_advances) {
+					const auto count = std::min(std::size_t(source.advances_until_transition()), limit);
+					if(count) source.skip_advances(int(count));
+					return count;
+				} else {
+					return 0;
+				}
+			};
+
+			// Time advances exactly as per apply_samples.
+			if constexpr (divider == 1) {
+				std::size_t c = 0;
+				while(c < number_of_samples) {
+					post(c);
+					if(const auto skipped = skip(number_of_samples - c)) {
+						c += skipped;
+						continue;
+					}
+
+					source.advance();
+					++c;
+				}
+			} else {
+				post(0);
+				std::size_t c = std::min(number_of_samples, std::size_t(divider - master_divider_));
+				source.advance();
+
+				auto whole_steps = (number_of_samples - c) / divider;
+				while(whole_steps) {
+					post(c);
+					if(const auto skipped = skip(whole_steps)) {
+						c += skipped * divider;
+						whole_steps -= skipped;
+						continue;
+					}
+
+					c += divider;
+					source.advance();
+					--whole_steps;
+				}
+
+				if(c < number_of_samples) {
+					post(c);
+				}
+				master_divider_ = static_cast<int>(number_of_samples - c);
+			}
+		}
+
 		// TODO: use a concept here, when C++20 filters through.
 		//
 		// Until then: sample sources should implement this.
@@ -146,6 +230,7 @@ struct SampleSource: public BufferSource<SourceT, stereo> {
 
 	private:
 		int master_divider_{};
+		typename SampleT<stereo>::type last_level_{};
 };
 
 }
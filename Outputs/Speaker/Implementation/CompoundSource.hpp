@@ -50,6 +50,8 @@ template <typename... T> class CompoundSource:
 		template <typename... S> class CompoundSourceHolder {
 			public:
 				static constexpr bool is_stereo = false;
+				static constexpr bool has_band_limited_steps = true;
+				template <typename TargetT> void apply_steps(std::size_t, TargetT &) {}
 				void set_scaled_volume_range(int16_t, double *, double) {}
 				static constexpr std::size_t size() {	return 0;	}
 				double total_scale(double *) const {	return 0.0;	}
@@ -60,6 +62,17 @@ template <typename... T> class CompoundSource:
 				CompoundSourceHolder(S &source, R &...next) : source_(source), next_source_(next...) {}
 
 				static constexpr bool is_stereo = S::is_stereo || CompoundSourceHolder<R...>::is_stereo;
+				static constexpr bool has_band_limited_steps =
+					S::has_band_limited_steps && CompoundSourceHolder<R...>::has_band_limited_steps;
+
+				template <typename TargetT>
+				void apply_steps(std::size_t number_of_samples, TargetT &target) {
+					// Steps are additive and any mono-to-stereo adaptation is performed by the target,
+					// so all sources can post directly. Sources at zero level are not skipped, as their
+					// transitions to and from silence must still be recorded.
+					source_.apply_steps(number_of_samples, target);
+					next_source_.apply_steps(number_of_samples, target);
+				}
 
 				template <Outputs::Speaker::Action action, bool output_stereo>
 				void apply_samples(std::size_t number_of_samples, typename ::Outputs::Speaker::SampleT<output_stereo>::type *target) {
@@ -140,6 +153,13 @@ template <typename... T> class CompoundSource:
 			source_holder_.template apply_samples<action, ::Outputs::Speaker::is_stereo<T...>()>(number_of_samples, target);
 		}
 
+		static constexpr bool has_band_limited_steps = CompoundSourceHolder<T...>::has_band_limited_steps;
+
+		template <typename TargetT>
+		void apply_steps(std::size_t number_of_samples, TargetT &target) {
+			source_holder_.apply_steps(number_of_samples, target);
+		}
+
 		/*!
 			Sets the total output volume of this CompoundSource.
 		*/
@@ -8,9 +8,10 @@
 
 #pragma once
 
+#include "BandLimitedStepBuffer.hpp"
 #include "BufferSource.hpp"
 #include "../Speaker.hpp"
-#include "../../../SignalProcessing/FIRFilter.hpp"
+#include "../../../SignalProcessing/PolyphaseFilter.hpp"
 #include "../../../ClockReceiver/ClockReceiver.hpp"
 #include "../../../Concurrency/AsyncTaskQueue.hpp"
 
@@ -52,6 +53,20 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 			filter_parameters_.parameters_are_dirty = true;
 		}
 
+		/*!
+			Enables or disables synthesis from band-limited steps, which is used in place of filtering
+			when downsampling from a source that is able to describe its output as transitions in level.
+			It is disabled by default.
+		*/
+		void set_band_limited_steps_enabled(bool enabled) {
+			std::lock_guard lock_guard(filter_parameters_mutex_);
+			if(filter_parameters_.band_limited_steps_enabled == enabled) {
+				return;
+			}
+			filter_parameters_.band_limited_steps_enabled = enabled;
+			filter_parameters_.parameters_are_dirty = true;
+		}
+
 	private:
 		float get_ideal_clock_rate_in_range(float minimum, float maximum) final {
 			std::lock_guard lock_guard(filter_parameters_mutex_);
@@ -89,26 +104,53 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 
 		// MARK: - Filtering.
 
+		static constexpr size_t Channels = is_stereo + 1;
+
+		// Resampling input is collected into a buffer of twice the filter's window length; windows
+		// are taken from successive positions within it and unconsumed input is moved back to
+		// the start only when it is full. Input depth, window start and the input capacity are
+		// all measured in samples per channel.
 		std::size_t output_buffer_pointer_ = 0;
 		std::size_t input_buffer_depth_ = 0;
+		std::size_t input_window_start_ = 0;
+		std::size_t input_capacity_ = 0;
+		std::size_t input_to_skip_ = 0;
 		std::vector<int16_t> input_buffer_;
 		std::vector<int16_t> output_buffer_;
 
 		float step_rate_ = 0.0f;
 		float position_error_ = 0.0f;
-		std::unique_ptr<SignalProcessing::FIRFilter> filter_;
+		std::unique_ptr<SignalProcessing::PolyphaseFilter<is_stereo>> filter_;
+
+		// Collects transitions and produces output if sampling from band-limited steps.
+		BandLimitedStepBuffer<is_stereo> steps_;
+
+		// Output positions are resolved to within 1/Phases of an input sample.
+		static constexpr size_t Phases = 32;
+
+		// Upsampling necessarily has a low ratio of input to output rates; ensure a minimum
+		// filter quality in that case.
+		static constexpr size_t MinimumUpsamplingTaps = 15;
 
 		std::mutex filter_parameters_mutex_;
 		struct FilterParameters {
 			float input_cycles_per_second = 0.0f;
 			float output_cycles_per_second = 0.0f;
 			float high_frequency_cutoff = -1.0;
+			bool band_limited_steps_enabled = false;
 
 			bool parameters_are_dirty = true;
 			bool input_rate_changed = false;
 		} filter_parameters_;
 
 		void update_filter_coefficients(const FilterParameters &filter_parameters) {
+			// Without both rates there's nothing sensible to output.
+			if(	filter_parameters.input_cycles_per_second <= 0.0f ||
+				filter_parameters.output_cycles_per_second <= 0.0f) {
+				conversion_ = Conversion::Discard;
+				return;
+			}
+
 			float high_pass_frequency = filter_parameters.output_cycles_per_second / 2.0f;
 			if(filter_parameters.high_frequency_cutoff > 0.0) {
 				high_pass_frequency = std::min(filter_parameters.high_frequency_cutoff, high_pass_frequency);
@@ -119,16 +161,9 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 				ceilf((filter_parameters.input_cycles_per_second + high_pass_frequency) / high_pass_frequency)
 			);
 			number_of_taps = (number_of_taps * 2) | 1;
-
-			step_rate_ = filter_parameters.input_cycles_per_second / filter_parameters.output_cycles_per_second;
-			position_error_ = 0.0f;
-
-			filter_ = std::make_unique<SignalProcessing::FIRFilter>(
-				unsigned(number_of_taps),
-				filter_parameters.input_cycles_per_second,
-				0.0,
-				high_pass_frequency,
-				SignalProcessing::FIRFilter::DefaultAttenuation);
+			if(filter_parameters.input_cycles_per_second < filter_parameters.output_cycles_per_second) {
+				number_of_taps = std::max(number_of_taps, MinimumUpsamplingTaps);
+			}
 
 			// Pick the new conversion function.
 			if(	filter_parameters.input_cycles_per_second == filter_parameters.output_cycles_per_second &&
@@ -144,43 +179,60 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 				conversion_ = Conversion::ResampleLarger;
 			}
 
-			// Do something sensible with any dangling input, if necessary.
-			const int scale = static_cast<ConcreteT *>(this)->get_scale();
-			switch(conversion_) {
-				// Neither direct copying nor resampling larger currently use any temporary input.
-				// Although in the latter case that's just because it's unimplemented. But, regardless,
-				// that means nothing to do.
-				default: break;
-
-				case Conversion::ResampleSmaller: {
-					// Reize the input buffer only if absolutely necessary; if sizing downward
-					// such that a sample would otherwise be lost then output it now. Keep anything
-					// currently in the input buffer that hasn't yet been processed.
-					const size_t required_buffer_size = size_t(number_of_taps) * (is_stereo + 1);
-					if(input_buffer_.size() != required_buffer_size) {
-						if(input_buffer_depth_ >= required_buffer_size) {
-							resample_input_buffer(scale);
-							input_buffer_depth_ %= required_buffer_size;
-						}
-						input_buffer_.resize(required_buffer_size);
-					}
-				} break;
+			// Downsampling from a source that can describe itself in terms of steps needs
+			// no filter, and no input buffer.
+			if constexpr (ConcreteT::has_band_limited_steps) {
+				if(conversion_ == Conversion::ResampleSmaller && filter_parameters.band_limited_steps_enabled) {
+					conversion_ = Conversion::BandLimitedSteps;
+					steps_.set_rates(
+						filter_parameters.input_cycles_per_second,
+						filter_parameters.output_cycles_per_second,
+						filter_parameters.high_frequency_cutoff);
+					return;
+				}
+			}
+
+			step_rate_ = filter_parameters.input_cycles_per_second / filter_parameters.output_cycles_per_second;
+			position_error_ = 0.0f;
+
+			filter_ = std::make_unique<SignalProcessing::PolyphaseFilter<is_stereo>>(
+				number_of_taps,
+				Phases,
+				filter_parameters.input_cycles_per_second,
+				0.0f,
+				high_pass_frequency,
+				SignalProcessing::FIRFilter::DefaultAttenuation);
+
+			// Size the input buffer for the new window, keeping as much as possible of
+			// anything in it that hasn't yet been processed. Direct copying uses no
+			// temporary input.
+			if(conversion_ != Conversion::Copy && filter_->get_number_of_taps() * 2 != input_capacity_) {
+				const size_t capacity = filter_->get_number_of_taps() * 2;
+				const size_t retained = std::min(input_buffer_depth_ - input_window_start_, capacity);
+				if(retained) {
+					std::memmove(
+						input_buffer_.data(),
+						&input_buffer_[(input_buffer_depth_ - retained) * Channels],
+						retained * Channels * sizeof(int16_t));
+				}
+				input_buffer_depth_ = retained;
+				input_window_start_ = 0;
+				input_capacity_ = capacity;
+				input_buffer_.resize(capacity * Channels + SignalProcessing::PolyphaseFilter<is_stereo>::Padding);
 			}
 		}
 
 		inline void resample_input_buffer(int scale) {
 			if(output_buffer_.empty()) {
+				input_window_start_ = input_buffer_depth_;
 				return;
 			}
 
-			if constexpr (is_stereo) {
-				output_buffer_[output_buffer_pointer_ + 0] = filter_->apply(input_buffer_.data(), 2);
-				output_buffer_[output_buffer_pointer_ + 1] = filter_->apply(input_buffer_.data() + 1, 2);
-				output_buffer_pointer_+= 2;
-			} else {
-				output_buffer_[output_buffer_pointer_] = filter_->apply(input_buffer_.data());
-				output_buffer_pointer_++;
-			}
+			filter_->apply(
+				&input_buffer_[input_window_start_ * Channels],
+				size_t(position_error_ * float(Phases)),
+				&output_buffer_[output_buffer_pointer_]);
+			output_buffer_pointer_ += Channels;
 
 			// Apply scale, if supplied, clamping appropriately.
 			if(scale != 65536) {
@@ -200,29 +252,23 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 				did_complete_samples(this, output_buffer_, is_stereo);
 			}
 
-			// If the next loop around is going to reuse some of the samples just collected, use a memmove to
-			// preserve them in the correct locations (TODO: use a longer buffer to fix that?) and don't skip
-			// anything. Otherwise skip as required to get to the next sample batch and don't expect to reuse.
-			const size_t steps = size_t(step_rate_ + position_error_) * (is_stereo + 1);
+			// Advance the window. If that moves it beyond the end of collected input, the buffer can be
+			// emptied and the intervening input need never be generated.
+			const size_t steps = size_t(step_rate_ + position_error_);
 			position_error_ = fmodf(step_rate_ + position_error_, 1.0f);
-			if(steps < input_buffer_.size()) {
-				auto *const input_buffer = input_buffer_.data();
-				std::memmove(	input_buffer,
-								&input_buffer[steps],
-								sizeof(int16_t) * (input_buffer_.size() - steps));
-				input_buffer_depth_ -= steps;
-			} else {
-				if(steps > input_buffer_.size()) {
-					static_cast<ConcreteT *>(this)->skip_samples((steps - input_buffer_.size()) / (1 + is_stereo));
-				}
-				input_buffer_depth_ = 0;
+			input_window_start_ += steps;
+			if(input_window_start_ >= input_buffer_depth_) {
+				input_to_skip_ = input_window_start_ - input_buffer_depth_;
+				input_window_start_ = input_buffer_depth_ = 0;
 			}
 		}
 
 		enum class Conversion {
 			ResampleSmaller,
 			Copy,
-			ResampleLarger
+			ResampleLarger,
+			BandLimitedSteps,
+			Discard,
 		} conversion_ = Conversion::Copy;
 
 		bool recalculate_filter_if_dirty() {
@@ -268,21 +314,72 @@ template <typename ConcreteT, bool is_stereo> class LowpassBase: public Speaker
 				break;
 
 				case Conversion::ResampleSmaller:
+				case Conversion::ResampleLarger: {
+					const size_t number_of_taps = filter_->get_number_of_taps();
 					while(length) {
-						const auto cycles_to_read = std::min((input_buffer_.size() - input_buffer_depth_) / (1 + is_stereo), length);
-						static_cast<ConcreteT *>(this)->get_samples(cycles_to_read, &input_buffer_[input_buffer_depth_]);
-						input_buffer_depth_ += cycles_to_read * (1 + is_stereo);
+						// Skip any input that falls entirely between windows.
+						if(input_to_skip_) {
+							const auto cycles_to_skip = std::min(input_to_skip_, length);
+							static_cast<ConcreteT *>(this)->skip_samples(cycles_to_skip);
+							input_to_skip_ -= cycles_to_skip;
+							length -= cycles_to_skip;
+							continue;
+						}
 
-						if(input_buffer_depth_ == input_buffer_.size()) {
-							resample_input_buffer(scale);
+						// If the buffer is full, move the current window back to the start.
+						if(input_buffer_depth_ == input_capacity_) {
+							input_buffer_depth_ -= input_window_start_;
+							std::memmove(
+								input_buffer_.data(),
+								&input_buffer_[input_window_start_ * Channels],
+								input_buffer_depth_ * Channels * sizeof(int16_t));
+							input_window_start_ = 0;
 						}
 
+						const auto cycles_to_read = std::min(input_capacity_ - input_buffer_depth_, length);
+						static_cast<ConcreteT *>(this)->get_samples(cycles_to_read, &input_buffer_[input_buffer_depth_ * Channels]);
+						input_buffer_depth_ += cycles_to_read;
 						length -= cycles_to_read;
+
+						// Output for as many windows as are now complete.
+						while(input_window_start_ + number_of_taps <= input_buffer_depth_) {
+							resample_input_buffer(scale);
+						}
+					}
+				} break;
+
+				case Conversion::BandLimitedSteps:
+					if constexpr (ConcreteT::has_band_limited_steps) {
+						if(output_buffer_.empty()) {
+							static_cast<ConcreteT *>(this)->skip_samples(length);
+							break;
+						}
+
+						while(length) {
+							const auto cycles_to_read = std::min(steps_.get_input_capacity(), length);
+							static_cast<ConcreteT *>(this)->get_steps(cycles_to_read, steps_);
+							steps_.advance(cycles_to_read);
+							length -= cycles_to_read;
+
+							// Output everything that is now complete.
+							while(const auto available = steps_.get_available()) {
+								const auto samples_to_write =
+									std::min(available, (output_buffer_.size() - output_buffer_pointer_) / Channels);
+								steps_.read(samples_to_write, &output_buffer_[output_buffer_pointer_], scale);
+								output_buffer_pointer_ += samples_to_write * Channels;
+
+								// Announce to delegate if full.
+								if(output_buffer_pointer_ == output_buffer_.size()) {
+									output_buffer_pointer_ = 0;
+									did_complete_samples(this, output_buffer_, is_stereo);
+								}
+							}
+						}
 					}
 				break;
 
-				case Conversion::ResampleLarger:
-					// TODO: input rate is less than output rate.
+				case Conversion::Discard:
+					static_cast<ConcreteT *>(this)->skip_samples(length);
 				break;
 			}
 
@@ -299,6 +396,8 @@ template <bool is_stereo> class PushLowpass: public LowpassBase<PushLowpass<is_s
 		friend BaseT;
 		using BaseT::process;
 
+		static constexpr bool has_band_limited_steps = false;
+
 		std::atomic<int> scale_ = 65536;
 		int get_scale() const {
 			return scale_.load(std::memory_order_relaxed);
@@ -371,7 +470,7 @@ template <typename SampleSource> class PullLowpass: public LowpassBase<PullLowpa
 			The speaker will advance by obtaining data from the sample source supplied
 			at construction, filtering it and passing it on to the speaker's delegate if there is one.
 		*/
-		void run_for(Concurrency::AsyncTaskQueue<false> &queue, const Cycles cycles) {
+		template <typename QueueT> void run_for(QueueT &queue, const Cycles cycles) {
 			if(cycles == Cycles(0)) {
 				return;
 			}
@@ -400,6 +499,11 @@ template <typename SampleSource> class PullLowpass: public LowpassBase<PullLowpa
 			sample_source_.template apply_samples<Action::Ignore>(count, nullptr);
 		}
 
+		static constexpr bool has_band_limited_steps = SampleSource::has_band_limited_steps;
+		void get_steps(size_t length, BandLimitedStepBuffer<SampleSource::is_stereo> &target) {
+			sample_source_.apply_steps(length, target);
+		}
+
 		int get_scale() {
 			return int(65536.0 / sample_source_.average_output_peak());
 		}
@@ -8,7 +8,7 @@
 
 #include "../6502.hpp"
 
-#include <cstring>
+#include <iterator>
 
 using namespace CPU::MOS6502;
 
@@ -75,7 +75,14 @@ using namespace CPU::MOS6502;
 
 #define JAM									{CycleFetchFFFF, CycleFetchFFFE, CycleFetchFFFE, CycleFetchFFFF, OperationSetJAMmed}
 
-ProcessorStorage::ProcessorStorage(Personality personality) {
+constexpr ProcessorStorage::OperationTable ProcessorStorage::operation_table(Personality personality) {
+	OperationTable table{};
+	const auto install = [&table](size_t location, const InstructionList &code) {
+		for(size_t c = 0; c < std::size(code); c++) {
+			table.operations[location][c] = code[c];
+		}
+	};
+
 	const InstructionList operations_6502[] = {
 		/* 0x00 BRK */			Program(CycleIncPCPushPCH, CyclePushPCL, OperationBRKPickVector, OperationSetOperandFromFlagsWithBRKSet, CyclePushOperand, OperationSetIRQFlags, CycleReadVectorLow, CycleReadVectorHigh),
 		/* 0x01 ORA x, ind */	IndexedIndirectRead(OperationORA),
@@ -300,10 +307,12 @@ ProcessorStorage::ProcessorStorage(Personality personality) {
 		//	(5) further operand, which goes unused.
 	};
 
-	static_assert(sizeof(operations_6502) == sizeof(operations_));
+	static_assert(sizeof(operations_6502) == sizeof(table.operations));
 
 	// Install the basic 6502 table.
-	memcpy(operations_, operations_6502, sizeof(operations_));
+	for(size_t location = 0; location < std::size(operations_6502); location++) {
+		install(location, operations_6502[location]);
+	}
 
 	// Patch the table according to the chip's personality.
 	//
@@ -334,7 +343,7 @@ ProcessorStorage::ProcessorStorage(Personality personality) {
 
 #define Install(location, instructions) {\
 		const InstructionList code = instructions;	\
-		memcpy(&operations_[location], code, sizeof(InstructionList));	\
+		install(size_t(location), code);	\
 	}
 	if(is_65c02(personality)) {
 		// Add P[L/H][X/Y].
@@ -479,4 +488,19 @@ ProcessorStorage::ProcessorStorage(Personality personality) {
 		}
 	}
 #undef Install
+
+	return table;
 }
+
+const ProcessorStorage::InstructionList *ProcessorStorage::operations_for(Personality personality) {
+	static constexpr OperationTable tables[] = {
+		operation_table(Personality::PNES6502),
+		operation_table(Personality::P6502),
+		operation_table(Personality::PSynertek65C02),
+		operation_table(Personality::PRockwell65C02),
+		operation_table(Personality::PWDC65C02),
+	};
+	return tables[personality].operations;
+}
+
+ProcessorStorage::ProcessorStorage(Personality personality) : operations_(operations_for(personality)) {}
@@ -231,7 +231,15 @@ class ProcessorStorage {
 
 			Max
 		};
-		InstructionList operations_[size_t(OperationsSlot::Max)];
+		struct OperationTable {
+			InstructionList operations[size_t(OperationsSlot::Max)];
+		};
+		static constexpr OperationTable operation_table(Personality);
+
+		/// @returns The full set of micro programs for @c personality; these are built at compile time
+		/// and shared by all instances.
+		static const InstructionList *operations_for(Personality);
+		const InstructionList *const operations_;
 
 		const MicroOp *scheduled_program_counter_ = nullptr;
 
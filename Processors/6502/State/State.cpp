@@ -30,6 +30,8 @@ State::State(const ProcessorBase &src): State() {
 	execution_state.operand = src.operand_;
 	execution_state.address = src.address_.full;
 	execution_state.next_address = src.next_address_.full;
+	execution_state.cycles_left_to_run = src.cycles_left_to_run_.as<int>();
+	execution_state.irq_request_history = src.irq_request_history_;
 	if(src.ready_is_active_) {
 		execution_state.phase = State::ExecutionState::Phase::Ready;
 	} else if(src.is_jammed_) {
@@ -42,15 +44,34 @@ State::State(const ProcessorBase &src): State() {
 		execution_state.phase = State::ExecutionState::Phase::Instruction;
 	}
 
-	const auto micro_offset = size_t(src.scheduled_program_counter_ - &src.operations_[0][0]);
+	// If no micro-program is yet scheduled then the processor either hasn't yet run or has been told
+	// to restart; capture whichever program it'll pick next, as if it had already picked it. That also
+	// consumes any power-on request, which is therefore never retained.
+	const ProcessorStorage::MicroOp *scheduled_program_counter = src.scheduled_program_counter_;
+	if(!scheduled_program_counter) {
+		using Flags = ProcessorStorage::InterruptRequestFlags;
+		using Slot = ProcessorStorage::OperationsSlot;
+		auto slot = Slot::FetchDecodeExecute;
+		if(src.interrupt_requests_ & (Flags::Reset | Flags::PowerOn)) {
+			slot = Slot::Reset;
+		} else if(src.interrupt_requests_ & Flags::NMI) {
+			slot = Slot::NMI;
+		} else if(src.interrupt_requests_ & Flags::IRQ) {
+			slot = Slot::IRQ;
+		}
+		scheduled_program_counter = &src.operations_[size_t(slot)][0];
+		inputs.reset = src.interrupt_requests_ & Flags::Reset;
+	}
+
+	const auto micro_offset = size_t(scheduled_program_counter - &src.operations_[0][0]);
 	const auto list_length = sizeof(ProcessorStorage::InstructionList) / sizeof(ProcessorStorage::MicroOp);
 
 	execution_state.micro_program = int(micro_offset / list_length);
 	execution_state.micro_program_offset = int(micro_offset % list_length);
-	assert(&src.operations_[execution_state.micro_program][execution_state.micro_program_offset] == src.scheduled_program_counter_);
+	assert(&src.operations_[execution_state.micro_program][execution_state.micro_program_offset] == scheduled_program_counter);
 }
 
-void State::apply(ProcessorBase &target) {
+void State::apply(ProcessorBase &target) const {
 	// Registers.
 	target.pc_.full = registers.program_counter;
 	target.s_ = registers.stack_pointer;
@@ -64,6 +85,7 @@ void State::apply(ProcessorBase &target) {
 	target.set_irq_line(inputs.irq);
 	target.set_nmi_line(inputs.nmi);
 	target.set_reset_line(inputs.reset);
+	target.interrupt_requests_ &= ~ProcessorStorage::InterruptRequestFlags::PowerOn;
 
 	// Execution state.
 	target.ready_is_active_ = target.is_jammed_ = target.wait_is_active_ = target.stop_is_active_ = false;
@@ -79,6 +101,8 @@ void State::apply(ProcessorBase &target) {
 	target.operand_ = execution_state.operand;
 	target.address_.full = execution_state.address;
 	target.next_address_.full = execution_state.next_address;
+	target.cycles_left_to_run_ = Cycles(execution_state.cycles_left_to_run);
+	target.irq_request_history_ = execution_state.irq_request_history;
 	target.scheduled_program_counter_ = &target.operations_[execution_state.micro_program][execution_state.micro_program_offset];
 }
 
@@ -112,6 +136,8 @@ State::ExecutionState::ExecutionState() {
 		DeclareField(operand);
 		DeclareField(address);
 		DeclareField(next_address);
+		DeclareField(cycles_left_to_run);
+		DeclareField(irq_request_history);
 	}
 }
 
@@ -74,6 +74,11 @@ struct State: public Reflection::StructImpl<State> {
 		uint8_t operation, operand;
 		uint16_t address, next_address;
 
+		// Time overrun from the most-recent run_for, to be repaid by the next, and the
+		// IRQ input as sampled at the most recent bus access.
+		int cycles_left_to_run = 0;
+		uint8_t irq_request_history = 0;
+
 		ExecutionState();
 	} execution_state;
 
@@ -84,7 +89,7 @@ struct State: public Reflection::StructImpl<State> {
 	State(const ProcessorBase &src);
 
 	/// Applies this state to @c target.
-	void apply(ProcessorBase &target);
+	void apply(ProcessorBase &target) const;
 };
 
 }
@@ -1125,6 +1125,6 @@ int ProcessorBase::get_extended_bus_output() {
 void ProcessorBase::restart_operation_fetch() {
 	// Find a OperationMoveToNextProgram, so that the main loop can make
 	// relevant decisions.
-	next_op_ = micro_ops_.data();
+	next_op_ = micro_ops_;
 	while(*next_op_ != OperationMoveToNextProgram) ++next_op_;
 }
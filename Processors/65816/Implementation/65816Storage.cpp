@@ -15,9 +15,9 @@
 using namespace CPU::WDC65816;
 
 struct CPU::WDC65816::ProcessorStorageConstructor {
-	// Establish that a storage constructor needs access to ProcessorStorage.
-	ProcessorStorage &storage_;
-	ProcessorStorageConstructor(ProcessorStorage &storage) : storage_(storage) {}
+	// Establish that a storage constructor needs access to ProcessorStorage's instruction set.
+	ProcessorStorage::InstructionSet &storage_;
+	ProcessorStorageConstructor(ProcessorStorage::InstructionSet &storage) : storage_(storage) {}
 
 	enum class AccessType {
 		Read, Write
@@ -103,9 +103,9 @@ struct CPU::WDC65816::ProcessorStorageConstructor {
 
 	void install_fetch_decode_execute() {
 		storage_.instructions[size_t(ProcessorStorage::OperationSlot::FetchDecodeExecute)].program_offsets[0] =
-		storage_.instructions[size_t(ProcessorStorage::OperationSlot::FetchDecodeExecute)].program_offsets[1] = uint16_t(storage_.micro_ops_.size());
-		storage_.micro_ops_.push_back(CycleFetchOpcode);
-		storage_.micro_ops_.push_back(OperationDecode);
+		storage_.instructions[size_t(ProcessorStorage::OperationSlot::FetchDecodeExecute)].program_offsets[1] = uint16_t(storage_.micro_ops.size());
+		storage_.micro_ops.push_back(CycleFetchOpcode);
+		storage_.micro_ops.push_back(OperationDecode);
 	}
 
 	private:
@@ -122,33 +122,33 @@ struct CPU::WDC65816::ProcessorStorageConstructor {
 		}
 
 		// Generate 8-bit steps.
-		const size_t micro_op_location_8 = storage_.micro_ops_.size();
+		const size_t micro_op_location_8 = storage_.micro_ops.size();
 		(*generator)(access_type, true, [this] (MicroOp op) {
-			this->storage_.micro_ops_.push_back(op);
+			this->storage_.micro_ops.push_back(op);
 		});
-		storage_.micro_ops_.push_back(OperationMoveToNextProgram);
+		storage_.micro_ops.push_back(OperationMoveToNextProgram);
 
 		// Generate 16-bit steps.
-		size_t micro_op_location_16 = storage_.micro_ops_.size();
+		size_t micro_op_location_16 = storage_.micro_ops.size();
 		(*generator)(access_type, false, [this] (MicroOp op) {
-			this->storage_.micro_ops_.push_back(op);
+			this->storage_.micro_ops.push_back(op);
 		});
-		storage_.micro_ops_.push_back(OperationMoveToNextProgram);
+		storage_.micro_ops.push_back(OperationMoveToNextProgram);
 
 		// Minor optimisation: elide the steps if 8- and 16-bit steps are equal.
 		bool are_equal = true;
 		size_t c = 0;
 		while(true) {
-			if(storage_.micro_ops_[micro_op_location_8 + c] != storage_.micro_ops_[micro_op_location_16 + c]) {
+			if(storage_.micro_ops[micro_op_location_8 + c] != storage_.micro_ops[micro_op_location_16 + c]) {
 				are_equal = false;
 				break;
 			}
-			if(storage_.micro_ops_[micro_op_location_8 + c] == OperationMoveToNextProgram) break;
+			if(storage_.micro_ops[micro_op_location_8 + c] == OperationMoveToNextProgram) break;
 			++c;
 		}
 
 		if(are_equal) {
-			storage_.micro_ops_.resize(micro_op_location_16);
+			storage_.micro_ops.resize(micro_op_location_16);
 			micro_op_location_16 = micro_op_location_8;
 		}
 
@@ -818,9 +818,8 @@ struct CPU::WDC65816::ProcessorStorageConstructor {
 	}
 };
 
-ProcessorStorage::ProcessorStorage() {
-	set_reset_state();
-	micro_ops_.reserve(1024);
+ProcessorStorage::InstructionSet::InstructionSet() {
+	micro_ops.reserve(1024);
 
 	ProcessorStorageConstructor constructor(*this);
 	using AccessMode = ProcessorStorageConstructor::AccessMode;
@@ -1104,12 +1103,21 @@ ProcessorStorage::ProcessorStorage() {
 	constructor.set_exception_generator(&ProcessorStorageConstructor::stack_exception, &ProcessorStorageConstructor::reset);
 	constructor.install_fetch_decode_execute();
 
+	// This is primarily to keep tabs, in case I want to pick a shorter form for the instruction table.
+	assert(micro_ops.size() < 1024);
+}
+
+ProcessorStorage::ProcessorStorage() {
+	// The instruction set is built only once, and then shared by all instances.
+	static const InstructionSet instruction_set;
+	instructions = instruction_set.instructions;
+	micro_ops_ = instruction_set.micro_ops.data();
+
+	set_reset_state();
+
 	// Find any OperationMoveToNextProgram.
-	next_op_ = micro_ops_.data();
+	next_op_ = micro_ops_;
 	while(*next_op_ != OperationMoveToNextProgram) ++next_op_;
-
-	// This is primarily to keep tabs, in case I want to pick a shorter form for the instruction table.
-	assert(micro_ops_.size() < 1024);
 }
 
 void ProcessorStorage::set_reset_state() {
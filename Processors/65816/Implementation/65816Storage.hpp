@@ -258,11 +258,20 @@ struct ProcessorStorage {
 		/// So the program to perform is that at @c program_offsets[mx_flags[size_field]] .
 		uint8_t size_field = 0;
 	};
-	Instruction instructions[256 + 3];	// Arranged as:
-										//	256 entries: instructions;
-										//	the entry for 'exceptions' (i.e. reset, irq, nmi);
-										//	a duplicate entry for the final part of exceptions if the selected exception is a reset; and
-										//	the entry for fetch-decode-execute.
+
+	/// Holds all micro-programs and the table of instructions that refer to them; a single instance
+	/// is shared by all processors.
+	struct InstructionSet {
+		InstructionSet();
+
+		Instruction instructions[256 + 3];	// Arranged as:
+											//	256 entries: instructions;
+											//	the entry for 'exceptions' (i.e. reset, irq, nmi);
+											//	a duplicate entry for the final part of exceptions if the selected exception is a reset; and
+											//	the entry for fetch-decode-execute.
+		std::vector<MicroOp> micro_ops;
+	};
+	const Instruction *instructions = nullptr;
 
 	enum class OperationSlot {
 		Exception = 256,
@@ -273,7 +282,7 @@ struct ProcessorStorage {
 	// A helper for testing.
 	uint16_t last_operation_pc_;
 	uint8_t last_operation_program_bank_;
-	Instruction *active_instruction_;
+	const Instruction *active_instruction_;
 	Cycles cycles_left_to_run_;
 
 	// All registers are boxed up into a struct so that they can be stored and restored in support of abort.
@@ -410,8 +419,8 @@ struct ProcessorStorage {
 	uint32_t data_address_increment_mask_ = 0xffff;
 	uint32_t incorrect_data_address_;
 
-	std::vector<MicroOp> micro_ops_;
-	MicroOp *next_op_ = nullptr;
+	const MicroOp *micro_ops_ = nullptr;
+	const MicroOp *next_op_ = nullptr;
 
 	void set_reset_state();
 	void set_emulation_mode(bool);
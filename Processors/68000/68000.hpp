@@ -401,6 +401,21 @@ class BusHandler {
 			Provides information about the path of execution if enabled via the template.
 		*/
 		void will_perform([[maybe_unused]] uint32_t address, [[maybe_unused]] uint16_t opcode) {}
+
+		/*!
+			If enabled via the template, is offered each read or write @c Microcycle before it occurs.
+
+			If the access is to memory with fixed timing — i.e. it would complete with no delay, without
+			VPA or BERR, and with no effect other than reading or writing the memory itself — this should
+			return the pointer that would be supplied to @c Microcycle::apply in order to perform it. The 68000
+			will then perform the access itself rather than calling @c perform_bus_operation.
+
+			Otherwise this should return @c nullptr.
+		*/
+		template <typename Microcycle>
+		uint8_t *fixed_timing_memory(const Microcycle &, [[maybe_unused]] int is_supervisor) {
+			return nullptr;
+		}
 };
 
 struct State {
@@ -414,6 +429,8 @@ struct State {
 
 namespace CPU::MC68000 {
 
+struct ProcessorState;
+
 /*!
 	Provides an emulation of the 68000 with accurate bus logic via the @c BusHandler, subject to the following template parameters:
 
@@ -435,8 +452,24 @@ namespace CPU::MC68000 {
 	@c signal_will_perform indicates whether the 68000 will call the bus handler's @c will_perform. Unlike the popular 8-bit CPUs,
 		the 68000 doesn't offer an indication of when instruction dispatch will occur so this is provided *for testing purposes*. It allows test cases
 		to track execution and inspect internal state in a wholly unrealistic fashion.
+
+	@c use_fixed_timing_memory indicates whether the 68000 will offer each read or write to the bus handler's @c fixed_timing_memory.
+		Accesses that it accepts, and all periods in which the bus is idle, are then not individually passed to @c perform_bus_operation;
+		the time they occupy is instead accumulated and posted as a single idle @c Microcycle before the next call to
+		@c perform_bus_operation, before the interrupt input is next sampled, or at the end of the current instruction, whichever is sooner.
+
+		Bus handlers therefore see time advance in larger steps but, since it is always posted before the interrupt input is sampled,
+		any change of interrupt level that they make in response is observed exactly as otherwise, and all other timing is unaffected.
+		This is a substantial saving for machines in which the bus handler does meaningful work per call, and in which a significant
+		proportion of accesses are to uncontended memory.
 */
-template <class BusHandler, bool dtack_is_implicit = true, bool permit_overrun = true, bool signal_will_perform = false>
+template <
+	class BusHandler,
+	bool dtack_is_implicit = true,
+	bool permit_overrun = true,
+	bool signal_will_perform = false,
+	bool use_fixed_timing_memory = false
+>
 class Processor: private ProcessorBase {
 	public:
 		Processor(BusHandler &bus_handler) : ProcessorBase(), bus_handler_(bus_handler) {}
@@ -493,6 +526,15 @@ class Processor: private ProcessorBase {
 
 	private:
 		BusHandler &bus_handler_;
+
+		/// If use_fixed_timing_memory is enabled and the bus handler indicates that @c perform is to fixed-timing
+		/// memory, performs it and accumulates the time it and @c announce would have occupied.
+		///
+		/// @returns @c true if the access was performed; @c false if it remains to be performed via the bus handler.
+		template <typename AnnounceT, typename PerformT>
+		bool perform_fixed_timing_access(const AnnounceT &announce, const PerformT &perform);
+
+		friend struct ProcessorState;
 };
 
 }
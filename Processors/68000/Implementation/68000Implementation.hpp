@@ -205,8 +205,8 @@ template <typename InstructionT> OperationT data_select(const InstructionT &inst
 #pragma GCC diagnostic ignored "-Wunused-label"
 #endif
 
-template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform>
-void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform>::run_for(HalfCycles duration) {
+template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory>::run_for(HalfCycles duration) {
 	// Accumulate the newly paid-in cycles. If this instance remains in deficit, exit.
 	e_clock_phase_ += duration;
 	time_remaining_ += duration;
@@ -219,8 +219,15 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	// Subtracts `n` half-cycles from `time_remaining_`; if permit_overrun is false, also ConsiderExit()
 #define Spend(n)		time_remaining_ -= (n); if constexpr (!permit_overrun) ConsiderExit()
 
-	// Performs ConsiderExit() only if permit_overrun is true.
-#define CheckOverrun()	if constexpr (permit_overrun) ConsiderExit()
+	// If permit_overrun is true, exits if all time has been expended, arranging to resume from
+	// the start of state x. So this may be used only where that is equivalent to resuming from
+	// here, but it guarantees that any exit is to a well-known state; see get_execution_state.
+	//
+	// Relative to a ConsiderExit() resume point this costs nothing in behaviour: run_for doesn't
+	// re-enter the state machine until time_remaining_ is non-negative, so the test repeated upon
+	// re-entry at the start of x always passes. Both uses are at or immediately before the top of
+	// the named state.
+#define CheckOverrun(x)	if constexpr (permit_overrun) { if(time_remaining_ < HalfCycles(0)) { state_ = ExecutionState::x; return; } }
 
 	// Moves directly to state x, which must be a compile-time constant.
 #define MoveToStateSpecific(x)	goto x;
@@ -279,19 +286,38 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	bus_error_ = v;									\
 	MoveToStateSpecific(BusOrAddressErrorException);
 
+	// Posts any time that has been accumulated rather than passed to the bus handler
+	// as a single idle microcycle. Any delay returned is spent immediately.
+#define FlushDeferredTime()																\
+	if constexpr (use_fixed_timing_memory) {											\
+		if(deferred_time_ > HalfCycles(0)) {											\
+			idle.length = deferred_time_;												\
+			deferred_time_ = HalfCycles(0);												\
+			time_remaining_ -= bus_handler_.perform_bus_operation(idle, is_supervisor_);	\
+		}																				\
+	}
+
 	// Performs the bus operation and then applies a `Spend` of its length
 	// plus any additional length returned by the bus handler.
 #define PerformBusOperation(x)										\
+	FlushDeferredTime();											\
 	delay = bus_handler_.perform_bus_operation(x, is_supervisor_);	\
 	Spend(x.length + delay)
 
 // TODO: the templated operation type to perform_bus_operation is intended to allow a much
 // cheaper through cost where the operation is knowable in advance. So use that pathway.
 
-	// Performs no bus activity for the specified number of microcycles.
-#define IdleBus(n)						\
-	idle.length = HalfCycles((n) << 2);	\
-	PerformBusOperation(idle)
+	// Performs no bus activity for the specified number of microcycles; if fixed-timing
+	// memory is in use then this time is accumulated rather than posted.
+#define IdleBus(n)															\
+	idle.length = HalfCycles((n) << 2);										\
+	if constexpr (use_fixed_timing_memory) {								\
+		deferred_time_ += idle.length;										\
+		delay = HalfCycles(0);												\
+	} else {																\
+		delay = bus_handler_.perform_bus_operation(idle, is_supervisor_);	\
+	}																		\
+	Spend(idle.length + delay)
 
 	// Spin until DTACK, VPA or BERR is asserted (unless DTACK is implicit),
 	// holding the bus cycle provided.
@@ -326,7 +352,8 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	PerformBusOperation(x)
 
 	// Performs the memory access implied by the announce, perform pair,
-	// honouring DTACK, BERR and VPA as necessary.
+	// honouring DTACK, BERR and VPA as necessary; accesses to fixed-timing
+	// memory are performed directly.
 #define AccessPair(val, announce, perform)								\
 	perform.value = &val;												\
 	if constexpr (!dtack_is_implicit) {									\
@@ -335,9 +362,13 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	if(*perform.address & (perform.operation >> 1) & 1) {				\
 		RaiseBusOrAddressError(AddressError, perform);					\
 	}																	\
-	PerformBusOperation(announce);										\
-	WaitForDTACK(announce);												\
-	CompleteAccess(perform);
+	if(perform_fixed_timing_access(announce, perform)) {				\
+		Spend(announce.length + HalfCycles(4));							\
+	} else {															\
+		PerformBusOperation(announce);									\
+		WaitForDTACK(announce);											\
+		CompleteAccess(perform);										\
+	}
 
 	// Sets up the next data access size and read flags.
 #define SetupDataAccess(read_flag, select_flag)												\
@@ -362,10 +393,13 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	program_counter_.l += 2;
 
 	// Reads one futher word from the program counter and inserts it into
-	// the prefetch queue.
+	// the prefetch queue, sampling the interrupt input. Any accumulated time
+	// is posted first so that the bus handler has had the chance to update
+	// the interrupt level exactly as if every access had been seen.
 #define Prefetch()										\
 	prefetch_.high = prefetch_.low;						\
 	ReadProgramWord(prefetch_.low)						\
+	FlushDeferredTime();								\
 	captured_interrupt_level_ = bus_interrupt_level_;
 
 	// Copies the current program counter, adjusted to allow for the prefetch queue,
@@ -405,12 +439,13 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 
 		BeginState(WaitForInterrupt):
 			// Spin in place until an interrupt arrives.
+			FlushDeferredTime();
 			captured_interrupt_level_ = bus_interrupt_level_;
 			if(status_.would_accept_interrupt(captured_interrupt_level_)) {
 				MoveToStateSpecific(DoInterrupt);
 			}
 			IdleBus(1);
-			CheckOverrun();
+			CheckOverrun(WaitForInterrupt);
 		MoveToStateSpecific(WaitForInterrupt);
 
 		// Perform the RESET exception, which seeds the stack pointer and program
@@ -515,6 +550,10 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 			// the same interleaved order as program counter and captured status register,
 			// which is the order that I know to be correct for a standard exception.
 
+			// Post any accumulated time now: an odd stack pointer will cause this exception to
+			// repeat without any access reaching the bus handler, which should nevertheless
+			// continue to see time passing.
+			FlushDeferredTime();
 			IdleBus(2);
 
 			// Switch to supervisor mode, disable interrupts.
@@ -652,7 +691,9 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 		// Inspect the prefetch queue in order to decode the next instruction,
 		// and segue into the fetching of operands.
 		BeginState(Decode):
-			CheckOverrun();
+			// Post any time accumulated during the previous instruction.
+			FlushDeferredTime();
+			CheckOverrun(Decode);
 
 			// Capture the address of the next instruction.
 			ReloadInstructionAddress();
@@ -2810,6 +2851,7 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 #undef WaitForDTACK
 #undef IdleBus
 #undef PerformBusOperation
+#undef FlushDeferredTime
 #undef MoveToStateSpecific
 #undef MoveToStateDynamic
 #undef CheckOverrun
@@ -3022,10 +3064,26 @@ inline void ProcessorBase::move_from_usp(uint32_t &address) {
 	address = stack_pointers_[0].l;
 }
 
+// MARK: - Fixed-timing memory.
+
+template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+template <typename AnnounceT, typename PerformT>
+bool Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory>::perform_fixed_timing_access(const AnnounceT &announce, const PerformT &perform) {
+	if constexpr (use_fixed_timing_memory) {
+		uint8_t *const target = bus_handler_.fixed_timing_memory(perform, is_supervisor_);
+		if(target) {
+			perform.apply(target);
+			deferred_time_ += announce.length + HalfCycles(4);
+			return true;
+		}
+	}
+	return false;
+}
+
 // MARK: - External state.
 
-template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform>
-CPU::MC68000::State Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform>::get_state() {
+template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+CPU::MC68000::State Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory>::get_state() {
 	CPU::MC68000::State state;
 
 	// This isn't true, but will ensure that both stack_pointers_ have their proper values.
@@ -3048,8 +3106,8 @@ CPU::MC68000::State Processor<BusHandler, dtack_is_implicit, permit_overrun, sig
 	return state;
 }
 
-template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform>
-void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform>::set_state(const CPU::MC68000::State &state) {
+template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory>::set_state(const CPU::MC68000::State &state) {
 	// Copy registers and the program counter.
 	for(int c = 0; c < 7; c++) {
 		registers_[c].l = state.registers.data[c];
@@ -3074,8 +3132,8 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	prefetch_.low.w = state.prefetch[1];
 }
 
-template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform>
-void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform>::decode_from_state(const InstructionSet::M68k::RegisterSet &registers) {
+template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory>::decode_from_state(const InstructionSet::M68k::RegisterSet &registers) {
 	// Populate registers.
 	CPU::MC68000::State state;
 	state.registers = registers;
@@ -3098,8 +3156,8 @@ void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perfor
 	program_counter_.l += 2;
 }
 
-template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform>
-void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform>::reset() {
+template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+void Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory>::reset() {
 	state_ = Reset;
 	time_remaining_ = HalfCycles(0);
 }
@@ -32,6 +32,10 @@ struct ProcessorBase: public InstructionSet::M68k::NullFlowController {
 	/// E clock phase.
 	HalfCycles e_clock_phase_;
 
+	/// Time that has elapsed but not yet been posted to the bus handler; this
+	/// can be non-zero only if fixed-timing memory is in use.
+	HalfCycles deferred_time_;
+
 	/// Current supervisor state, for direct provision to the bus handler.
 	int is_supervisor_ = 1;
 
@@ -0,0 +1,139 @@
+//
+//  State.cpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#include "State.hpp"
+
+using namespace CPU::MC68000;
+
+std::optional<ProcessorState> ProcessorState::capture(const ProcessorBase &src) {
+	switch(src.state_) {
+		case CPU::MC68000::ExecutionState::Reset:				return ProcessorState(src, ExecutionState::Phase::Reset);
+		case CPU::MC68000::ExecutionState::Decode:				return ProcessorState(src, ExecutionState::Phase::Decode);
+		case CPU::MC68000::ExecutionState::WaitForInterrupt:	return ProcessorState(src, ExecutionState::Phase::Stopped);
+
+		// Any other state is mid-instruction; that can't be captured.
+		default: return std::nullopt;
+	}
+}
+
+ProcessorState::ProcessorState(const ProcessorBase &src, ExecutionState::Phase phase): ProcessorState() {
+	// Registers.
+	for(int c = 0; c < 7; c++) {
+		registers.data[c] = src.registers_[c].l;
+		registers.address[c] = src.registers_[c + 8].l;
+	}
+	registers.data[7] = src.registers_[7].l;
+
+	// A7 is whichever of the stack pointers is currently active; the other
+	// has been stashed.
+	registers.user_stack_pointer = src.is_supervisor_ ? src.stack_pointers_[0].l : src.registers_[15].l;
+	registers.supervisor_stack_pointer = src.is_supervisor_ ? src.registers_[15].l : src.stack_pointers_[1].l;
+
+	registers.status = src.status_.status();
+	registers.program_counter = src.program_counter_.l;
+	registers.prefetch[0] = src.prefetch_.high.w;
+	registers.prefetch[1] = src.prefetch_.low.w;
+
+	// Inputs.
+	inputs.bus_interrupt_level = src.bus_interrupt_level_;
+	inputs.dtack = src.dtack_;
+	inputs.vpa = src.vpa_;
+	inputs.berr = src.berr_;
+
+	// Execution state.
+	execution_state.phase = phase;
+	execution_state.captured_interrupt_level = src.captured_interrupt_level_;
+	execution_state.should_trace = src.should_trace_;
+	execution_state.instruction_address = src.instruction_address_.l;
+	execution_state.time_remaining = src.time_remaining_.as_integral();
+	execution_state.e_clock_phase = src.e_clock_phase_.as_integral();
+	execution_state.deferred_time = src.deferred_time_.as_integral();
+}
+
+void ProcessorState::apply(ProcessorBase &target) const {
+	// Registers.
+	for(int c = 0; c < 7; c++) {
+		target.registers_[c].l = registers.data[c];
+		target.registers_[c + 8].l = registers.address[c];
+	}
+	target.registers_[7].l = registers.data[7];
+	target.program_counter_.l = registers.program_counter;
+
+	// Set status first in order to get the proper is-supervisor flag in place, then
+	// update the stack pointers, being careful to copy the right one.
+	target.status_.set_status(registers.status);
+	target.stack_pointers_[0].l = registers.user_stack_pointer;
+	target.stack_pointers_[1].l = registers.supervisor_stack_pointer;
+	target.registers_[15] = target.stack_pointers_[target.is_supervisor_];
+	target.did_update_status();
+
+	target.prefetch_.high.w = registers.prefetch[0];
+	target.prefetch_.low.w = registers.prefetch[1];
+
+	// Inputs.
+	target.bus_interrupt_level_ = inputs.bus_interrupt_level;
+	target.dtack_ = inputs.dtack;
+	target.vpa_ = inputs.vpa;
+	target.berr_ = inputs.berr;
+
+	// Execution state.
+	switch(execution_state.phase) {
+		case ExecutionState::Phase::Reset:		target.state_ = CPU::MC68000::ExecutionState::Reset;				break;
+		case ExecutionState::Phase::Decode:		target.state_ = CPU::MC68000::ExecutionState::Decode;				break;
+		case ExecutionState::Phase::Stopped:	target.state_ = CPU::MC68000::ExecutionState::WaitForInterrupt;	break;
+	}
+	target.captured_interrupt_level_ = execution_state.captured_interrupt_level;
+	target.should_trace_ = execution_state.should_trace;
+	target.instruction_address_.l = execution_state.instruction_address;
+	target.time_remaining_ = HalfCycles(execution_state.time_remaining);
+	target.e_clock_phase_ = HalfCycles(execution_state.e_clock_phase);
+	target.deferred_time_ = HalfCycles(execution_state.deferred_time);
+}
+
+// Boilerplate follows here, to establish 'reflection'.
+ProcessorState::ProcessorState() {
+	if(needs_declare()) {
+		DeclareField(registers);
+		DeclareField(inputs);
+		DeclareField(execution_state);
+	}
+}
+
+ProcessorState::Registers::Registers() {
+	if(needs_declare()) {
+		DeclareField(data);
+		DeclareField(address);
+		DeclareField(user_stack_pointer);
+		DeclareField(supervisor_stack_pointer);
+		DeclareField(status);
+		DeclareField(program_counter);
+		DeclareField(prefetch);
+	}
+}
+
+ProcessorState::Inputs::Inputs() {
+	if(needs_declare()) {
+		DeclareField(bus_interrupt_level);
+		DeclareField(dtack);
+		DeclareField(vpa);
+		DeclareField(berr);
+	}
+}
+
+ProcessorState::ExecutionState::ExecutionState() {
+	if(needs_declare()) {
+		AnnounceEnum(Phase);
+		DeclareField(phase);
+		DeclareField(captured_interrupt_level);
+		DeclareField(should_trace);
+		DeclareField(instruction_address);
+		DeclareField(time_remaining);
+		DeclareField(e_clock_phase);
+		DeclareField(deferred_time);
+	}
+}
@@ -0,0 +1,113 @@
+//
+//  State.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright © 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "../../../Reflection/Enum.hpp"
+#include "../../../Reflection/Struct.hpp"
+#include "../68000.hpp"
+
+#include <optional>
+
+namespace CPU::MC68000 {
+
+/*!
+	Provides a means for capturing or restoring complete 68000 state, as a reflective
+	counterpart to @c CPU::MC68000::State.
+
+	Only those parts of state that persist from one instruction to the next are captured,
+	so the processor must be between instructions; @c capture declines to produce a state
+	otherwise.
+
+	This is an optional adjunct to the 68000 class. If you want to take the rest of the 68000
+	implementation but don't want any of the overhead of my sort-of half-reflection as
+	encapsulated in Reflection/[Enum/Struct].hpp just don't use this class.
+*/
+struct ProcessorState: public Reflection::StructImpl<ProcessorState> {
+	/*!
+		Provides the current state of the well-known, published internal registers,
+		plus the prefetch queue.
+	*/
+	struct Registers: public Reflection::StructImpl<Registers> {
+		uint32_t data[8];
+		uint32_t address[7];
+		uint32_t user_stack_pointer;
+		uint32_t supervisor_stack_pointer;
+		uint16_t status;
+		uint32_t program_counter;
+		uint16_t prefetch[2];
+
+		Registers();
+	} registers;
+
+	/*!
+		Provides the current state of the processor's various input lines that aren't
+		related to an access cycle.
+	*/
+	struct Inputs: public Reflection::StructImpl<Inputs> {
+		int bus_interrupt_level = 0;
+		bool dtack = false;
+		bool vpa = false;
+		bool berr = false;
+
+		Inputs();
+	} inputs;
+
+	/*!
+		Contains internal state used by this particular implementation of a 68000 between
+		instructions.
+	*/
+	struct ExecutionState: public Reflection::StructImpl<ExecutionState> {
+		ReflectableEnum(Phase,
+			Reset, Decode, Stopped
+		);
+
+		/// Indicates whether the processor is yet to reset, is about to decode an instruction,
+		/// or is stopped awaiting an interrupt.
+		Phase phase = Phase::Reset;
+
+		int captured_interrupt_level = 0;
+		bool should_trace = false;
+		uint32_t instruction_address = 0;
+
+		// These are measured in half cycles.
+		int64_t time_remaining = 0;
+		int64_t e_clock_phase = 0;
+
+		/// Time spent on fixed-timing memory accesses that is yet to be posted to the bus handler.
+		int64_t deferred_time = 0;
+
+		ExecutionState();
+	} execution_state;
+
+	/// Default constructor; makes no guarantees as to field values beyond those given above.
+	ProcessorState();
+
+	/*!
+		Captures the state of the processor @c src.
+
+		@returns The captured state, or an empty optional if @c src is mid-instruction.
+	*/
+	template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+	static std::optional<ProcessorState> capture(const Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory> &src) {
+		return capture(static_cast<const ProcessorBase &>(src));
+	}
+
+	/// Applies this state to @c target.
+	template <class BusHandler, bool dtack_is_implicit, bool permit_overrun, bool signal_will_perform, bool use_fixed_timing_memory>
+	void apply(Processor<BusHandler, dtack_is_implicit, permit_overrun, signal_will_perform, use_fixed_timing_memory> &target) const {
+		apply(static_cast<ProcessorBase &>(target));
+	}
+
+	private:
+		static std::optional<ProcessorState> capture(const ProcessorBase &src);
+		ProcessorState(const ProcessorBase &src, ExecutionState::Phase phase);
+		void apply(ProcessorBase &target) const;
+};
+
+}
@@ -11,7 +11,7 @@ template <	class T,
 			bool uses_wait_line> Processor <T, uses_bus_request, uses_wait_line>
 				::Processor(T &bus_handler) :
 					bus_handler_(bus_handler) {
-	install_default_instruction_set();
+	install_default_instruction_set(uses_wait_line);
 }
 
 template <	class T,
@@ -925,87 +925,6 @@ template <	class T,
 	return wait_line_;
 }
 
-template <	class T,
-			bool uses_bus_request,
-			bool uses_wait_line> void Processor <T, uses_bus_request, uses_wait_line>
-				::assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets) {
-	std::size_t number_of_micro_ops = 0;
-	std::size_t lengths[256];
-
-	// Count number of micro-ops required.
-	for(int c = 0; c < 256; c++) {
-		std::size_t length = 0;
-		while(!is_terminal(table[c][length].type)) length++;
-		length++;
-		lengths[c] = length;
-		number_of_micro_ops += length;
-	}
-
-	// Allocate a landing area.
-	std::vector<std::size_t> operation_indices;
-	target.all_operations.reserve(number_of_micro_ops);
-	target.instructions.resize(256, nullptr);
-
-	// Copy in all programs, recording where they go.
-	for(std::size_t c = 0; c < 256; c++) {
-		operation_indices.push_back(target.all_operations.size());
-		for(std::size_t t = 0; t < lengths[c];) {
-			// Skip zero-length bus cycles.
-			if(table[c][t].type == MicroOp::BusOperation && table[c][t].machine_cycle.length.as_integral() == 0) {
-				t++;
-				continue;
-			}
-
-			// Skip optional waits if this instance doesn't use the wait line.
-			if(table[c][t].machine_cycle.was_requested && !uses_wait_line) {
-				t++;
-				continue;
-			}
-
-			// If an index placeholder is hit then drop it, and if offsets aren't being added,
-			// then also drop the indexing that follows, which is assumed to be everything
-			// up to and including the next ::CalculateIndexAddress. Coupled to the INDEX() macro.
-			if(table[c][t].type == MicroOp::IndexedPlaceHolder) {
-				t++;
-				if(!add_offsets) {
-					while(table[c][t].type != MicroOp::CalculateIndexAddress) t++;
-					t++;
-				}
-			}
-			target.all_operations.emplace_back(table[c][t]);
-			t++;
-		}
-	}
-
-	// Since the vector won't change again, it's now safe to set pointers.
-	std::size_t c = 0;
-	for(std::size_t index : operation_indices) {
-		target.instructions[c] = &target.all_operations[index];
-		c++;
-	}
-}
-
-template <	class T,
-			bool uses_bus_request,
-			bool uses_wait_line> void Processor <T, uses_bus_request, uses_wait_line>
-		::copy_program(const MicroOp *source, std::vector<MicroOp> &destination) {
-	std::size_t length = 0;
-	while(!is_terminal(source[length].type)) length++;
-	std::size_t pointer = 0;
-	while(true) {
-		// TODO: This test is duplicated from assemble_page; can a better factoring be found?
-		// Skip optional waits if this instance doesn't use the wait line.
-		if(source[pointer].machine_cycle.was_requested && !uses_wait_line) {
-			pointer++;
-			continue;
-		}
-
-		destination.emplace_back(source[pointer]);
-		if(is_terminal(source[pointer].type)) break;
-		pointer++;
-	}
-}
-
 bool ProcessorBase::get_halt_line() const {
 	return halt_mask_ == 0x00;
 }
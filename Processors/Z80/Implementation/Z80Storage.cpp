@@ -7,6 +7,8 @@
 //
 
 #include "../Z80.hpp"
+
+#include <array>
 #include <cstring>
 
 using namespace CPU::Z80;
@@ -15,6 +17,116 @@ ProcessorStorage::ProcessorStorage() {
 	set_flags(0xff);
 }
 
+/// An otherwise-inert processor that holds an assembled instruction set, for copying by real processors.
+struct ProcessorStorage::InstructionSetPrototype: public ProcessorStorage {
+	InstructionSetPrototype(bool uses_wait_line) {
+		uses_wait_line_ = uses_wait_line;
+		assemble_instruction_set();
+	}
+};
+
+void ProcessorStorage::install_default_instruction_set(bool uses_wait_line) {
+	if(uses_wait_line) {
+		static const InstructionSetPrototype prototype(true);
+		copy_instruction_set(prototype);
+	} else {
+		static const InstructionSetPrototype prototype(false);
+		copy_instruction_set(prototype);
+	}
+}
+
+void ProcessorStorage::copy_instruction_set(const ProcessorStorage &prototype) {
+	const auto instruction_pages = [](auto &storage) {
+		return std::array{
+			&storage.base_page_,	&storage.ed_page_,		&storage.fd_page_,		&storage.dd_page_,
+			&storage.cb_page_,		&storage.fdcb_page_,	&storage.ddcb_page_,
+		};
+	};
+	const auto programs = [](auto &storage) {
+		return std::array{
+			&storage.conditional_call_untaken_program_,
+			&storage.reset_program_,
+			&storage.irq_program_[0],	&storage.irq_program_[1],	&storage.irq_program_[2],
+			&storage.nmi_program_,
+			&storage.base_page_.all_operations,	&storage.base_page_.fetch_decode_execute,
+			&storage.ed_page_.all_operations,	&storage.ed_page_.fetch_decode_execute,
+			&storage.fd_page_.all_operations,	&storage.fd_page_.fetch_decode_execute,
+			&storage.dd_page_.all_operations,	&storage.dd_page_.fetch_decode_execute,
+			&storage.cb_page_.all_operations,	&storage.cb_page_.fetch_decode_execute,
+			&storage.fdcb_page_.all_operations,	&storage.fdcb_page_.fetch_decode_execute,
+			&storage.ddcb_page_.all_operations,	&storage.ddcb_page_.fetch_decode_execute,
+		};
+	};
+
+	// Micro-ops may point into the prototype itself, e.g. to a register or to an instruction page,
+	// or into any of its programs. Establish where each of those regions now lives.
+	struct Region {
+		uintptr_t begin, end;
+		uint8_t *target;
+	};
+	const auto region = [](const void *begin, size_t size, void *target) {
+		const auto start = reinterpret_cast<uintptr_t>(begin);
+		return Region{start, start + size, static_cast<uint8_t *>(target)};
+	};
+
+	const auto sources = programs(prototype);
+	const auto destinations = programs(*this);
+	std::array<Region, sources.size() + 1> regions;
+	regions[0] = region(&prototype, sizeof(ProcessorStorage), this);
+	for(size_t c = 0; c < sources.size(); c++) {
+		// Reserve now so that no further reallocation will occur.
+		destinations[c]->reserve(sources[c]->size());
+		regions[c + 1] = region(sources[c]->data(), sources[c]->size() * sizeof(MicroOp), destinations[c]->data());
+	}
+
+	const auto relocate = [&](const void *pointer) {
+		if(!pointer) {
+			return static_cast<uint8_t *>(nullptr);
+		}
+
+		const auto address = reinterpret_cast<uintptr_t>(pointer);
+		for(const auto &region: regions) {
+			if(address >= region.begin && address < region.end) {
+				return region.target + (address - region.begin);
+			}
+		}
+		return static_cast<uint8_t *>(const_cast<void *>(pointer));
+	};
+
+	// Copy all programs.
+	for(size_t c = 0; c < sources.size(); c++) {
+		for(const auto &source: *sources[c]) {
+			destinations[c]->push_back({
+				source.type,
+				relocate(source.source),
+				relocate(source.destination),
+				PartialMachineCycle(
+					source.machine_cycle.operation,
+					source.machine_cycle.length,
+					reinterpret_cast<uint16_t *>(relocate(source.machine_cycle.address)),
+					relocate(source.machine_cycle.value),
+					source.machine_cycle.was_requested
+				)
+			});
+		}
+	}
+
+	// Complete the instruction pages.
+	const auto source_pages = instruction_pages(prototype);
+	const auto destination_pages = instruction_pages(*this);
+	for(size_t c = 0; c < source_pages.size(); c++) {
+		auto &destination = *destination_pages[c];
+		const auto &source = *source_pages[c];
+
+		destination.instructions.resize(source.instructions.size());
+		for(size_t instruction = 0; instruction < source.instructions.size(); instruction++) {
+			destination.instructions[instruction] = reinterpret_cast<MicroOp *>(relocate(source.instructions[instruction]));
+		}
+		destination.fetch_decode_execute_data = reinterpret_cast<MicroOp *>(relocate(source.fetch_decode_execute_data));
+		destination.is_indexed = source.is_indexed;
+	}
+}
+
 // Elemental bus operations
 #define ReadOpcodeStart()			PartialMachineCycle(PartialMachineCycle::ReadOpcodeStart, HalfCycles(3), &pc_.full, &operation_, false)
 #define ReadOpcodeWait(f)			PartialMachineCycle(PartialMachineCycle::ReadOpcodeWait, HalfCycles(2), &pc_.full, &operation_, f)
@@ -144,7 +256,7 @@ ProcessorStorage::ProcessorStorage() {
 #define ADC16(d, s) Sequence(InternalOperation(8), InternalOperation(6), {MicroOp::ADC16, &s.full, &d.full})
 #define SBC16(d, s) Sequence(InternalOperation(8), InternalOperation(6), {MicroOp::SBC16, &s.full, &d.full})
 
-void ProcessorStorage::install_default_instruction_set() {
+void ProcessorStorage::assemble_instruction_set() {
 	MicroOp conditional_call_untaken_program[] = Sequence(ReadInc(pc_, memptr_.halves.high));
 	copy_program(conditional_call_untaken_program, conditional_call_untaken_program_);
 
@@ -529,6 +641,81 @@ void ProcessorStorage::assemble_fetch_decode_execute(InstructionPage &target, in
 	target.fetch_decode_execute_data = target.fetch_decode_execute.data();
 }
 
+void ProcessorStorage::assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets) {
+	std::size_t number_of_micro_ops = 0;
+	std::size_t lengths[256];
+
+	// Count number of micro-ops required.
+	for(int c = 0; c < 256; c++) {
+		std::size_t length = 0;
+		while(!is_terminal(table[c][length].type)) length++;
+		length++;
+		lengths[c] = length;
+		number_of_micro_ops += length;
+	}
+
+	// Allocate a landing area.
+	std::vector<std::size_t> operation_indices;
+	target.all_operations.reserve(number_of_micro_ops);
+	target.instructions.resize(256, nullptr);
+
+	// Copy in all programs, recording where they go.
+	for(std::size_t c = 0; c < 256; c++) {
+		operation_indices.push_back(target.all_operations.size());
+		for(std::size_t t = 0; t < lengths[c];) {
+			// Skip zero-length bus cycles.
+			if(table[c][t].type == MicroOp::BusOperation && table[c][t].machine_cycle.length.as_integral() == 0) {
+				t++;
+				continue;
+			}
+
+			// Skip optional waits if this instance doesn't use the wait line.
+			if(table[c][t].machine_cycle.was_requested && !uses_wait_line_) {
+				t++;
+				continue;
+			}
+
+			// If an index placeholder is hit then drop it, and if offsets aren't being added,
+			// then also drop the indexing that follows, which is assumed to be everything
+			// up to and including the next ::CalculateIndexAddress. Coupled to the INDEX() macro.
+			if(table[c][t].type == MicroOp::IndexedPlaceHolder) {
+				t++;
+				if(!add_offsets) {
+					while(table[c][t].type != MicroOp::CalculateIndexAddress) t++;
+					t++;
+				}
+			}
+			target.all_operations.emplace_back(table[c][t]);
+			t++;
+		}
+	}
+
+	// Since the vector won't change again, it's now safe to set pointers.
+	std::size_t c = 0;
+	for(std::size_t index : operation_indices) {
+		target.instructions[c] = &target.all_operations[index];
+		c++;
+	}
+}
+
+void ProcessorStorage::copy_program(const MicroOp *source, std::vector<MicroOp> &destination) {
+	std::size_t length = 0;
+	while(!is_terminal(source[length].type)) length++;
+	std::size_t pointer = 0;
+	while(true) {
+		// TODO: This test is duplicated from assemble_page; can a better factoring be found?
+		// Skip optional waits if this instance doesn't use the wait line.
+		if(source[pointer].machine_cycle.was_requested && !uses_wait_line_) {
+			pointer++;
+			continue;
+		}
+
+		destination.emplace_back(source[pointer]);
+		if(is_terminal(source[pointer].type)) break;
+		pointer++;
+	}
+}
+
 bool ProcessorBase::is_starting_new_instruction() const {
 	return
 		current_instruction_page_ == &base_page_ &&
@@ -128,7 +128,13 @@ class ProcessorStorage {
 		};
 
 		ProcessorStorage();
-		void install_default_instruction_set();
+
+		/*!
+			Populates all instruction pages and programs. The instruction set is assembled only once per process
+			for each value of @c uses_wait_line; each subsequent installation copies that assembly, relocating
+			its pointers to refer to this instance.
+		*/
+		void install_default_instruction_set(bool uses_wait_line);
 
 		uint8_t a_;
 		RegisterPair16 bc_, de_, hl_;
@@ -224,9 +230,14 @@ class ProcessorStorage {
 		}
 
 		typedef MicroOp InstructionTable[256][30];
-		virtual void assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets) = 0;
-		virtual void copy_program(const MicroOp *source, std::vector<MicroOp> &destination) = 0;
+		void assemble_page(InstructionPage &target, InstructionTable &table, bool add_offsets);
+		void copy_program(const MicroOp *source, std::vector<MicroOp> &destination);
+
+		struct InstructionSetPrototype;
+		bool uses_wait_line_ = false;	// Consulted only during assembly of the instruction set.
 
+		void assemble_instruction_set();
+		void copy_instruction_set(const ProcessorStorage &prototype);
 		void assemble_fetch_decode_execute(InstructionPage &target, int length);
 		void assemble_ed_page(InstructionPage &target);
 		void assemble_cb_page(InstructionPage &target, RegisterPair16 &index, bool add_offsets);
@@ -239,6 +239,17 @@ std::string Reflection::Struct::description() const {
 
 /* Contractually, this serialises as BSON. */
 std::vector<uint8_t> Reflection::Struct::serialise() const {
+	std::vector<uint8_t> result;
+	serialise(result);
+	return result;
+}
+
+void Reflection::Struct::serialise(std::vector<uint8_t> &bson) const {
+	bson.clear();
+	append_document(bson);
+}
+
+void Reflection::Struct::append_document(std::vector<uint8_t> &result) const {
 	auto push_name = [] (std::vector<uint8_t> &result, const std::string &name) {
 		std::copy(name.begin(), name.end(), std::back_inserter(result));
 		result.push_back(0);
@@ -278,7 +289,7 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 		if(!Reflection::Enum::name(*type).empty()) {
 			int value;
 			Reflection::get(*this, key, value, offset);
-			const auto text = Reflection::Enum::to_string(*type, 0);
+			const auto text = Reflection::Enum::to_string(*type, value);
 			push_string(text);
 			return;
 		}
@@ -337,7 +348,7 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 			auto source = reinterpret_cast<const std::vector<uint8_t> *>(get(key));
 			push_int(uint32_t(source->size()));
 			result.push_back(0x00);
-			std::copy(source->begin(), source->end(), std::back_inserter(result));
+			result.insert(result.end(), source->begin(), source->end());
 			return;
 		}
 
@@ -348,8 +359,7 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 			push_name(result, output_name);
 
 			const Reflection::Struct *const child = reinterpret_cast<const Reflection::Struct *>(get(key));
-			const auto sub_document = child->serialise();
-			std::copy(sub_document.begin(), sub_document.end(), std::back_inserter(result));
+			child->append_document(result);
 			return;
 		}
 
@@ -358,20 +368,26 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 		assert(false);
 	};
 
-	auto wrap_object = [] (std::vector<uint8_t> &data) {
-		/*
-			document ::= int32 e_list "\x00"
-			The int32 is the total number of bytes comprising the document.
-		*/
+	/*
+		document ::= int32 e_list "\x00"
+		The int32 is the total number of bytes comprising the document; space
+		is reserved for it upfront and it is filled in once the document is complete.
+	*/
+	auto begin_object = [] (std::vector<uint8_t> &data) {
+		const size_t start = data.size();
+		data.resize(start + 4);
+		return start;
+	};
+	auto end_object = [] (std::vector<uint8_t> &data, size_t start) {
 		data.push_back(0);
-		const uint32_t size_with_prefix = uint32_t(data.size()) + 4;
-		data.insert(data.begin(), uint8_t(size_with_prefix >> 24));
-		data.insert(data.begin(), uint8_t(size_with_prefix >> 16));
-		data.insert(data.begin(), uint8_t(size_with_prefix >> 8));
-		data.insert(data.begin(), uint8_t(size_with_prefix & 0xff));
+		const uint32_t size_with_prefix = uint32_t(data.size() - start);
+		data[start + 0] = uint8_t(size_with_prefix & 0xff);
+		data[start + 1] = uint8_t(size_with_prefix >> 8);
+		data[start + 2] = uint8_t(size_with_prefix >> 16);
+		data[start + 3] = uint8_t(size_with_prefix >> 24);
 	};
 
-	std::vector<uint8_t> result;
+	const size_t document = begin_object(result);
 
 	for(const auto &key: all_keys()) {
 		if(!should_serialise(key)) continue;
@@ -385,20 +401,17 @@ std::vector<uint8_t> Reflection::Struct::serialise() const {
 			result.push_back(0x04);
 			push_name(result, key);
 
-			std::vector<uint8_t> array;
+			const size_t array = begin_object(result);
 			for(size_t c = 0; c < count; ++c) {
-				append(array, key, std::to_string(c), type, c);
+				append(result, key, std::to_string(c), type, c);
 			}
-			wrap_object(array);
-
-			std::copy(array.begin(), array.end(), std::back_inserter(result));
+			end_object(result, array);
 		} else {
 			append(result, key, key, type, 0);
 		}
 	}
 
-	wrap_object(result);
-	return result;
+	end_object(result, document);
 }
 
 bool Reflection::Struct::deserialise(const std::vector<uint8_t> &bson) {
@@ -448,13 +461,14 @@ bool Reflection::Struct::deserialise(const uint8_t *bson, size_t size) {
 	// Validate the object's declared size.
 	const auto end = bson + size;
 	auto read_int = [&bson] (auto &target) {
-		constexpr auto shift = 8 * (sizeof(target) - 1);
-		target = 0;
+		// Assemble in an unsigned type, to avoid sign extension of intermediate results.
+		using IntT = std::remove_reference_t<decltype(target)>;
+		std::make_unsigned_t<IntT> result = 0;
 		for(size_t c = 0; c < sizeof(target); ++c) {
-			target >>= 8;
-			target |= decltype(target)(*bson) << shift;
+			result |= decltype(result)(*bson) << (8 * c);
 			++bson;
 		}
+		target = IntT(result);
 	};
 
 	uint32_t object_size;
@@ -487,15 +501,22 @@ bool Reflection::Struct::deserialise(const uint8_t *bson, size_t size) {
 				uint32_t subobject_size;
 				read_int(subobject_size);
 
-				if(next_type == 0x03 && *type == typeid(Reflection::Struct)) {
-					auto child = reinterpret_cast<Reflection::Struct *>(get(key));
-					child->deserialise(bson - 4, size_t(end - bson + 4));
+				if(next_type == 0x03) {
+					if(type && *type == typeid(Reflection::Struct)) {
+						auto child = reinterpret_cast<Reflection::Struct *>(get(key));
+						child->deserialise(bson - 4, size_t(end - bson + 4));
+					}
 					bson += subobject_size - 4;
 				}
 
-				if(next_type == 0x05 && *type == typeid(std::vector<uint8_t>)) {
-					auto child = reinterpret_cast<std::vector<uint8_t> *>(get(key));
-					*child = std::vector<uint8_t>(bson, bson + subobject_size);
+				if(next_type == 0x05) {
+					// Skip the binary subtype.
+					++bson;
+
+					if(type && *type == typeid(std::vector<uint8_t>)) {
+						auto child = reinterpret_cast<std::vector<uint8_t> *>(get(key));
+						*child = std::vector<uint8_t>(bson, bson + subobject_size);
+					}
 					bson += subobject_size;
 				}
 			} break;
@@ -64,6 +64,11 @@ struct Struct {
 	*/
 	std::vector<uint8_t> serialise() const;
 
+	/*!
+		Serialises as per the above into @c bson, replacing its contents but reusing its storage.
+	*/
+	void serialise(std::vector<uint8_t> &bson) const;
+
 	/*!
 		Applies as many fields as possible from the incoming BSON. Supports the same types
 		as @c serialise.
@@ -77,6 +82,7 @@ struct Struct {
 
 	private:
 		void append(std::ostringstream &stream, const std::string &key, const std::type_info *type, size_t offset) const;
+		void append_document(std::vector<uint8_t> &) const;
 		bool deserialise(const uint8_t *bson, size_t size);
 };
 
@@ -51,7 +51,7 @@ float FIRFilter::ino(float a) {
 	return s;
 }
 
-void FIRFilter::coefficients_for_idealised_filter_response(short *filter_coefficients, float *A, float attenuation, std::size_t number_of_taps) {
+std::vector<float> FIRFilter::coefficients_for_idealised_filter_response(const float *A, float attenuation, std::size_t number_of_taps) {
 	/* calculate alpha, which is the Kaiser-Bessel window shape factor */
 	float a;	// to take the place of alpha in the normal derivation
 
@@ -82,17 +82,7 @@ void FIRFilter::coefficients_for_idealised_filter_response(short *filter_coeffic
 		filter_coefficients_float[i] = filter_coefficients_float[number_of_taps - 1 - i];
 	}
 
-	/* scale back up so that we retain 100% of input volume */
-	float coefficientTotal = 0.0f;
-	for(std::size_t i = 0; i < number_of_taps; ++i) {
-		coefficientTotal += filter_coefficients_float[i];
-	}
-
-	/* we'll also need integer versions, potentially */
-	float coefficientMultiplier = 1.0f / coefficientTotal;
-	for(std::size_t i = 0; i < number_of_taps; ++i) {
-		filter_coefficients[i] = short(filter_coefficients_float[i] * FixedMultiplier * coefficientMultiplier);
-	}
+	return filter_coefficients_float;
 }
 
 std::vector<float> FIRFilter::get_coefficients() const {
@@ -104,6 +94,23 @@ std::vector<float> FIRFilter::get_coefficients() const {
 }
 
 FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation) {
+	const auto coefficients = FIRFilter::coefficients(number_of_taps, input_sample_rate, low_frequency, high_frequency, attenuation);
+
+	/* scale back up so that we retain 100% of input volume */
+	float coefficientTotal = 0.0f;
+	for(const auto coefficient: coefficients) {
+		coefficientTotal += coefficient;
+	}
+
+	/* we'll also need integer versions, potentially */
+	float coefficientMultiplier = 1.0f / coefficientTotal;
+	filter_coefficients_.resize(coefficients.size());
+	for(std::size_t i = 0; i < coefficients.size(); ++i) {
+		filter_coefficients_[i] = short(coefficients[i] * FixedMultiplier * coefficientMultiplier);
+	}
+}
+
+std::vector<float> FIRFilter::coefficients(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation) {
 	// we must be asked to filter based on an odd number of
 	// taps, and at least three
 	if(number_of_taps < 3) number_of_taps = 3;
@@ -112,9 +119,6 @@ FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float
 	// ensure we have an odd number of taps
 	number_of_taps |= 1;
 
-	// store instance variables
-	filter_coefficients_.resize(number_of_taps);
-
 	/* calculate idealised filter response */
 	std::size_t Np = (number_of_taps - 1) / 2;
 	float two_over_sample_rate = 2.0f / input_sample_rate;
@@ -133,7 +137,7 @@ FIRFilter::FIRFilter(std::size_t number_of_taps, float input_sample_rate, float
 			) / i_pi;
 	}
 
-	FIRFilter::coefficients_for_idealised_filter_response(filter_coefficients_.data(), A.data(), attenuation, number_of_taps);
+	return FIRFilter::coefficients_for_idealised_filter_response(A.data(), attenuation, number_of_taps);
 }
 
 FIRFilter::FIRFilter(const std::vector<float> &coefficients) {
@@ -47,6 +47,12 @@ class FIRFilter {
 		FIRFilter(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation = DefaultAttenuation);
 		FIRFilter(const std::vector<float> &coefficients);
 
+		/*!
+			@returns The coefficients that a filter constructed with the same arguments would use, prior to
+			normalisation and conversion to fixed point. So their sum is not necessarily 1.
+		*/
+		static std::vector<float> coefficients(std::size_t number_of_taps, float input_sample_rate, float low_frequency, float high_frequency, float attenuation = DefaultAttenuation);
+
 		/*!
 			Applies the filter to one batch of input samples, returning the net result.
 
@@ -95,7 +101,7 @@ class FIRFilter {
 	private:
 		std::vector<short> filter_coefficients_;
 
-		static void coefficients_for_idealised_filter_response(short *filterCoefficients, float *A, float attenuation, std::size_t numberOfTaps);
+		static std::vector<float> coefficients_for_idealised_filter_response(const float *A, float attenuation, std::size_t numberOfTaps);
 		static float ino(float a);
 };
 
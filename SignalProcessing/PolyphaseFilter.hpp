@@ -0,0 +1,192 @@
+//
+//  PolyphaseFilter.hpp
+//  Clock Signal
+//
+//  Created by Thomas Harte on 16/10/2026.
+//  Copyright 2026 Thomas Harte. All rights reserved.
+//
+
+#pragma once
+
+#include "FIRFilter.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace SignalProcessing {
+
+/*!
+	A polyphase filter is a bank of FIR filters that share a single low-pass response but each of which samples
+	its input at a different fractional offset between input samples. It therefore permits resampling by arbitrary
+	ratios — both up and down — without rounding output positions to the nearest input sample.
+
+	Input is either mono or interleaved stereo. Coefficients are stored in 1.15 fixed point and each phase is
+	padded with zeroes to a multiple of @c Padding samples so that the vector kernels need no tail handling;
+	callers must ensure that the @c Padding samples following any window are also safe to read.
+*/
+template <bool is_stereo> class PolyphaseFilter {
+	public:
+		static constexpr size_t Channels = is_stereo + 1;
+		static constexpr size_t Padding = 16;
+
+		/*!
+			Creates an instance of @c PolyphaseFilter.
+
+			@param number_of_taps The size of window for input data, in samples per channel. Must be odd.
+			@param number_of_phases The number of fractional offsets between input samples that are distinguished.
+			@param input_sample_rate The sampling rate of the input signal.
+			@param low_frequency The lowest frequency of signal to retain in the output.
+			@param high_frequency The highest frequency of signal to retain in the output; this will be clamped to
+				the Nyquist frequency of the input.
+			@param attenuation The attenuation of the discarded frequencies.
+		*/
+		PolyphaseFilter(
+			size_t number_of_taps,
+			size_t number_of_phases,
+			float input_sample_rate,
+			float low_frequency,
+			float high_frequency,
+			float attenuation = FIRFilter::DefaultAttenuation
+		) :
+			number_of_taps_(number_of_taps | 1),
+			number_of_phases_(number_of_phases),
+			phase_length_((number_of_taps_ * Channels + Padding - 1) & ~(Padding - 1)),
+			coefficients_(phase_length_ * number_of_phases_)
+		{
+			// Design a single filter at the phase-multiplied rate, such that its centre falls upon
+			// the centre of the window when phase is zero, then deal its coefficients out amongst
+			// the phases. Phase p then produces output p/number_of_phases of a sample later than
+			// phase 0.
+			const auto prototype = FIRFilter::coefficients(
+				(number_of_taps_ - 1) * number_of_phases_ + 1,
+				input_sample_rate * float(number_of_phases_),
+				low_frequency,
+				std::min(high_frequency, input_sample_rate * 0.5f),
+				attenuation);
+
+			std::vector<float> phase(number_of_taps_);
+			for(size_t p = 0; p < number_of_phases_; p++) {
+				float total = 0.0f;
+				for(size_t c = 0; c < number_of_taps_; c++) {
+					const size_t index = c * number_of_phases_;
+					phase[c] = index >= p ? prototype[index - p] : 0.0f;
+					total += phase[c];
+				}
+
+				// Normalise each phase individually, so that all retain 100% of input volume.
+				int16_t *const target = &coefficients_[p * phase_length_];
+				for(size_t c = 0; c < number_of_taps_; c++) {
+					const auto coefficient = int16_t(phase[c] * FixedMultiplier / total);
+					for(size_t channel = 0; channel < Channels; channel++) {
+						target[c * Channels + channel] = coefficient;
+					}
+				}
+			}
+		}
+
+		/*! @returns The number of taps used by this filter, in samples per channel. */
+		size_t get_number_of_taps() const {
+			return number_of_taps_;
+		}
+
+		/*! @returns The number of phases this filter distinguishes. */
+		size_t get_number_of_phases() const {
+			return number_of_phases_;
+		}
+
+		/*!
+			Applies phase @c phase of the filter to the window of input that begins at @c source,
+			storing the @c Channels results to @c target.
+		*/
+		void apply(const int16_t *source, size_t phase, int16_t *target) const {
+			const int16_t *const coefficients = &coefficients_[phase * phase_length_];
+			int32_t totals[2] = {0, 0};
+
+#if defined(__AVX2__)
+			__m256i accumulator = _mm256_setzero_si256();
+			for(size_t c = 0; c < phase_length_; c += 16) {
+				const __m256i samples = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[c]));
+				const __m256i weights = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&coefficients[c]));
+				if constexpr (is_stereo) {
+					// Form full 32-bit products without combining neighbours, so that even lanes remain left
+					// and odd lanes remain right.
+					const __m256i low = _mm256_mullo_epi16(samples, weights);
+					const __m256i high = _mm256_mulhi_epi16(samples, weights);
+					accumulator = _mm256_add_epi32(accumulator, _mm256_unpacklo_epi16(low, high));
+					accumulator = _mm256_add_epi32(accumulator, _mm256_unpackhi_epi16(low, high));
+				} else {
+					accumulator = _mm256_add_epi32(accumulator, _mm256_madd_epi16(samples, weights));
+				}
+			}
+			alignas(32) int32_t lanes[8];
+			_mm256_store_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+			for(size_t c = 0; c < 8; c++) {
+				totals[c & is_stereo] += lanes[c];
+			}
+#elif defined(__SSE2__) || defined(_M_X64)
+			__m128i accumulator = _mm_setzero_si128();
+			for(size_t c = 0; c < phase_length_; c += 8) {
+				const __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[c]));
+				const __m128i weights = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&coefficients[c]));
+				if constexpr (is_stereo) {
+					const __m128i low = _mm_mullo_epi16(samples, weights);
+					const __m128i high = _mm_mulhi_epi16(samples, weights);
+					accumulator = _mm_add_epi32(accumulator, _mm_unpacklo_epi16(low, high));
+					accumulator = _mm_add_epi32(accumulator, _mm_unpackhi_epi16(low, high));
+				} else {
+					accumulator = _mm_add_epi32(accumulator, _mm_madd_epi16(samples, weights));
+				}
+			}
+			alignas(16) int32_t lanes[4];
+			_mm_store_si128(reinterpret_cast<__m128i *>(lanes), accumulator);
+			for(size_t c = 0; c < 4; c++) {
+				totals[c & is_stereo] += lanes[c];
+			}
+#elif defined(__ARM_NEON)
+			int32x4_t accumulator = vdupq_n_s32(0);
+			for(size_t c = 0; c < phase_length_; c += 8) {
+				const int16x8_t samples = vld1q_s16(&source[c]);
+				const int16x8_t weights = vld1q_s16(&coefficients[c]);
+				accumulator = vmlal_s16(accumulator, vget_low_s16(samples), vget_low_s16(weights));
+				accumulator = vmlal_s16(accumulator, vget_high_s16(samples), vget_high_s16(weights));
+			}
+			const int32x2_t pairs = vadd_s32(vget_low_s32(accumulator), vget_high_s32(accumulator));
+			totals[0] = vget_lane_s32(pairs, 0);
+			totals[is_stereo] += vget_lane_s32(pairs, 1);
+#else
+			for(size_t c = 0; c < phase_length_; c++) {
+				totals[c & is_stereo] += coefficients[c] * source[c];
+			}
+#endif
+
+			// Clamp rather than wrap any overshoot, e.g. the ringing around a full-range square wave.
+			for(size_t channel = 0; channel < Channels; channel++) {
+				target[channel] = int16_t(std::clamp(totals[channel] >> FixedShift, -32768, 32767));
+			}
+		}
+
+	private:
+		static constexpr float FixedMultiplier = 32767.0f;
+		static constexpr int FixedShift = 15;
+
+		size_t number_of_taps_;
+		size_t number_of_phases_;
+		size_t phase_length_;
+		std::vector<int16_t> coefficients_;
+};
+
+}
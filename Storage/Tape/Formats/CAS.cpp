@@ -261,3 +261,17 @@ Tape::Pulse CAS::virtual_get_next_pulse() {
 
 	return pulse;
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> CAS::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{chunk_pointer_, phase_, distance_into_phase_, distance_into_bit_});
+}
+
+void CAS::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	chunk_pointer_ = position.chunk_pointer;
+	phase_ = position.phase;
+	distance_into_phase_ = position.distance_into_phase;
+	distance_into_bit_ = position.distance_into_bit;
+}
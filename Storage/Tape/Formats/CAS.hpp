@@ -63,6 +63,16 @@ class CAS: public Tape {
 		} phase_ = Phase::Header;
 		std::size_t distance_into_phase_ = 0;
 		std::size_t distance_into_bit_ = 0;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			std::size_t chunk_pointer;
+			Phase phase;
+			std::size_t distance_into_phase;
+			std::size_t distance_into_bit;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
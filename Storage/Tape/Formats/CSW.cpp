@@ -14,8 +14,7 @@
 
 using namespace Storage::Tape;
 
-CSW::CSW(const std::string &file_name) :
-	source_data_pointer_(0) {
+CSW::CSW(const std::string &file_name) {
 	Storage::FileHolder file(file_name);
 	if(file.stats().st_size < 0x20) throw ErrorNotCSW;
 
@@ -84,11 +83,12 @@ CSW::CSW(const std::string &file_name) :
 	}
 
 	invert_pulse();
+	initial_type_ = pulse_.type;
 }
 
 CSW::CSW(const std::vector<uint8_t> &&data, CompressionType compression_type, bool initial_level, uint32_t sampling_rate) : compression_type_(compression_type) {
 	pulse_.length.clock_rate = sampling_rate;
-	pulse_.type = initial_level ? Pulse::High : Pulse::Low;
+	pulse_.type = initial_type_ = initial_level ? Pulse::High : Pulse::Low;
 	source_data_ = std::move(data);
 }
 
@@ -120,6 +120,7 @@ bool CSW::is_at_end() {
 
 void CSW::virtual_reset() {
 	source_data_pointer_ = 0;
+	pulse_.type = initial_type_;
 }
 
 Tape::Pulse CSW::virtual_get_next_pulse() {
@@ -128,3 +129,15 @@ Tape::Pulse CSW::virtual_get_next_pulse() {
 	if(!pulse_.length.length) pulse_.length.length = get_next_int32le();
 	return pulse_;
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> CSW::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{source_data_pointer_, pulse_.type});
+}
+
+void CSW::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	source_data_pointer_ = position.source_data_pointer;
+	pulse_.type = position.type;
+}
@@ -57,7 +57,16 @@ class CSW: public Tape {
 		void invert_pulse();
 
 		std::vector<uint8_t> source_data_;
-		std::size_t source_data_pointer_;
+		std::size_t source_data_pointer_ = 0;
+		Pulse::Type initial_type_;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			std::size_t source_data_pointer;
+			Pulse::Type type;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
@@ -77,3 +77,16 @@ Storage::Tape::Tape::Pulse CommodoreTAP::virtual_get_next_pulse() {
 
 	return current_pulse_;
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> CommodoreTAP::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{file_.tell(), current_pulse_, is_at_end_});
+}
+
+void CommodoreTAP::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	file_.seek(position.file_offset, SEEK_SET);
+	current_pulse_ = position.current_pulse;
+	is_at_end_ = position.is_at_end;
+}
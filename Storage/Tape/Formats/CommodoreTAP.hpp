@@ -45,6 +45,15 @@ class CommodoreTAP: public Tape {
 
 		Pulse current_pulse_;
 		bool is_at_end_ = false;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			long file_offset;
+			Pulse current_pulse;
+			bool is_at_end;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
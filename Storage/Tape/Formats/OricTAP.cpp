@@ -161,3 +161,27 @@ Tape::Pulse OricTAP::virtual_get_next_pulse() {
 bool OricTAP::is_at_end() {
 	return phase_ == End;
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> OricTAP::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{
+		file_.tell(),
+		current_value_, bit_count_, pulse_counter_,
+		phase_, next_phase_, phase_counter_,
+		data_end_address_, data_start_address_
+	});
+}
+
+void OricTAP::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	file_.seek(position.file_offset, SEEK_SET);
+	current_value_ = position.current_value;
+	bit_count_ = position.bit_count;
+	pulse_counter_ = position.pulse_counter;
+	phase_ = position.phase;
+	next_phase_ = position.next_phase;
+	phase_counter_ = position.phase_counter;
+	data_end_address_ = position.data_end_address;
+	data_start_address_ = position.data_start_address;
+}
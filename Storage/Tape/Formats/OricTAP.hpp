@@ -50,6 +50,19 @@ class OricTAP: public Tape {
 		} phase_, next_phase_;
 		int phase_counter_;
 		uint16_t data_end_address_, data_start_address_;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			long file_offset;
+			uint16_t current_value;
+			int bit_count;
+			int pulse_counter;
+			Phase phase, next_phase;
+			int phase_counter;
+			uint16_t data_end_address, data_start_address;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
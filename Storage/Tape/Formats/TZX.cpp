@@ -492,3 +492,19 @@ void TZX::get_hardware_type() {
 void TZX::ignore_glue_block() {
 	file_.seek(9, SEEK_CUR);
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> TZX::get_cursor() {
+	// Positions can be captured only between blocks.
+	if(!is_drained()) return nullptr;
+	return std::make_unique<StateCursor<Position>>(Position{file_.tell(), current_level_, is_at_end()});
+}
+
+void TZX::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	clear();
+	file_.seek(position.file_offset, SEEK_SET);
+	current_level_ = position.current_level;
+	set_is_at_end(position.is_at_end);
+}
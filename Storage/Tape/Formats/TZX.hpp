@@ -95,6 +95,15 @@ class TZX: public PulseQueuedTape {
 		void post_gap(unsigned int milliseconds);
 
 		void post_pulse(const Storage::Time &time);
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			long file_offset;
+			bool current_level;
+			bool is_at_end;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
@@ -208,3 +208,26 @@ void PRG::get_next_output_token() {
 		break;
 	}
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> PRG::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{
+		file_.tell(),
+		file_phase_, phase_offset_,
+		bit_phase_, output_token_,
+		output_byte_, check_digit_, copy_mask_
+	});
+}
+
+void PRG::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	file_.seek(position.file_offset, SEEK_SET);
+	file_phase_ = position.file_phase;
+	phase_offset_ = position.phase_offset;
+	bit_phase_ = position.bit_phase;
+	output_token_ = position.output_token;
+	output_byte_ = position.output_byte;
+	check_digit_ = position.check_digit;
+	copy_mask_ = position.copy_mask;
+}
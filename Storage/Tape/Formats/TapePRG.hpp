@@ -66,6 +66,20 @@ class PRG: public Tape {
 		uint8_t output_byte_;
 		uint8_t check_digit_;
 		uint8_t copy_mask_ = 0x80;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			long file_offset;
+			FilePhase file_phase;
+			int phase_offset;
+			int bit_phase;
+			OutputToken output_token;
+			uint8_t output_byte;
+			uint8_t check_digit;
+			uint8_t copy_mask;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
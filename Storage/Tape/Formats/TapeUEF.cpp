@@ -346,3 +346,20 @@ void UEF::set_platform_type() {
 	}
 	reset();
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> UEF::get_cursor() {
+	// Positions can be captured only between chunks.
+	if(!is_drained()) return nullptr;
+	return std::make_unique<StateCursor<Position>>(Position{gztell(file_), time_base_, is_300_baud_, is_at_end()});
+}
+
+void UEF::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	clear();
+	gzseek(file_, position.file_offset, SEEK_SET);
+	time_base_ = position.time_base;
+	is_300_baud_ = position.is_300_baud;
+	set_is_at_end(position.is_at_end);
+}
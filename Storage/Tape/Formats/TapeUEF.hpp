@@ -69,6 +69,16 @@ class UEF : public PulseQueuedTape, public TargetPlatform::TypeDistinguisher {
 
 		void queue_bit(int bit);
 		void queue_implicit_byte(uint8_t byte);
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			z_off_t file_offset;
+			unsigned int time_base;
+			bool is_300_baud;
+			bool is_at_end;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
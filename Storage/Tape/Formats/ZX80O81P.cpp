@@ -106,3 +106,24 @@ Tape::Pulse ZX80O81P::virtual_get_next_pulse() {
 TargetPlatform::Type ZX80O81P::target_platform_type() {
 	return platform_type_;
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> ZX80O81P::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{
+		byte_, bit_pointer_, wave_pointer_,
+		is_past_silence_, has_ended_final_byte_,
+		is_high_, data_pointer_
+	});
+}
+
+void ZX80O81P::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	byte_ = position.byte;
+	bit_pointer_ = position.bit_pointer;
+	wave_pointer_ = position.wave_pointer;
+	is_past_silence_ = position.is_past_silence;
+	has_ended_final_byte_ = position.has_ended_final_byte;
+	is_high_ = position.is_high;
+	data_pointer_ = position.data_pointer;
+}
@@ -55,6 +55,18 @@ class ZX80O81P: public Tape, public TargetPlatform::TypeDistinguisher {
 
 		std::vector<uint8_t> data_;
 		std::size_t data_pointer_;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			uint8_t byte;
+			int bit_pointer;
+			int wave_pointer;
+			bool is_past_silence, has_ended_final_byte;
+			bool is_high;
+			std::size_t data_pointer;
+		};
+		std::unique_ptr<Cursor> get_cursor();
+		void set_cursor(const Cursor &);
 };
 
 }
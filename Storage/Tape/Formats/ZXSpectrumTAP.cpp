@@ -120,3 +120,23 @@ void ZXSpectrumTAP::read_next_block() {
 	}
 	distance_into_phase_ = 0;
 }
+
+// MARK: - Cursors
+
+std::unique_ptr<Tape::Cursor> ZXSpectrumTAP::get_cursor() {
+	return std::make_unique<StateCursor<Position>>(Position{
+		file_.tell(),
+		block_length_, block_type_, data_byte_,
+		phase_, distance_into_phase_
+	});
+}
+
+void ZXSpectrumTAP::set_cursor(const Cursor &cursor) {
+	const auto &position = static_cast<const StateCursor<Position> &>(cursor).state;
+	file_.seek(position.file_offset, SEEK_SET);
+	block_length_ = position.block_length;
+	block_type_ = position.block_type;
+	data_byte_ = position.data_byte;
+	phase_ = position.phase;
+	distance_into_phase_ = position.distance_into_phase;
+}
@@ -51,6 +51,18 @@ class ZXSpectrumTAP: public Tape {
 		bool is_at_end() override;
 		void virtual_reset() override;
 		Pulse virtual_get_next_pulse() override;
+
+		// Cursors, to support fast seeking.
+		struct Position {
+			long file_offset;
+			uint16_t block_length;
+			uint8_t block_type;
+			uint8_t data_byte;
+			Phase phase;
+			int distance_into_phase;
+		};
+		std::unique_ptr<Cursor> get_cursor() override;
+		void set_cursor(const Cursor &) override;
 };
 
 }
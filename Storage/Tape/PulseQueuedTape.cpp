@@ -29,6 +29,10 @@ bool PulseQueuedTape::empty() {
 	return queued_pulses_.empty();
 }
 
+bool PulseQueuedTape::is_drained() {
+	return pulse_pointer_ == queued_pulses_.size();
+}
+
 void PulseQueuedTape::emplace_back(Tape::Pulse::Type type, Time length) {
 	queued_pulses_.emplace_back(type, length);
 }
@@ -34,6 +34,9 @@ class PulseQueuedTape: public Tape {
 		void clear();
 		bool empty();
 
+		/// @returns @c true if every queued pulse has been supplied; @c false otherwise.
+		bool is_drained();
+
 		void set_is_at_end(bool);
 		virtual void get_next_pulses() = 0;
 
@@ -8,6 +8,9 @@
 
 #include "Tape.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 using namespace Storage::Tape;
 
 // MARK: - Lifecycle
@@ -19,33 +22,41 @@ TapePlayer::TapePlayer(int input_clock_rate) :
 // MARK: - Seeking
 
 void Storage::Tape::Tape::seek(Time &seek_time) {
-	Time next_time(0);
-	reset();
-	while(next_time <= seek_time) {
+	// Resume from the latest checkpoint at or before the target, unless the current position
+	// is already at least as close.
+	const auto checkpoint = std::partition_point(checkpoints_.begin(), checkpoints_.end(), [&](const Checkpoint &checkpoint) {
+		return checkpoint.time <= seek_time;
+	});
+	const bool can_continue =
+		elapsed_ <= seek_time &&
+		(checkpoint == checkpoints_.begin() || std::prev(checkpoint)->offset <= offset_);
+	if(!can_continue) {
+		rewind_to(checkpoint);
+	}
+
+	while(elapsed_ <= seek_time) {
 		get_next_pulse();
-		next_time += pulse_.length;
 	}
 }
 
 Storage::Time Tape::get_current_time() {
-	Time time(0);
-	uint64_t steps = get_offset();
-	reset();
-	while(steps--) {
-		get_next_pulse();
-		time += pulse_.length;
-	}
-	return time;
+	return elapsed_;
 }
 
 void Storage::Tape::Tape::reset() {
 	offset_ = 0;
+	elapsed_ = Time(0);
 	virtual_reset();
 }
 
 Tape::Pulse Tape::get_next_pulse() {
+	if(offset_ >= next_checkpoint_) {
+		record_checkpoint();
+	}
+
 	pulse_ = virtual_get_next_pulse();
 	offset_++;
+	elapsed_ += pulse_.length;
 	return pulse_;
 }
 
@@ -55,13 +66,45 @@ uint64_t Tape::get_offset() {
 
 void Tape::set_offset(uint64_t offset) {
 	if(offset == offset_) return;
-	if(offset < offset_) {
-		reset();
+
+	// Resume from the latest checkpoint at or before the target if seeking backwards, or if
+	// doing so would skip some pulses.
+	const auto checkpoint = std::partition_point(checkpoints_.begin(), checkpoints_.end(), [&](const Checkpoint &checkpoint) {
+		return checkpoint.offset <= offset;
+	});
+	if(
+		offset < offset_ ||
+		(checkpoint != checkpoints_.begin() && std::prev(checkpoint)->offset > offset_)
+	) {
+		rewind_to(checkpoint);
 	}
+
 	offset -= offset_;
 	while(offset--) get_next_pulse();
 }
 
+// MARK: - Checkpoints
+
+void Tape::record_checkpoint() {
+	auto cursor = get_cursor();
+	if(!cursor) return;
+
+	checkpoints_.push_back(Checkpoint{offset_, elapsed_, std::move(cursor)});
+	next_checkpoint_ = offset_ + CheckpointSpacing;
+}
+
+void Tape::rewind_to(std::vector<Checkpoint>::iterator end) {
+	if(end == checkpoints_.begin()) {
+		reset();
+		return;
+	}
+
+	const auto &checkpoint = *std::prev(end);
+	set_cursor(*checkpoint.cursor);
+	offset_ = checkpoint.offset;
+	elapsed_ = checkpoint.time;
+}
+
 // MARK: - Player
 
 ClockingHint::Preference TapePlayer::preferred_clocking() const {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "../../ClockReceiver/ClockReceiver.hpp"
 #include "../../ClockReceiver/ClockingHintSource.hpp"
@@ -27,8 +28,11 @@ namespace Storage::Tape {
 		- zero pulses run along zero.
 
 	Subclasses should implement at least @c get_next_pulse and @c reset to provide a serial feeding
-	of pulses and the ability to return to the start of the feed. They may also implement @c seek if
-	a better implementation than a linear search from the @c reset time can be implemented.
+	of pulses and the ability to return to the start of the feed.
+
+	They may also implement @c get_cursor and @c set_cursor to capture and restore their position
+	within the feed. If they do then checkpoints will be recorded as the tape plays, and seeking
+	will resume from the nearest checkpoint rather than replaying from the start.
 */
 class Tape {
 	public:
@@ -69,21 +73,67 @@ class Tape {
 		virtual void set_offset(uint64_t);
 
 		/*!
-			Calculates and returns the amount of time that has elapsed since the time began. Potentially expensive.
+			@returns the amount of time that has elapsed since the tape began.
 		*/
 		virtual Time get_current_time();
 
 		/*!
-			Seeks to @c time. Potentially expensive.
+			Seeks to @c time. Potentially expensive if the tape doesn't supply cursors.
 		*/
 		virtual void seek(Time &time);
 
 		virtual ~Tape() = default;
 
+	protected:
+		/*!
+			A format-specific record of a position within the pulse feed, sufficient to
+			resume from that point.
+		*/
+		struct Cursor {
+			virtual ~Cursor() = default;
+		};
+
+		/// Provides a @c Cursor that holds a copy of any @c StateT.
+		template <typename StateT> struct StateCursor: public Cursor {
+			StateCursor(const StateT &state) : state(state) {}
+			StateT state;
+		};
+
+		/*!
+			@returns A cursor describing the current position, or @c nullptr if the position
+				can't currently be captured. The default implementation always returns @c nullptr.
+		*/
+		virtual std::unique_ptr<Cursor> get_cursor() {
+			return nullptr;
+		}
+
+		/*!
+			Returns to a position previously captured by @c get_cursor.
+		*/
+		virtual void set_cursor(const Cursor &) {}
+
 	private:
-		uint64_t offset_;
+		uint64_t offset_ = 0;
 		Tape::Pulse pulse_;
 
+		/// The time from the start of the tape to the start of the next pulse.
+		Time elapsed_;
+
+		/// Checkpoints are recorded no more frequently than this, in pulses.
+		static constexpr uint64_t CheckpointSpacing = 4096;
+		struct Checkpoint {
+			uint64_t offset;
+			Time time;
+			std::unique_ptr<Cursor> cursor;
+		};
+		std::vector<Checkpoint> checkpoints_;
+		uint64_t next_checkpoint_ = CheckpointSpacing;
+
+		void record_checkpoint();
+
+		/// Restores the checkpoint before @c end, or resets the tape if there is none.
+		void rewind_to(std::vector<Checkpoint>::iterator end);
+
 		virtual Pulse virtual_get_next_pulse() = 0;
 		virtual void virtual_reset() = 0;
 };
@@ -148,6 +148,7 @@ set(CLK_SOURCES
 	Machines/Utility/MemoryFuzzer.cpp
 	Machines/Utility/MemoryPacker.cpp
 	Machines/Utility/ROMCatalogue.cpp
+	Machines/Utility/Rewinder.cpp
 	Machines/Utility/StringSerialiser.cpp
 	Machines/Utility/Typer.cpp
 
@@ -160,9 +161,12 @@ set(CLK_SOURCES
 	Outputs/OpenGL/ScanTargetGLSLFragments.cpp
 	Outputs/ScanTarget.cpp
 	Outputs/ScanTargets/BufferingScanTarget.cpp
+	Outputs/Software/ScanTarget.cpp
+	Outputs/Speaker/AudioSink.cpp
 
 	Processors/6502/Implementation/6502Storage.cpp
 	Processors/6502/State/State.cpp
+	Processors/68000/State/State.cpp
 	Processors/65816/Implementation/65816Base.cpp
 	Processors/65816/Implementation/65816Storage.cpp
 	Processors/Z80/Implementation/PartialMachineCycle.cpp